@@ -0,0 +1,157 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace nkentseu {
+    namespace bench {
+
+        struct BenchCase {
+            std::string nom;
+            std::function<void()> fonction;
+        };
+
+        inline std::vector<BenchCase>& Registre() {
+            static std::vector<BenchCase> registre;
+            return registre;
+        }
+
+        inline void Enregistrer(const std::string& nom, std::function<void()> fonction) {
+            Registre().push_back({nom, std::move(fonction)});
+        }
+
+        /**
+         * @brief Meilleur temps (en ms) sur plusieurs exécutions
+         */
+        inline double MesurerMs(const std::function<void()>& fonction, int repetitions = 5) {
+            double meilleur = 0.0;
+            for (int i = 0; i < repetitions; i++) {
+                auto debut = std::chrono::steady_clock::now();
+                fonction();
+                auto fin = std::chrono::steady_clock::now();
+                double ms = std::chrono::duration<double, std::milli>(fin - debut).count();
+                if (i == 0 || ms < meilleur) {
+                    meilleur = ms;
+                }
+            }
+            return meilleur;
+        }
+
+        /**
+         * @brief Affiche une mesure, avec le gain par rapport à une référence si fournie
+         */
+        inline void Rapporter(const std::string& libelle, double ms, double reference = 0.0) {
+            if (reference > 0.0 && ms > 0.0) {
+                std::printf("  %-44s %10.3f ms   x%.2f\n", libelle.c_str(), ms, reference / ms);
+            } else {
+                std::printf("  %-44s %10.3f ms\n", libelle.c_str(), ms);
+            }
+        }
+
+        /**
+         * @brief Affiche la médiane et la queue d'une série de durées (en ns)
+         */
+        inline void RapporterLatences(const std::string& libelle, std::vector<double>& durees) {
+            if (durees.empty()) {
+                return;
+            }
+            std::sort(durees.begin(), durees.end());
+            auto centile = [&durees](double p) {
+                size_t rang = (size_t)(p / 100.0 * (double)(durees.size() - 1));
+                return durees[rang];
+            };
+            std::printf("  %-44s p50 %8.0f ns   p99 %8.0f ns   p99.99 %8.0f ns   max %8.0f ns\n",
+                        libelle.c_str(), centile(50.0), centile(99.0), centile(99.99), durees.back());
+        }
+
+        // Puits volatil : ce qui y est écrit ne peut pas être éliminé
+        inline volatile unsigned long long puits = 0;
+
+        /**
+         * @brief Empêche le compilateur d'éliminer un calcul dont le résultat est ignoré
+         */
+        inline void Consommer(const void* pointeur) {
+            puits = (unsigned long long)(size_t)pointeur;
+        }
+
+        inline void Consommer(long long valeur) {
+            puits = (unsigned long long)valeur;
+        }
+
+        // ====================================================================
+        // STRUCTURES CONCURRENTES
+        // ====================================================================
+
+        /**
+         * @brief Nombres de threads balayés : puissances de deux jusqu'au nombre de cœurs (au moins 64)
+         */
+        inline std::vector<int> ComptesThreads() {
+            int coeurs = (int)std::thread::hardware_concurrency();
+            int maximum = coeurs > 64 ? coeurs : 64;
+            std::vector<int> comptes;
+            for (int n = 1; n <= maximum; n *= 2) {
+                comptes.push_back(n);
+            }
+            if (comptes.back() != maximum) {
+                comptes.push_back(maximum);
+            }
+            return comptes;
+        }
+
+        /**
+         * @brief Répartit des paires ajout/retrait sur nombreThreads threads (meilleur de 3)
+         * @param operations Nombre total d'opérations, ajouts et retraits compris
+         * @param retirer Renvoie la valeur retirée (accumulée pour ne pas être éliminée)
+         */
+        template <typename Ajouter, typename Retirer>
+        double MesurerPaires(int nombreThreads, int operations, Ajouter ajouter, Retirer retirer) {
+            return MesurerMs([&]() {
+                int parThread = operations / 2 / nombreThreads;
+                std::vector<std::thread> threads;
+                for (int t = 0; t < nombreThreads; t++) {
+                    threads.emplace_back([&, t]() {
+                        long long somme = 0;
+                        for (int i = 0; i < parThread; i++) {
+                            ajouter(t + i);
+                            somme += retirer();
+                        }
+                        Consommer(somme);
+                    });
+                }
+                for (std::thread& thread : threads) {
+                    thread.join();
+                }
+            }, 3);
+        }
+
+        /**
+         * @brief Compare, pour chaque nombre de ComptesThreads, une structure concurrente à sa référence sous verrou
+         * @param reference Durée (ms) de la ListeSimple protégée par un mutex pour n threads
+         * @param mesure Durée (ms) de la structure concurrente pour n threads
+         */
+        template <typename Reference, typename Mesure>
+        void ComparerAuVerrou(const std::string& libelle, Reference reference, Mesure mesure) {
+            for (int nombreThreads : ComptesThreads()) {
+                std::string threads = ", " + std::to_string(nombreThreads) + " threads";
+                double ms = reference(nombreThreads);
+                Rapporter("mutex + ListeSimple" + threads, ms);
+                Rapporter(libelle + threads, mesure(nombreThreads), ms);
+            }
+        }
+
+    } // namespace bench
+} // namespace nkentseu
+
+// Macro pour définir un benchmark (même principe que TEST_CASE)
+#define BENCH_CASE(name) \
+    static void BenchCase_##name(); \
+    static struct BenchRegistrar_##name { \
+        BenchRegistrar_##name() { \
+            nkentseu::bench::Enregistrer(#name, &BenchCase_##name); \
+        } \
+    } bench_registrar_##name; \
+    static void BenchCase_##name()
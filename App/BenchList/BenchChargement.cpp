@@ -0,0 +1,83 @@
+#include "Bench.h"
+
+#include "List/ListS.h"
+#include "List/ListChargement.h"
+
+#include <charconv>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+namespace {
+    const int nombreValeurs = 1 << 22;
+}
+
+/**
+ * @brief Écrit nombreValeurs entiers aléatoires, séparés par virgules et fins de ligne
+ * @return Taille du fichier en octets
+ */
+static size_t EcrireFichier(const std::string& chemin) {
+    std::mt19937 generateur(2024);
+    std::uniform_int_distribution<int> distribution(-1000000, 1000000);
+
+    std::string texte;
+    for (int i = 0; i < nombreValeurs; i++) {
+        texte += std::to_string(distribution(generateur));
+        texte += (i % 16 == 15) ? '\n' : ',';
+    }
+    std::ofstream fichier(chemin, std::ios::binary);
+    fichier.write(texte.data(), (std::streamsize)texte.size());
+    return texte.size();
+}
+
+static double MegaOctetsParSeconde(size_t octets, double ms) {
+    return (double)octets / (1024.0 * 1024.0) / (ms / 1000.0);
+}
+
+BENCH_CASE(ChargementTexte) {
+    std::string chemin = (std::filesystem::temp_directory_path() / "BenchChargementTexte.txt").string();
+    size_t octets = EcrireFichier(chemin);
+    std::printf("  (%d valeurs, %.1f Mo)\n", nombreValeurs, (double)octets / (1024.0 * 1024.0));
+
+    // Ce que coûtent séparément l'analyse et l'allocation des nœuds
+    std::string texte(octets, '\0');
+    std::ifstream(chemin, std::ios::binary).read(&texte[0], (std::streamsize)octets);
+    double analyse = nkentseu::bench::MesurerMs([&]() {
+        long long somme = 0;
+        const char* p = texte.data();
+        const char* fin = p + texte.size();
+        while (p < fin) {
+            int valeur = 0;
+            p = std::from_chars(p, fin, valeur).ptr + 1;
+            somme += valeur;
+        }
+        nkentseu::bench::Consommer(somme);
+    });
+    std::printf("  %-44s %10.3f ms   %8.0f Mo/s\n", "from_chars seul (fichier en mémoire)", analyse, MegaOctetsParSeconde(octets, analyse));
+
+    // Detruire reste hors mesure : seule la construction de la liste est chronométrée
+    double allocation = 0.0;
+    double chargement = 0.0;
+    for (int repetition = 0; repetition < 3; repetition++) {
+        ListeSimple* liste = AllocateSimple();
+        double ms = nkentseu::bench::MesurerMs([&]() {
+            for (int i = 0; i < nombreValeurs; i++) {
+                InsererFin(liste, i);
+            }
+        }, 1);
+        allocation = (repetition == 0 || ms < allocation) ? ms : allocation;
+        Detruire(liste);
+
+        liste = AllocateSimple();
+        ms = nkentseu::bench::MesurerMs([&]() {
+            nkentseu::bench::Consommer(ChargerTexte(chemin.c_str(), liste, nullptr));
+        }, 1);
+        chargement = (repetition == 0 || ms < chargement) ? ms : chargement;
+        Detruire(liste);
+    }
+    std::printf("  %-44s %10.3f ms   %8.0f Mo/s\n", "InsererFin seul", allocation, MegaOctetsParSeconde(octets, allocation));
+    std::printf("  %-44s %10.3f ms   %8.0f Mo/s\n", "ChargerTexte", chargement, MegaOctetsParSeconde(octets, chargement));
+
+    std::filesystem::remove(chemin);
+}
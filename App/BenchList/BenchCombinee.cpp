@@ -0,0 +1,109 @@
+#include "Bench.h"
+
+#include "List/ListS.h"
+#include "List/ListCombinee.h"
+
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    const int OPERATIONS_TOTALES = 1 << 15;
+    const int CLES = 1024;
+
+    /**
+     * @brief Mélange 20 % insertions, 20 % suppressions, 60 % recherches sur une liste triée d'environ CLES / 2 clés
+     */
+    template <typename Inserer, typename Supprimer, typename Rechercher>
+    double MesurerMelange(int nombreThreads, Inserer inserer, Supprimer supprimer, Rechercher rechercher) {
+        return nkentseu::bench::MesurerMs([&]() {
+            int parThread = OPERATIONS_TOTALES / nombreThreads;
+            std::vector<std::thread> threads;
+            for (int t = 0; t < nombreThreads; t++) {
+                threads.emplace_back([&, t]() {
+                    unsigned int graine = 2654435761u * (t + 1);
+                    long long trouves = 0;
+                    for (int i = 0; i < parThread; i++) {
+                        graine = graine * 1103515245u + 12345u;
+                        int cle = (int)((graine >> 8) % CLES);
+                        int tirage = (int)((graine >> 4) % 10);
+                        if (tirage < 2) {
+                            inserer(cle);
+                        } else if (tirage < 4) {
+                            supprimer(cle);
+                        } else {
+                            trouves += rechercher(cle) ? 1 : 0;
+                        }
+                    }
+                    nkentseu::bench::Consommer(trouves);
+                });
+            }
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+        }, 3);
+    }
+
+} // namespace
+
+BENCH_CASE(CombinaisonTriee) {
+    for (int nombreThreads : nkentseu::bench::ComptesThreads()) {
+        std::string suffixe = ", " + std::to_string(nombreThreads) + " threads";
+
+        ListeSimple* liste = AllocateSimple();
+        for (int cle = 0; cle < CLES; cle += 2) {
+            InsererTrie(liste, cle);
+        }
+        std::mutex verrou;
+        double reference = MesurerMelange(nombreThreads,
+            [&](int cle) {
+                std::lock_guard<std::mutex> garde(verrou);
+                InsererTrie(liste, cle);
+            },
+            [&](int cle) {
+                std::lock_guard<std::mutex> garde(verrou);
+                SupprimerValeur(liste, cle);
+            },
+            [&](int cle) {
+                std::lock_guard<std::mutex> garde(verrou);
+                return RechercherValeur(liste, cle) != nullptr;
+            });
+        Detruire(liste);
+        nkentseu::bench::Rapporter("mutex" + suffixe, reference);
+
+        liste = AllocateSimple();
+        for (int cle = 0; cle < CLES; cle += 2) {
+            InsererTrie(liste, cle);
+        }
+        std::shared_mutex verrouPartage;
+        double ms = MesurerMelange(nombreThreads,
+            [&](int cle) {
+                std::unique_lock<std::shared_mutex> garde(verrouPartage);
+                InsererTrie(liste, cle);
+            },
+            [&](int cle) {
+                std::unique_lock<std::shared_mutex> garde(verrouPartage);
+                SupprimerValeur(liste, cle);
+            },
+            [&](int cle) {
+                std::shared_lock<std::shared_mutex> garde(verrouPartage);
+                return RechercherValeur(liste, cle) != nullptr;
+            });
+        Detruire(liste);
+        nkentseu::bench::Rapporter("shared_mutex" + suffixe, ms, reference);
+
+        ListeCombinee* combinee = AllocateCombinee();
+        for (int cle = 0; cle < CLES; cle += 2) {
+            InsererTrie(combinee, cle);
+        }
+        ms = MesurerMelange(nombreThreads,
+            [&](int cle) { InsererTrie(combinee, cle); },
+            [&](int cle) { SupprimerValeur(combinee, cle); },
+            [&](int cle) { return RechercherValeur(combinee, cle); });
+        Detruire(combinee);
+        nkentseu::bench::Rapporter("combinaison" + suffixe, ms, reference);
+    }
+}
@@ -0,0 +1,89 @@
+#include "Bench.h"
+
+#include "List/ListS.h"
+#include "List/ListEnsemble.h"
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    const int OPERATIONS_TOTALES = 1 << 16;
+    const int DOMAINE_CLES = 4096;
+
+    /**
+     * @brief Mélange 90 % recherches, 9 % insertions, 1 % suppressions sur DOMAINE_CLES clés
+     */
+    template <typename Rechercher, typename Inserer, typename Supprimer>
+    double MesurerEnsemble(int nombreThreads, Rechercher rechercher, Inserer inserer, Supprimer supprimer) {
+        return nkentseu::bench::MesurerMs([&]() {
+            int parThread = OPERATIONS_TOTALES / nombreThreads;
+            std::vector<std::thread> threads;
+            for (int t = 0; t < nombreThreads; t++) {
+                threads.emplace_back([&, t]() {
+                    unsigned int etat = 2463534242u + (unsigned int)t * 7919u;
+                    long long trouves = 0;
+                    for (int i = 0; i < parThread; i++) {
+                        etat ^= etat << 13;
+                        etat ^= etat >> 17;
+                        etat ^= etat << 5;
+                        int cle = (int)(etat % DOMAINE_CLES);
+                        int tirage = (int)((etat >> 12) % 100);
+                        if (tirage < 90) {
+                            trouves += rechercher(cle) ? 1 : 0;
+                        } else if (tirage < 99) {
+                            inserer(cle);
+                        } else {
+                            supprimer(cle);
+                        }
+                    }
+                    nkentseu::bench::Consommer(trouves);
+                });
+            }
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+        }, 3);
+    }
+
+} // namespace
+
+BENCH_CASE(EnsembleConcurrent) {
+    for (int nombreThreads : nkentseu::bench::ComptesThreads()) {
+        // Les deux structures partent de la moitié des clés
+        ListeSimple* liste = AllocateSimple();
+        EnsembleConcurrent* ensemble = AllocateEnsembleConcurrent();
+        for (int cle = 0; cle < DOMAINE_CLES; cle += 2) {
+            InsererFin(liste, cle);
+            InsererTrie(ensemble, cle);
+        }
+
+        std::mutex verrou;
+        double reference = MesurerEnsemble(nombreThreads,
+            [&](int cle) {
+                std::lock_guard<std::mutex> garde(verrou);
+                return RechercherValeur(liste, cle) != nullptr;
+            },
+            [&](int cle) {
+                std::lock_guard<std::mutex> garde(verrou);
+                if (RechercherValeur(liste, cle) == nullptr) {
+                    InsererTrie(liste, cle);
+                }
+            },
+            [&](int cle) {
+                std::lock_guard<std::mutex> garde(verrou);
+                SupprimerValeur(liste, cle);
+            });
+        Detruire(liste);
+        nkentseu::bench::Rapporter("mutex + ListeSimple, " + std::to_string(nombreThreads) + " threads", reference);
+
+        double ms = MesurerEnsemble(nombreThreads,
+            [&](int cle) { return RechercherValeur(ensemble, cle); },
+            [&](int cle) { InsererTrie(ensemble, cle); },
+            [&](int cle) { SupprimerValeur(ensemble, cle); });
+        Detruire(ensemble);
+        nkentseu::bench::Rapporter("EnsembleConcurrent, " + std::to_string(nombreThreads) + " threads", ms, reference);
+    }
+}
@@ -0,0 +1,46 @@
+#include "Bench.h"
+
+#include "List/ListS.h"
+#include "List/ListFile.h"
+
+#include <mutex>
+
+namespace {
+
+    // Chaque thread enfile puis défile : forte contention sur les deux bouts
+    const int OPERATIONS_TOTALES = 1 << 20;
+
+} // namespace
+
+BENCH_CASE(FileConcurrente) {
+    nkentseu::bench::ComparerAuVerrou("FileConcurrente",
+        [](int nombreThreads) {
+            ListeSimple* liste = AllocateSimple();
+            std::mutex verrou;
+            double ms = nkentseu::bench::MesurerPaires(nombreThreads, OPERATIONS_TOTALES,
+                [&](int v) {
+                    std::lock_guard<std::mutex> garde(verrou);
+                    InsererFin(liste, v);
+                },
+                [&]() {
+                    std::lock_guard<std::mutex> garde(verrou);
+                    int valeur = liste->tete != nullptr ? liste->tete->donnee : 0;
+                    SupprimerDebut(liste);
+                    return valeur;
+                });
+            Detruire(liste);
+            return ms;
+        },
+        [](int nombreThreads) {
+            FileConcurrente* file = AllocateFileConcurrente();
+            double ms = nkentseu::bench::MesurerPaires(nombreThreads, OPERATIONS_TOTALES,
+                [&](int v) { InsererFin(file, v); },
+                [&]() {
+                    int valeur = 0;
+                    SupprimerDebut(file, &valeur);
+                    return valeur;
+                });
+            Detruire(file);
+            return ms;
+        });
+}
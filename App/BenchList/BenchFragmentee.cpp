@@ -0,0 +1,89 @@
+#include "Bench.h"
+
+#include "List/ListS.h"
+#include "List/ListFragmentee.h"
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    const int VALEURS_TOTALES = 1 << 18;
+    const int TAILLE_LOT = 256;
+
+    /**
+     * @brief Chargeurs qui se partagent VALEURS_TOTALES valeurs, puis rassemblement dans une ListeSimple
+     */
+    template <typename Charger, typename Rassembler>
+    double MesurerIngestion(int nombreChargeurs, Charger charger, Rassembler rassembler) {
+        return nkentseu::bench::MesurerMs([&]() {
+            int parChargeur = VALEURS_TOTALES / nombreChargeurs;
+            std::vector<std::thread> chargeurs;
+            for (int t = 0; t < nombreChargeurs; t++) {
+                chargeurs.emplace_back([&, t]() { charger(t * parChargeur, parChargeur); });
+            }
+            for (std::thread& chargeur : chargeurs) {
+                chargeur.join();
+            }
+            rassembler();
+        }, 3);
+    }
+
+} // namespace
+
+BENCH_CASE(IngestionFragmentee) {
+    for (int nombreChargeurs : nkentseu::bench::ComptesThreads()) {
+        std::string suffixe = ", " + std::to_string(nombreChargeurs) + " chargeurs";
+
+        ListeSimple* unique = AllocateSimple();
+        std::mutex verrou;
+        double reference = MesurerIngestion(nombreChargeurs,
+            [&](int debut, int nombre) {
+                for (int i = debut; i < debut + nombre; i++) {
+                    std::lock_guard<std::mutex> garde(verrou);
+                    InsererFin(unique, i);
+                }
+            },
+            [&]() {
+                nkentseu::bench::Consommer(CompterElements((const ListeSimple*)unique));
+                Nettoyer(unique);
+            });
+        Detruire(unique);
+        nkentseu::bench::Rapporter("ListeSimple + mutex" + suffixe, reference);
+
+        ListeFragmentee* fragmentee = AllocateFragmentee(nombreChargeurs, FRAGMENTS_PAR_THREAD);
+        ListeSimple* resultat = AllocateSimple();
+        double ms = MesurerIngestion(nombreChargeurs,
+            [&](int debut, int nombre) {
+                for (int i = debut; i < debut + nombre; i++) {
+                    InsererFin(fragmentee, i);
+                }
+            },
+            [&]() {
+                nkentseu::bench::Consommer(ConcatenerTout(fragmentee, resultat));
+                Nettoyer(resultat);
+            });
+        nkentseu::bench::Rapporter("fragments par thread" + suffixe, ms, reference);
+
+        ms = MesurerIngestion(nombreChargeurs,
+            [&](int debut, int nombre) {
+                int lot[TAILLE_LOT];
+                for (int i = 0; i < nombre; i += TAILLE_LOT) {
+                    int compte = nombre - i < TAILLE_LOT ? nombre - i : TAILLE_LOT;
+                    for (int k = 0; k < compte; k++) {
+                        lot[k] = debut + i + k;
+                    }
+                    InsererLot(fragmentee, lot, compte);
+                }
+            },
+            [&]() {
+                nkentseu::bench::Consommer(ConcatenerTout(fragmentee, resultat));
+                Nettoyer(resultat);
+            });
+        nkentseu::bench::Rapporter("fragments par thread, lots" + suffixe, ms, reference);
+        Detruire(resultat);
+        Detruire(fragmentee);
+    }
+}
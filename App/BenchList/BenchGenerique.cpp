@@ -0,0 +1,113 @@
+#include "Bench.h"
+
+#include "List/ListS.h"
+#include "List/ListGenerique.h"
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+BENCH_CASE(GeneriqueEntiers) {
+    const int nombre = 1 << 20;
+
+    // L'API int et la spécialisation générique doivent coûter la même chose
+    double reference = nkentseu::bench::MesurerMs([&]() {
+        ListeSimple* liste = AllocateSimple();
+        for (int i = 0; i < nombre; i++) {
+            InsererFin(liste, i);
+        }
+        long long somme = 0;
+        for (NoeudS* courant = liste->tete; courant != nullptr; courant = courant->suivant) {
+            somme += courant->donnee;
+        }
+        nkentseu::bench::Consommer(somme);
+        Detruire(liste);
+    });
+    nkentseu::bench::Rapporter("ListeSimple : InsererFin + somme", reference);
+
+    double generique = nkentseu::bench::MesurerMs([&]() {
+        ListeSimpleT<int>* liste = AllocateSimpleT<int>();
+        for (int i = 0; i < nombre; i++) {
+            EmplacerFin(liste, i);
+        }
+        long long somme = 0;
+        for (int valeur : *liste) {
+            somme += valeur;
+        }
+        nkentseu::bench::Consommer(somme);
+        Detruire(liste);
+    });
+    nkentseu::bench::Rapporter("ListeSimpleT<int> : EmplacerFin + somme", generique, reference);
+}
+
+BENCH_CASE(GeneriqueChaines) {
+    const int nombre = 1 << 18;
+    std::vector<std::string> source(nombre);
+    for (int i = 0; i < nombre; i++) {
+        source[i] = "element-de-liste-" + std::to_string(i);
+    }
+
+    // Ancienne méthode : la liste porte un index dans une table annexe
+    std::vector<std::string> table;
+    ListeSimple* indirecte = AllocateSimple();
+    for (int i = 0; i < nombre; i++) {
+        table.push_back(source[i]);
+        InsererFin(indirecte, (int)table.size() - 1);
+    }
+    double reference = nkentseu::bench::MesurerMs([&]() {
+        size_t total = 0;
+        for (NoeudS* courant = indirecte->tete; courant != nullptr; courant = courant->suivant) {
+            total += table[courant->donnee].size();
+        }
+        nkentseu::bench::Consommer((long long)total);
+    });
+    nkentseu::bench::Rapporter("ListeSimple + table annexe : parcours", reference);
+
+    ListeSimpleT<std::string>* directe = AllocateSimpleT<std::string>();
+    for (int i = 0; i < nombre; i++) {
+        EmplacerFin(directe, source[i]);
+    }
+    double ms = nkentseu::bench::MesurerMs([&]() {
+        size_t total = 0;
+        for (const std::string& valeur : *directe) {
+            total += valeur.size();
+        }
+        nkentseu::bench::Consommer((long long)total);
+    });
+    nkentseu::bench::Rapporter("ListeSimpleT<std::string> : parcours", ms, reference);
+
+    double copie = nkentseu::bench::MesurerMs([&]() {
+        ListeSimpleT<std::string>* resultat = Copier(directe);
+        Detruire(resultat);
+    }, 3);
+    nkentseu::bench::Rapporter("ListeSimpleT<std::string> : Copier", copie);
+
+    Detruire(directe);
+    Detruire(indirecte);
+}
+
+BENCH_CASE(GeneriqueRessources) {
+    const int nombre = 1 << 18;
+    auto remplirVider = [&](std::pmr::memory_resource* ressource) {
+        ListeSimpleT<int> liste = CreerSimpleT<int>(ressource);
+        for (int i = 0; i < nombre; i++) {
+            EmplacerFin(&liste, i);
+        }
+        nkentseu::bench::Consommer(liste.queue);
+        Nettoyer(&liste);
+    };
+
+    double reference = nkentseu::bench::MesurerMs([&]() { remplirVider(nullptr); });
+    nkentseu::bench::Rapporter("malloc : remplir + vider", reference);
+
+    std::pmr::unsynchronized_pool_resource pool;
+    double ms = nkentseu::bench::MesurerMs([&]() { remplirVider(&pool); });
+    nkentseu::bench::Rapporter("unsynchronized_pool_resource", ms, reference);
+
+    std::vector<char> tampon(nombre * sizeof(NoeudST<int>) + 4096);
+    ms = nkentseu::bench::MesurerMs([&]() {
+        std::pmr::monotonic_buffer_resource requete(tampon.data(), tampon.size());
+        remplirVider(&requete);
+    });
+    nkentseu::bench::Rapporter("monotonic_buffer_resource", ms, reference);
+}
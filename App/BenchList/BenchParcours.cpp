@@ -0,0 +1,61 @@
+#include "Bench.h"
+
+#include "List/ListS.h"
+#include "List/ListParcours.h"
+
+#include <random>
+
+/**
+ * @brief Construit une liste dont les nœuds sont chaînés dans un ordre aléatoire
+ *
+ * Les nœuds sont alloués d'abord puis reliés après mélange : chaque lien
+ * pointe ailleurs en mémoire et le parcours enchaîne des défauts de cache.
+ */
+static ListeSimple* CreerListeDispersee(int nombre, unsigned graine) {
+    std::vector<NoeudS*> noeuds(nombre);
+    for (int i = 0; i < nombre; i++) {
+        noeuds[i] = CreerNoeudS(i);
+    }
+    std::shuffle(noeuds.begin(), noeuds.end(), std::mt19937(graine));
+
+    ListeSimple* liste = AllocateSimple();
+    for (int i = 0; i + 1 < nombre; i++) {
+        noeuds[i]->suivant = noeuds[i + 1];
+    }
+    liste->tete = noeuds.front();
+    liste->queue = noeuds.back();
+    liste->taille = nombre;
+    return liste;
+}
+
+BENCH_CASE(ParcoursDisperse) {
+    const int nombre = 1 << 20;
+    ListeSimple* liste = CreerListeDispersee(nombre, 12345);
+
+    // Valeur absente : chaque recherche parcourt toute la liste
+    double reference = nkentseu::bench::MesurerMs([&]() {
+        nkentseu::bench::Consommer(RechercherValeur(liste, -1));
+    });
+    nkentseu::bench::Rapporter("RechercherValeur sans sauts", reference);
+
+    ActiverSauts(liste);
+    RechercherValeur(liste, -1); // remplit la table
+
+    const int distances[] = {0, 2, 4, 8, 16, 32, 64};
+    for (int distance : distances) {
+        DefinirDistancePrefetch(distance);
+        double ms = nkentseu::bench::MesurerMs([&]() {
+            nkentseu::bench::Consommer(RechercherValeur(liste, -1));
+        });
+        nkentseu::bench::Rapporter("RechercherValeur, distance " + std::to_string(distance), ms, reference);
+    }
+    DefinirDistancePrefetch(DISTANCE_PREFETCH_DEFAUT);
+
+    double copie = nkentseu::bench::MesurerMs([&]() {
+        ListeSimple* resultat = Copier(liste);
+        Detruire(resultat);
+    }, 3);
+    nkentseu::bench::Rapporter("Copier avec sauts (distance par défaut)", copie);
+
+    Detruire(liste);
+}
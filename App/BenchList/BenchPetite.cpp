@@ -0,0 +1,55 @@
+#include "Bench.h"
+
+#include "List/ListS.h"
+#include "List/ListPetite.h"
+
+#include <vector>
+
+BENCH_CASE(PetitesListes) {
+    const int nombreListes = 1 << 18;
+    const int elements = 6;
+
+    // Beaucoup de listes minuscules : un en-tête et six nœuds alloués chacune
+    double reference = nkentseu::bench::MesurerMs([&]() {
+        std::vector<ListeSimple*> listes(nombreListes);
+        for (int i = 0; i < nombreListes; i++) {
+            listes[i] = AllocateSimple();
+            for (int j = 0; j < elements; j++) {
+                InsererFin(listes[i], i + j);
+            }
+        }
+        long long somme = 0;
+        for (ListeSimple* liste : listes) {
+            for (NoeudS* courant = liste->tete; courant != nullptr; courant = courant->suivant) {
+                somme += courant->donnee;
+            }
+        }
+        nkentseu::bench::Consommer(somme);
+        for (ListeSimple* liste : listes) {
+            Detruire(liste);
+        }
+    }, 3);
+    nkentseu::bench::Rapporter("ListeSimple x 6 éléments", reference);
+
+    // Même travail : les valeurs restent dans les en-têtes, contigus dans le vecteur
+    double ms = nkentseu::bench::MesurerMs([&]() {
+        std::vector<ListePetiteS<8>> listes(nombreListes);
+        for (int i = 0; i < nombreListes; i++) {
+            Initialiser(&listes[i]);
+            for (int j = 0; j < elements; j++) {
+                InsererFin(&listes[i], i + j);
+            }
+        }
+        long long somme = 0;
+        for (const ListePetiteS<8>& liste : listes) {
+            for (int valeur : liste) {
+                somme += valeur;
+            }
+        }
+        nkentseu::bench::Consommer(somme);
+        for (ListePetiteS<8>& liste : listes) {
+            Nettoyer(&liste);
+        }
+    }, 3);
+    nkentseu::bench::Rapporter("ListePetiteS<8> x 6 éléments", ms, reference);
+}
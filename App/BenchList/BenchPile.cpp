@@ -0,0 +1,52 @@
+#include "Bench.h"
+
+#include "List/ListS.h"
+#include "List/ListPile.h"
+
+#include <mutex>
+
+namespace {
+
+    const int OPERATIONS_TOTALES = 1 << 20;
+
+} // namespace
+
+BENCH_CASE(PileConcurrente) {
+    nkentseu::bench::ComparerAuVerrou("PileConcurrente",
+        [](int nombreThreads) {
+            // Référence : la liste simple protégée par un verrou global
+            ListeSimple* liste = AllocateSimple();
+            std::mutex verrou;
+            for (int i = 0; i < 64; i++) {
+                InsererDebut(liste, i);
+            }
+            double ms = nkentseu::bench::MesurerPaires(nombreThreads, OPERATIONS_TOTALES,
+                [&](int v) {
+                    std::lock_guard<std::mutex> garde(verrou);
+                    InsererDebut(liste, v);
+                },
+                [&]() {
+                    std::lock_guard<std::mutex> garde(verrou);
+                    int valeur = liste->tete != nullptr ? liste->tete->donnee : 0;
+                    SupprimerDebut(liste);
+                    return valeur;
+                });
+            Detruire(liste);
+            return ms;
+        },
+        [](int nombreThreads) {
+            PileConcurrente* pile = AllocatePileConcurrente();
+            for (int i = 0; i < 64; i++) {
+                InsererDebut(pile, i);
+            }
+            double ms = nkentseu::bench::MesurerPaires(nombreThreads, OPERATIONS_TOTALES,
+                [&](int v) { InsererDebut(pile, v); },
+                [&]() {
+                    int valeur = 0;
+                    SupprimerDebut(pile, &valeur);
+                    return valeur;
+                });
+            Detruire(pile);
+            return ms;
+        });
+}
@@ -0,0 +1,99 @@
+#include "Bench.h"
+
+#include "List/ListD.h"
+#include "List/ListRcu.h"
+
+#include <atomic>
+#include <chrono>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    const int LECTURES_TOTALES = 1 << 16;
+    const int ENTREES = 256;
+
+    /**
+     * @brief Table de routage : lectures par position, une mise à jour toutes les millisecondes
+     */
+    template <typename Lire, typename MettreAJour>
+    double MesurerRoutage(int nombreLecteurs, Lire lire, MettreAJour mettreAJour) {
+        return nkentseu::bench::MesurerMs([&]() {
+            std::atomic<bool> arret(false);
+            std::thread ecrivain([&]() {
+                int tour = 0;
+                while (!arret.load(std::memory_order_relaxed)) {
+                    mettreAJour(tour++);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            });
+
+            int parLecteur = LECTURES_TOTALES / nombreLecteurs;
+            std::vector<std::thread> lecteurs;
+            for (int t = 0; t < nombreLecteurs; t++) {
+                lecteurs.emplace_back([&, t]() {
+                    long long somme = 0;
+                    for (int i = 0; i < parLecteur; i++) {
+                        somme += lire((t * 131 + i * 17) % ENTREES);
+                    }
+                    nkentseu::bench::Consommer(somme);
+                });
+            }
+            for (std::thread& lecteur : lecteurs) {
+                lecteur.join();
+            }
+            arret.store(true);
+            ecrivain.join();
+        }, 3);
+    }
+
+} // namespace
+
+BENCH_CASE(RcuLecteurs) {
+    for (int nombreLecteurs : nkentseu::bench::ComptesThreads()) {
+        ListeDouble* liste = AllocateDouble();
+        for (int i = 0; i < ENTREES; i++) {
+            InsererFin(liste, i);
+        }
+        std::shared_mutex verrou;
+        double reference = MesurerRoutage(nombreLecteurs,
+            [&](int position) {
+                std::shared_lock<std::shared_mutex> garde(verrou);
+                NoeudD* noeud = ObtenirNoeudPosition(liste, position);
+                return noeud != nullptr ? noeud->donnee : 0;
+            },
+            [&](int tour) {
+                std::unique_lock<std::shared_mutex> garde(verrou);
+                NoeudD* noeud = ObtenirNoeudPosition(liste, tour % ENTREES);
+                InsererApres(liste, noeud, tour);
+                SupprimerNoeud(liste, noeud);
+            });
+        Detruire(liste);
+        nkentseu::bench::Rapporter("shared_mutex, " + std::to_string(nombreLecteurs) + " lecteurs", reference);
+
+        ListeDoubleRcu* rcu = AllocateDoubleRcu();
+        for (int i = 0; i < ENTREES; i++) {
+            InsererFin(rcu, i);
+        }
+        double ms = MesurerRoutage(nombreLecteurs,
+            [&](int position) {
+                EntrerLecture(rcu);
+                NoeudD* noeud = ObtenirNoeudPosition(rcu, position);
+                int valeur = noeud != nullptr ? noeud->donnee : 0;
+                SortirLecture(rcu);
+                return valeur;
+            },
+            [&](int tour) {
+                EntrerLecture(rcu);
+                NoeudD* noeud = ObtenirNoeudPosition(rcu, tour % ENTREES);
+                SortirLecture(rcu);
+                // Seul cet écrivain supprime : noeud reste valide hors section
+                InsererApres(rcu, noeud, tour);
+                SupprimerNoeud(rcu, noeud);
+            });
+        Detruire(rcu);
+        nkentseu::bench::Rapporter("RCU, " + std::to_string(nombreLecteurs) + " lecteurs", ms, reference);
+    }
+}
@@ -0,0 +1,129 @@
+#include "Bench.h"
+
+#include "List/ListS.h"
+#include "List/ListSIMD.h"
+
+#include <cstdlib>
+
+namespace {
+    const int nombreNoeuds = 1 << 22;
+    const int periode = 1000;       // valeurs 0..periode-1 répétées
+    const int cible = 7;            // une occurrence par période
+    const int proche = 200;         // première occurrence, au-delà des trous laissés dans le tas
+}
+
+/**
+ * @brief Recherche nœud par nœud, sans série ni moteur vectoriel
+ */
+static NoeudS* ChercherScalaire(const ListeSimple* liste, int valeur) {
+    for (NoeudS* courant = liste->tete; courant != nullptr; courant = courant->suivant) {
+        if (courant->donnee == valeur) {
+            return courant;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Même contrat que RechercherToutesOccurrences : compte, puis remplit
+ */
+static NoeudS** CollecterScalaire(const ListeSimple* liste, int valeur, int* nombre) {
+    *nombre = 0;
+    for (NoeudS* courant = liste->tete; courant != nullptr; courant = courant->suivant) {
+        *nombre += (courant->donnee == valeur);
+    }
+    NoeudS** resultats = (NoeudS**)malloc((*nombre + 1) * sizeof(NoeudS*));
+    int index = 0;
+    for (NoeudS* courant = liste->tete; courant != nullptr; courant = courant->suivant) {
+        if (courant->donnee == valeur) {
+            resultats[index++] = courant;
+        }
+    }
+    resultats[index] = nullptr;
+    return resultats;
+}
+
+static int SupprimerScalaire(ListeSimple* liste, int valeur) {
+    int compteur = 0;
+    NoeudS* precedent = nullptr;
+    NoeudS* courant = liste->tete;
+    while (courant != nullptr) {
+        NoeudS* suivant = courant->suivant;
+        if (courant->donnee == valeur) {
+            if (precedent == nullptr) {
+                liste->tete = suivant;
+            } else {
+                precedent->suivant = suivant;
+            }
+            if (courant == liste->queue) {
+                liste->queue = precedent;
+            }
+            free(courant);
+            liste->taille--;
+            compteur++;
+        } else {
+            precedent = courant;
+        }
+        courant = suivant;
+    }
+    return compteur;
+}
+
+BENCH_CASE(RechercheVectorielle) {
+    // Construite d'un trait : les nœuds forment de longues séries à pas constant
+    ListeSimple* liste = AllocateSimple();
+    for (int i = 0; i < nombreNoeuds; i++) {
+        InsererFin(liste, i % periode);
+    }
+
+    std::printf("  (niveau actif : %d, tronçon : %d nœuds)\n", (int)NiveauSIMDActif(), LISTE_SIMD_TRONCON);
+
+    double reference = nkentseu::bench::MesurerMs([&]() {
+        nkentseu::bench::Consommer(ChercherScalaire(liste, proche));
+    });
+    nkentseu::bench::Rapporter("Proche de la tête, parcours scalaire", reference);
+    double ms = nkentseu::bench::MesurerMs([&]() {
+        nkentseu::bench::Consommer(RechercherValeur(liste, proche));
+    });
+    nkentseu::bench::Rapporter("Proche de la tête, RechercherValeur", ms, reference);
+
+    reference = nkentseu::bench::MesurerMs([&]() {
+        nkentseu::bench::Consommer(ChercherScalaire(liste, -1));
+    });
+    nkentseu::bench::Rapporter("Absente, parcours scalaire", reference);
+    ms = nkentseu::bench::MesurerMs([&]() {
+        nkentseu::bench::Consommer(RechercherValeur(liste, -1));
+    });
+    nkentseu::bench::Rapporter("Absente, RechercherValeur", ms, reference);
+
+    reference = nkentseu::bench::MesurerMs([&]() {
+        int nombre = 0;
+        NoeudS** resultats = CollecterScalaire(liste, cible, &nombre);
+        nkentseu::bench::Consommer(nombre);
+        free(resultats);
+    });
+    nkentseu::bench::Rapporter("Toutes (1/" + std::to_string(periode) + "), parcours scalaire", reference);
+    ms = nkentseu::bench::MesurerMs([&]() {
+        int nombre = 0;
+        NoeudS** resultats = RechercherToutesOccurrences(liste, cible, &nombre);
+        nkentseu::bench::Consommer(nombre);
+        free(resultats);
+    });
+    nkentseu::bench::Rapporter("Toutes, RechercherToutesOccurrences", ms, reference);
+
+    // La suppression consomme la liste : chaque mesure part d'une copie fraîche
+    reference = nkentseu::bench::MesurerMs([&]() {
+        ListeSimple* copie = Copier(liste);
+        nkentseu::bench::Consommer(SupprimerScalaire(copie, cible));
+        Detruire(copie);
+    }, 3);
+    nkentseu::bench::Rapporter("Copier + suppression scalaire", reference);
+    ms = nkentseu::bench::MesurerMs([&]() {
+        ListeSimple* copie = Copier(liste);
+        nkentseu::bench::Consommer(SupprimerToutesOccurrences(copie, cible));
+        Detruire(copie);
+    }, 3);
+    nkentseu::bench::Rapporter("Copier + SupprimerToutesOccurrences", ms, reference);
+
+    Detruire(liste);
+}
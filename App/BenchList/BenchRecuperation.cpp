@@ -0,0 +1,90 @@
+#include "Bench.h"
+
+#include "List/ListS.h"
+#include "List/ListRecuperation.h"
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    const int RECHERCHES_TOTALES = 1 << 15;
+    const int CLES = 512;
+
+    /**
+     * @brief Des lecteurs cherchent pendant qu'un écrivain supprime et réinsère en continu
+     */
+    template <typename Rechercher, typename Remplacer>
+    double MesurerLecteurs(int nombreLecteurs, Rechercher rechercher, Remplacer remplacer) {
+        return nkentseu::bench::MesurerMs([&]() {
+            std::atomic<bool> arret(false);
+            std::thread ecrivain([&]() {
+                int cle = 1;
+                while (!arret.load(std::memory_order_relaxed)) {
+                    remplacer(cle);
+                    cle = (cle + 2) % CLES;
+                }
+            });
+
+            int parLecteur = RECHERCHES_TOTALES / nombreLecteurs;
+            std::vector<std::thread> lecteurs;
+            for (int t = 0; t < nombreLecteurs; t++) {
+                lecteurs.emplace_back([&, t]() {
+                    long long trouves = 0;
+                    for (int i = 0; i < parLecteur; i++) {
+                        trouves += rechercher((t * 97 + i * 31) % CLES) ? 1 : 0;
+                    }
+                    nkentseu::bench::Consommer(trouves);
+                });
+            }
+            for (std::thread& lecteur : lecteurs) {
+                lecteur.join();
+            }
+            arret.store(true);
+            ecrivain.join();
+        }, 3);
+    }
+
+} // namespace
+
+BENCH_CASE(LecteursProteges) {
+    for (int nombreLecteurs : nkentseu::bench::ComptesThreads()) {
+        ListeSimple* liste = AllocateSimple();
+        for (int cle = 0; cle < CLES; cle++) {
+            InsererFin(liste, cle);
+        }
+        std::shared_mutex verrou;
+        double reference = MesurerLecteurs(nombreLecteurs,
+            [&](int cle) {
+                std::shared_lock<std::shared_mutex> garde(verrou);
+                return RechercherValeur(liste, cle) != nullptr;
+            },
+            [&](int cle) {
+                std::unique_lock<std::shared_mutex> garde(verrou);
+                SupprimerValeur(liste, cle);
+                InsererFin(liste, cle);
+            });
+        Detruire(liste);
+        nkentseu::bench::Rapporter("shared_mutex, " + std::to_string(nombreLecteurs) + " lecteurs", reference);
+
+        liste = AllocateSimple();
+        for (int cle = 0; cle < CLES; cle++) {
+            InsererFinPublie(liste, cle);
+        }
+        std::mutex verrouEcrivain;
+        double ms = MesurerLecteurs(nombreLecteurs,
+            [&](int cle) { return RechercherValeurProtegee(liste, cle); },
+            [&](int cle) {
+                std::lock_guard<std::mutex> garde(verrouEcrivain);
+                SupprimerValeurDifferee(liste, cle);
+                InsererFinPublie(liste, cle);
+            });
+        Detruire(liste);
+        nkentseu::bench::Rapporter("pointeurs de danger, " + std::to_string(nombreLecteurs) + " lecteurs", ms,
+                                   reference);
+    }
+}
@@ -0,0 +1,72 @@
+#include "Bench.h"
+
+#include "List/ListS.h"
+#include "List/ListSegmentee.h"
+
+#include <string>
+#include <thread>
+
+namespace {
+
+    const int ELEMENTS = 1 << 22;
+    const int ACCES = 32;
+
+    ListeSimpleSegmentee* ConstruireSegmentee() {
+        ListeSimple* source = AllocateSimple();
+        for (int i = 0; i < ELEMENTS; i++) {
+            InsererFin(source, i & 1023);
+        }
+        ListeSimpleSegmentee* liste = Segmenter(source);
+        Detruire(source);
+        return liste;
+    }
+
+} // namespace
+
+BENCH_CASE(ParcoursParallele) {
+    ListeSimpleSegmentee* liste = ConstruireSegmentee();
+
+    double reference = nkentseu::bench::MesurerMs([&]() {
+        long long somme = 0;
+        for (NoeudS* noeud = liste->liste.tete; noeud != nullptr; noeud = noeud->suivant) {
+            somme += noeud->donnee;
+        }
+        nkentseu::bench::Consommer(somme);
+    }, 5);
+    nkentseu::bench::Rapporter("somme, parcours depuis la tête", reference);
+
+    int coeurs = (int)std::thread::hardware_concurrency();
+    for (int threads = 1; threads <= (coeurs > 8 ? coeurs : 8); threads *= 2) {
+        double ms = nkentseu::bench::MesurerMs([&]() {
+            nkentseu::bench::Consommer(ParcourirParallele(liste, threads, 0LL,
+                [](long long& somme, int valeur) { somme += valeur; },
+                [](long long& somme, const long long& partiel) { somme += partiel; }));
+        }, 5);
+        nkentseu::bench::Rapporter("somme, " + std::to_string(threads) + " threads sur segments", ms, reference);
+    }
+    Detruire(liste);
+}
+
+BENCH_CASE(PositionSegmentee) {
+    ListeSimpleSegmentee* liste = ConstruireSegmentee();
+
+    // Même chaîne de nœuds : seule la recherche de la position change
+    double reference = nkentseu::bench::MesurerMs([&]() {
+        long long somme = 0;
+        for (int i = 0; i < ACCES; i++) {
+            somme += ObtenirNoeudPosition(&liste->liste, (int)((i * 2654435761u) % ELEMENTS))->donnee;
+        }
+        nkentseu::bench::Consommer(somme);
+    }, 3);
+    nkentseu::bench::Rapporter("ObtenirNoeudPosition, ListeSimple", reference);
+
+    double ms = nkentseu::bench::MesurerMs([&]() {
+        long long somme = 0;
+        for (int i = 0; i < ACCES; i++) {
+            somme += ObtenirNoeudPosition(liste, (int)((i * 2654435761u) % ELEMENTS))->donnee;
+        }
+        nkentseu::bench::Consommer(somme);
+    }, 3);
+    nkentseu::bench::Rapporter("ObtenirNoeudPosition, segments", ms, reference);
+    Detruire(liste);
+}
@@ -0,0 +1,61 @@
+#include "Bench.h"
+
+#include "List/ListS.h"
+#include "List/ListD.h"
+#include "List/ListStatique.h"
+
+#include <chrono>
+#include <vector>
+
+namespace {
+
+    const int OPERATIONS = 1 << 20;
+    const int PROFONDEUR = 256;
+
+    /**
+     * @brief Chronomètre chaque opération d'une file tenue à PROFONDEUR éléments
+     */
+    template <typename Enfiler, typename Defiler>
+    std::vector<double> MesurerFile(Enfiler enfiler, Defiler defiler) {
+        std::vector<double> durees;
+        durees.reserve(2 * OPERATIONS);
+        for (int i = 0; i < PROFONDEUR; i++) {
+            enfiler(i);
+        }
+        for (int i = 0; i < OPERATIONS; i++) {
+            auto debut = std::chrono::steady_clock::now();
+            enfiler(i);
+            auto milieu = std::chrono::steady_clock::now();
+            defiler();
+            auto fin = std::chrono::steady_clock::now();
+            durees.push_back(std::chrono::duration<double, std::nano>(milieu - debut).count());
+            durees.push_back(std::chrono::duration<double, std::nano>(fin - milieu).count());
+        }
+        return durees;
+    }
+
+} // namespace
+
+BENCH_CASE(StatiqueLatence) {
+    // InsererFin + SupprimerDebut : un malloc et un free par paire d'opérations
+    ListeSimple* simple = AllocateSimple();
+    std::vector<double> durees = MesurerFile([&](int v) { InsererFin(simple, v); },
+                                             [&]() { SupprimerDebut(simple); });
+    nkentseu::bench::RapporterLatences("ListeSimple", durees);
+    Detruire(simple);
+
+    static ListeStatique<PROFONDEUR + 1> statique;
+    Initialiser(&statique);
+    durees = MesurerFile([&](int v) { InsererFin(&statique, v); }, [&]() { SupprimerDebut(&statique); });
+    nkentseu::bench::RapporterLatences("ListeStatique<257>", durees);
+
+    ListeDouble* listeDouble = AllocateDouble();
+    durees = MesurerFile([&](int v) { InsererFin(listeDouble, v); }, [&]() { SupprimerFin(listeDouble); });
+    nkentseu::bench::RapporterLatences("ListeDouble (pile)", durees);
+    Detruire(listeDouble);
+
+    static ListeDoubleStatique<PROFONDEUR + 1> doubleStatique;
+    Initialiser(&doubleStatique);
+    durees = MesurerFile([&](int v) { InsererFin(&doubleStatique, v); }, [&]() { SupprimerFin(&doubleStatique); });
+    nkentseu::bench::RapporterLatences("ListeDoubleStatique<257> (pile)", durees);
+}
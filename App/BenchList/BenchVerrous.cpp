@@ -0,0 +1,80 @@
+#include "Bench.h"
+
+#include "List/ListD.h"
+#include "List/ListVerrous.h"
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    const int OPERATIONS_TOTALES = 1 << 14;
+    const int ELEMENTS = 1024;
+
+    /**
+     * @brief Écrivains qui insèrent puis suppriment à des positions pseudo-aléatoires (taille stable)
+     */
+    template <typename Inserer, typename Supprimer>
+    double MesurerEditions(int nombreEcrivains, Inserer inserer, Supprimer supprimer) {
+        return nkentseu::bench::MesurerMs([&]() {
+            int parEcrivain = OPERATIONS_TOTALES / nombreEcrivains;
+            std::vector<std::thread> ecrivains;
+            for (int t = 0; t < nombreEcrivains; t++) {
+                ecrivains.emplace_back([&, t]() {
+                    unsigned int graine = 2654435761u * (t + 1);
+                    for (int i = 0; i < parEcrivain; i += 2) {
+                        graine = graine * 1103515245u + 12345u;
+                        inserer((int)((graine >> 8) % ELEMENTS), i);
+                        graine = graine * 1103515245u + 12345u;
+                        supprimer((int)((graine >> 8) % ELEMENTS));
+                    }
+                });
+            }
+            for (std::thread& ecrivain : ecrivains) {
+                ecrivain.join();
+            }
+        }, 3);
+    }
+
+    template <ModeVerrous Mode>
+    double MesurerVerrous(int nombreEcrivains) {
+        ListeDoubleVerrous* liste = AllocateDoubleVerrous(Mode);
+        for (int i = 0; i < ELEMENTS; i++) {
+            InsererPosition(liste, i, i);
+        }
+        double ms = MesurerEditions(nombreEcrivains,
+            [&](int position, int valeur) { InsererPosition(liste, position, valeur); },
+            [&](int position) { SupprimerPosition(liste, position); });
+        Detruire(liste);
+        return ms;
+    }
+
+} // namespace
+
+BENCH_CASE(VerrousFins) {
+    for (int nombreEcrivains : nkentseu::bench::ComptesThreads()) {
+        ListeDouble* liste = AllocateDouble();
+        for (int i = 0; i < ELEMENTS; i++) {
+            InsererFin(liste, i);
+        }
+        std::mutex verrou;
+        double reference = MesurerEditions(nombreEcrivains,
+            [&](int position, int valeur) {
+                std::lock_guard<std::mutex> garde(verrou);
+                InsererPosition(liste, position, valeur);
+            },
+            [&](int position) {
+                std::lock_guard<std::mutex> garde(verrou);
+                SupprimerPosition(liste, position);
+            });
+        Detruire(liste);
+        std::string suffixe = ", " + std::to_string(nombreEcrivains) + " écrivains";
+        nkentseu::bench::Rapporter("mutex global" + suffixe, reference);
+        nkentseu::bench::Rapporter("verrous couplés" + suffixe, MesurerVerrous<VERROUS_COUPLAGE>(nombreEcrivains),
+                                   reference);
+        nkentseu::bench::Rapporter("verrous optimistes" + suffixe,
+                                   MesurerVerrous<VERROUS_OPTIMISTE>(nombreEcrivains), reference);
+    }
+}
@@ -0,0 +1,124 @@
+#include "Bench.h"
+
+#include "List/ListD.h"
+#include "List/ListVol.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    const int PROFONDEUR = 25;
+    const int OUVRIERS_MAX = 8;
+
+    /**
+     * @brief File de travail de référence : une ListeDouble sous mutex
+     */
+    struct FileVerrouillee {
+        std::mutex verrou;
+        ListeDouble liste = CreerDouble();
+    };
+
+    bool InsererFin(FileVerrouillee* file, int tache) {
+        std::lock_guard<std::mutex> garde(file->verrou);
+        InsererFin(&file->liste, tache);
+        return true;
+    }
+
+    bool SupprimerFin(FileVerrouillee* file, int* tache) {
+        std::lock_guard<std::mutex> garde(file->verrou);
+        if (file->liste.queue == nullptr) {
+            return false;
+        }
+        *tache = file->liste.queue->donnee;
+        return SupprimerFin(&file->liste);
+    }
+
+    bool Voler(FileVerrouillee* file, int* tache) {
+        std::lock_guard<std::mutex> garde(file->verrou);
+        if (file->liste.tete == nullptr) {
+            return false;
+        }
+        *tache = file->liste.tete->donnee;
+        return SupprimerDebut(&file->liste);
+    }
+
+    /**
+     * @brief Fork-join récursif façon Fibonacci : la tâche n engendre n-1 et n-2, les feuilles sont comptées
+     *
+     * Chaque ouvrier dépile sa propre file et, quand elle est vide, vole
+     * les autres à tour de rôle ; le travail s'arrête quand plus aucune
+     * tâche n'est en attente.
+     */
+    template <typename File>
+    double MesurerForkJoin(std::vector<File*>& files) {
+        int ouvriers = (int)files.size();
+        return nkentseu::bench::MesurerMs([&]() {
+            std::atomic<long long> enAttente(1);
+            std::atomic<long long> feuilles(0);
+            InsererFin(files[0], PROFONDEUR);
+            std::vector<std::thread> threads;
+            for (int o = 0; o < ouvriers; o++) {
+                threads.emplace_back([&, o]() {
+                    long long compte = 0;
+                    int victime = o;
+                    int tache;
+                    while (enAttente.load(std::memory_order_acquire) > 0) {
+                        bool trouvee = SupprimerFin(files[o], &tache);
+                        for (int essai = 1; !trouvee && essai < ouvriers; essai++) {
+                            victime = (victime + 1) % ouvriers;
+                            trouvee = victime != o && Voler(files[victime], &tache);
+                        }
+                        if (!trouvee) {
+                            std::this_thread::yield();
+                            continue;
+                        }
+                        if (tache < 2) {
+                            compte++;
+                            enAttente.fetch_sub(1, std::memory_order_acq_rel);
+                        } else {
+                            enAttente.fetch_add(1, std::memory_order_relaxed);
+                            InsererFin(files[o], tache - 1);
+                            InsererFin(files[o], tache - 2);
+                        }
+                    }
+                    feuilles.fetch_add(compte, std::memory_order_relaxed);
+                });
+            }
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+            nkentseu::bench::Consommer(feuilles.load());
+        }, 3);
+    }
+
+} // namespace
+
+BENCH_CASE(VolForkJoin) {
+    for (int ouvriers = 1; ouvriers <= OUVRIERS_MAX; ouvriers *= 2) {
+        std::vector<FileVerrouillee*> verrouillees;
+        for (int o = 0; o < ouvriers; o++) {
+            verrouillees.push_back(new FileVerrouillee);
+        }
+        double reference = MesurerForkJoin(verrouillees);
+        for (FileVerrouillee* file : verrouillees) {
+            Nettoyer(&file->liste);
+            delete file;
+        }
+        std::string suffixe = ", " + std::to_string(ouvriers) + " ouvriers";
+        nkentseu::bench::Rapporter("ListeDouble + mutex" + suffixe, reference);
+
+        std::vector<DequeVol*> deques;
+        for (int o = 0; o < ouvriers; o++) {
+            deques.push_back(AllocateDequeVol());
+        }
+        double ms = MesurerForkJoin(deques);
+        for (DequeVol* deque : deques) {
+            Detruire(deque);
+        }
+        nkentseu::bench::Rapporter("Chase-Lev par tranches" + suffixe, ms, reference);
+    }
+}
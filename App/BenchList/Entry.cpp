@@ -0,0 +1,33 @@
+#include "Bench.h"
+
+#include <cstring>
+
+int main(int argc, char* argv[]) {
+    std::printf("Mesures de performance des listes chaînées\n\n");
+
+    int executes = 0;
+    for (const nkentseu::bench::BenchCase& cas : nkentseu::bench::Registre()) {
+        bool selectionne = (argc <= 1);
+        for (int i = 1; i < argc && !selectionne; i++) {
+            selectionne = (std::strcmp(argv[i], cas.nom.c_str()) == 0);
+        }
+        if (!selectionne) {
+            continue;
+        }
+
+        std::printf("== %s\n", cas.nom.c_str());
+        cas.fonction();
+        std::printf("\n");
+        executes++;
+    }
+
+    if (executes == 0) {
+        std::printf("Aucun benchmark ne correspond. Disponibles :\n");
+        for (const nkentseu::bench::BenchCase& cas : nkentseu::bench::Registre()) {
+            std::printf("  %s\n", cas.nom.c_str());
+        }
+        return 1;
+    }
+
+    return 0;
+}
@@ -1,4 +1,14 @@
 #include "List/ListD.h"
+#include "List/ListSIMD.h"
+#include "List/ListIterateurs.h"
+#include "List/ListGenerique.h"
+#include "List/ListIntrusive.h"
+#include "List/ListStatique.h"
+#include "List/ListRecuperation.h"
+#include "List/ListRcu.h"
+#include "List/ListVerrous.h"
+#include "List/ListVol.h"
+#include "List/ListSegmentee.h"
 
 #include "Unitest/TestRunner.h"
 #include "Unitest/ConsoleReporter.h"
@@ -6,7 +16,16 @@
 #include "Unitest/TestCase.h"
 #include "Unitest/Assertions.h"
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <numeric>
+#include <ranges>
 #include <string>
+#include <thread>
 #include <vector>
 
 // ============================================================================
@@ -925,4 +944,1035 @@ TEST_CASE(TestGestionMemoireDouble) {
         
         Detruire(liste);
     }
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// TESTS DE L'INVERSION LOGIQUE
+// ============================================================================
+
+TEST_CASE(TestInverserLogiqueDouble) {
+    ListeDouble liste;
+    Initialiser(&liste);
+    for (int i = 1; i <= 5; i++) {
+        InsererFin(&liste, i * 10);
+    }
+
+    NoeudD* ancienneTete = liste.tete;
+    InverserLogique(&liste);
+    ASSERT_TRUE(liste.estInversee, "Le drapeau de sens devrait être levé");
+    ASSERT_EQUAL(50, liste.tete->donnee, "Tête après inversion logique incorrecte");
+    ASSERT_EQUAL(10, liste.queue->donnee, "Queue après inversion logique incorrecte");
+    ASSERT_EQUAL(ancienneTete, liste.queue, "Aucun nœud ne devrait être recréé");
+
+    const ListeDouble* lecture = &liste;
+    ASSERT_EQUAL(std::string("ListeDouble[Noeud(50) <-> Noeud(40) <-> Noeud(30) <-> Noeud(20) <-> Noeud(10)]"),
+                 ToString(lecture), "Parcours dans le sens logique incorrect");
+    ASSERT_EQUAL(40, ObtenirNoeudPosition(&liste, 1)->donnee, "Position 1 incorrecte");
+    ASSERT_EQUAL(20, ObtenirNoeudPosition(&liste, 3)->donnee, "Position 3 incorrecte");
+    ASSERT_EQUAL(40, ObtenirNoeudPositionInverse(&liste, 3)->donnee, "Position inverse 3 incorrecte");
+
+    // Double inversion : retour à l'état initial
+    InverserLogique(&liste);
+    ASSERT_FALSE(liste.estInversee, "Le drapeau devrait être retombé");
+    ASSERT_EQUAL(10, liste.tete->donnee, "Tête après double inversion incorrecte");
+    ASSERT_NULL(liste.tete->precedent, "Précédent de la tête devrait être NULL");
+
+    Nettoyer(&liste);
+}
+
+TEST_CASE(TestModificationsApresInverserLogique) {
+    ListeDouble liste;
+    Initialiser(&liste);
+    InsererFin(&liste, 1);
+    InsererFin(&liste, 2);
+    InsererFin(&liste, 3);
+    InverserLogique(&liste);
+
+    InsererDebut(&liste, 4);
+    InsererFin(&liste, 0);
+    ASSERT_TRUE(InsererPosition(&liste, 2, 99), "Insertion en position 2 devrait réussir");
+    ASSERT_TRUE(InsererApres(&liste, RechercherValeur(&liste, 2), 7), "Insertion après 2 devrait réussir");
+
+    const ListeDouble* lecture = &liste;
+    ASSERT_EQUAL(std::string("ListeDouble[Noeud(4) <-> Noeud(3) <-> Noeud(99) <-> Noeud(2) <-> Noeud(7) <-> Noeud(1) <-> Noeud(0)]"),
+                 ToString(lecture), "Insertions dans le sens logique incorrectes");
+
+    ASSERT_TRUE(SupprimerDebut(&liste), "Suppression en tête devrait réussir");
+    ASSERT_TRUE(SupprimerFin(&liste), "Suppression en queue devrait réussir");
+    ASSERT_TRUE(SupprimerNoeud(&liste, RechercherValeur(&liste, 99)), "Suppression de 99 devrait réussir");
+    ASSERT_EQUAL(std::string("ListeDouble[Noeud(3) <-> Noeud(2) <-> Noeud(7) <-> Noeud(1)]"),
+                 ToString(lecture), "Suppressions dans le sens logique incorrectes");
+
+    Trier(&liste);
+    ASSERT_FALSE(liste.estInversee, "Trier devrait matérialiser le sens");
+    ASSERT_EQUAL(std::string("ListeDouble[Noeud(1) <-> Noeud(2) <-> Noeud(3) <-> Noeud(7)]"),
+                 ToString(lecture), "Tri après inversion logique incorrect");
+
+    Nettoyer(&liste);
+}
+
+TEST_CASE(TestMaterialiserDouble) {
+    ListeDouble liste;
+    Initialiser(&liste);
+    for (int i = 1; i <= 4; i++) {
+        InsererFin(&liste, i);
+    }
+    RendreCirculaire(&liste);
+
+    InverserLogique(&liste);
+    Materialiser(&liste);
+    ASSERT_FALSE(liste.estInversee, "Le drapeau devrait être retombé");
+    ASSERT_EQUAL(4, liste.tete->donnee, "Tête après matérialisation incorrecte");
+    ASSERT_EQUAL(3, liste.tete->suivant->donnee, "Lien suivant physique incorrect");
+    ASSERT_EQUAL(liste.queue, liste.tete->precedent, "La boucle circulaire devrait être conservée");
+    ASSERT_EQUAL(liste.tete, liste.queue->suivant, "La boucle circulaire devrait être conservée");
+
+    RendreLineaire(&liste);
+    ASSERT_NULL(liste.tete->precedent, "Précédent de la tête devrait être NULL");
+    ASSERT_NULL(liste.queue->suivant, "Suivant de la queue devrait être NULL");
+
+    Nettoyer(&liste);
+}
+
+// ============================================================================
+// TESTS DES ROTATIONS
+// ============================================================================
+
+TEST_CASE(TestRotationDoubleModulo) {
+    ListeDouble liste;
+    Initialiser(&liste);
+    for (int i = 1; i <= 6; i++) {
+        InsererFin(&liste, i);
+    }
+    const ListeDouble* lecture = &liste;
+
+    RotationGauche(&liste, 5); // plus court par la queue
+    ASSERT_EQUAL(std::string("ListeDouble[Noeud(6) <-> Noeud(1) <-> Noeud(2) <-> Noeud(3) <-> Noeud(4) <-> Noeud(5)]"),
+                 ToString(lecture), "Rotation gauche de 5 incorrecte");
+    ASSERT_NULL(liste.tete->precedent, "Précédent de la tête devrait être NULL");
+    ASSERT_NULL(liste.queue->suivant, "Suivant de la queue devrait être NULL");
+
+    RotationDroite(&liste, 13); // 13 mod 6 = 1
+    ASSERT_EQUAL(5, liste.tete->donnee, "Rotation droite modulo taille incorrecte");
+    RotationDroite(&liste, -2);
+    ASSERT_EQUAL(1, liste.tete->donnee, "Un décalage négatif doit tourner vers la gauche");
+
+    InverserLogique(&liste);
+    RotationGauche(&liste, 1);
+    ASSERT_EQUAL(std::string("ListeDouble[Noeud(5) <-> Noeud(4) <-> Noeud(3) <-> Noeud(2) <-> Noeud(1) <-> Noeud(6)]"),
+                 ToString(lecture), "Rotation après inversion logique incorrecte");
+
+    Nettoyer(&liste);
+}
+
+TEST_CASE(TestRotationDoubleCirculaire) {
+    ListeDouble liste;
+    Initialiser(&liste);
+    for (int i = 1; i <= 4; i++) {
+        InsererFin(&liste, i);
+    }
+    RendreCirculaire(&liste);
+
+    NoeudD* premier = liste.tete;
+    RotationGauche(&liste, 3);
+    ASSERT_EQUAL(4, liste.tete->donnee, "Tête après rotation circulaire incorrecte");
+    ASSERT_EQUAL(premier, liste.tete->suivant, "Les liens ne doivent pas changer");
+    ASSERT_EQUAL(liste.queue, liste.tete->precedent, "L'anneau doit rester fermé");
+    ASSERT_EQUAL(3, liste.queue->donnee, "Queue après rotation circulaire incorrecte");
+
+    Nettoyer(&liste);
+}
+
+// ============================================================================
+// TESTS DE L'ANALYSE DE CYCLE
+// ============================================================================
+
+TEST_CASE(TestAnalyserCycleDouble) {
+    ListeDouble liste;
+    Initialiser(&liste);
+    for (int i = 0; i < 6; i++) {
+        InsererFin(&liste, i);
+    }
+
+    AnalyseCycleD saine = AnalyserCycle(&liste);
+    ASSERT_FALSE(saine.present, "Une liste linéaire saine ne boucle pas");
+    ASSERT_EQUAL(6, saine.suivant.longueurQueue, "Chaîne suivant complète");
+    ASSERT_EQUAL(6, saine.precedent.longueurQueue, "Chaîne precedent complète");
+
+    RendreCirculaire(&liste);
+    AnalyseCycleD circulaire = AnalyserCycle(&liste);
+    ASSERT_TRUE(circulaire.suivant.present, "La chaîne suivant boucle");
+    ASSERT_EQUAL(liste.tete, circulaire.suivant.entree, "Entrée avant : la tête");
+    ASSERT_EQUAL(liste.queue, circulaire.precedent.entree, "Entrée arrière : la queue");
+    ASSERT_EQUAL(6, circulaire.precedent.longueurCycle, "Le cycle arrière couvre la liste");
+    RendreLineaire(&liste);
+
+    // Corruption du seul lien precedent du nœud 1 : il reboucle sur le nœud 4
+    NoeudD* noeud1 = ObtenirNoeudPosition(&liste, 1);
+    NoeudD* noeud4 = ObtenirNoeudPosition(&liste, 4);
+    noeud1->precedent = noeud4;
+    ASSERT_TRUE(ContientCycle(&liste), "Le cycle arrière devrait être détecté");
+    AnalyseCycleD corrompue = AnalyserCycle(&liste);
+    ASSERT_FALSE(corrompue.suivant.present, "La chaîne suivant reste saine");
+    ASSERT_TRUE(corrompue.precedent.present, "La chaîne precedent boucle");
+    ASSERT_EQUAL(noeud4, corrompue.precedent.entree, "L'entrée arrière devrait être le nœud 4");
+    ASSERT_EQUAL(4, corrompue.precedent.longueurCycle, "Le cycle arrière compte 4 nœuds");
+    ASSERT_EQUAL(1, corrompue.precedent.longueurQueue, "Seule la queue précède l'entrée");
+    noeud1->precedent = liste.tete;
+
+    // Le sens logique est respecté après InverserLogique
+    InverserLogique(&liste);
+    AnalyseCycleD inversee = AnalyserCycle(&liste);
+    ASSERT_FALSE(inversee.present, "L'inversion logique ne crée pas de cycle");
+    ASSERT_EQUAL(6, inversee.suivant.longueurQueue, "Chaîne logique complète après inversion");
+
+    Nettoyer(&liste);
+}
+
+// ============================================================================
+// TESTS DU MOTEUR DE RECHERCHE VECTORIEL
+// ============================================================================
+
+TEST_CASE(TestSIMDSerieDouble) {
+    // Nœuds contigus : la série est lue par suivant, puis par precedent après inversion
+    std::vector<NoeudD> noeuds(40);
+    for (int i = 0; i < 40; i++) {
+        noeuds[i].donnee = i % 4;
+        noeuds[i].precedent = (i > 0) ? &noeuds[i - 1] : nullptr;
+        noeuds[i].suivant = (i + 1 < 40) ? &noeuds[i + 1] : nullptr;
+    }
+
+    ListeDouble liste;
+    Initialiser(&liste);
+    liste.tete = &noeuds[0];
+    liste.queue = &noeuds[39];
+    liste.taille = 40;
+
+    for (int niveau = SIMD_SCALAIRE; niveau <= NiveauSIMDDisponible(); niveau++) {
+        ForcerNiveauSIMD((NiveauSIMD)niveau);
+        std::string contexte = " (niveau " + std::to_string(niveau) + ")";
+
+        ASSERT_EQUAL(&noeuds[3], RechercherValeur(&liste, 3), "Première occurrence incorrecte" + contexte);
+        int count = 0;
+        NoeudD** occurrences = RechercherToutesOccurrences(&liste, 2, &count);
+        ASSERT_EQUAL(10, count, "Nombre d'occurrences incorrect" + contexte);
+        if (occurrences != nullptr) {
+            ASSERT_EQUAL(&noeuds[38], occurrences[9], "Dernière occurrence incorrecte" + contexte);
+            free(occurrences);
+        }
+
+        InverserLogique(&liste);
+        ASSERT_EQUAL(&noeuds[36], RechercherValeur(&liste, 0), "Occurrence en sens inverse incorrecte" + contexte);
+        InverserLogique(&liste);
+    }
+
+    ForcerNiveauSIMD(NiveauSIMDDisponible());
+}
+
+TEST_CASE(TestSIMDSupprimerToutesOccurrencesDouble) {
+    ListeDouble liste;
+    Initialiser(&liste);
+    for (int i = 0; i < 200; i++) {
+        InsererFin(&liste, i % 4);
+    }
+    RendreCirculaire(&liste);
+    InverserLogique(&liste);
+
+    ASSERT_EQUAL(50, SupprimerToutesOccurrences(&liste, 3), "Cinquante 3 devraient être supprimés");
+    ASSERT_EQUAL(150, liste.taille, "Taille après suppression incorrecte");
+    ASSERT_EQUAL(2, liste.tete->donnee, "La tête logique devrait être 2");
+    ASSERT_NULL(RechercherValeur(&liste, 3), "Plus aucun 3 ne devrait rester");
+    AnalyseCycleD analyse = AnalyserCycle(&liste);
+    ASSERT_EQUAL(150, analyse.suivant.longueurCycle, "L'anneau devrait relier les 150 nœuds");
+    ASSERT_EQUAL(150, analyse.precedent.longueurCycle, "L'anneau arrière devrait relier les 150 nœuds");
+
+    Nettoyer(&liste);
+}
+
+// ============================================================================
+// TESTS DES ITÉRATEURS
+// ============================================================================
+
+static_assert(std::bidirectional_iterator<IterateurD>, "IterateurD doit être bidirectionnel");
+static_assert(std::bidirectional_iterator<IterateurConstD>, "IterateurConstD doit être bidirectionnel");
+static_assert(std::ranges::bidirectional_range<ListeDouble&>, "ListeDouble doit être une plage bidirectionnelle");
+static_assert(std::ranges::common_range<const ListeDouble&>, "begin et end doivent être de même type");
+
+TEST_CASE(TestIterateursDouble) {
+    ListeDouble liste;
+    Initialiser(&liste);
+    ASSERT_TRUE(begin(liste) == end(liste), "Une liste vide devrait être une plage vide");
+
+    for (int i = 1; i <= 10; i++) {
+        InsererFin(&liste, i);
+    }
+
+    int somme = 0;
+    for (int valeur : liste) {
+        somme += valeur;
+    }
+    ASSERT_EQUAL(55, somme, "La somme de 1 à 10 devrait être 55");
+
+    const ListeDouble& lecture = liste;
+    ASSERT_EQUAL(55, std::accumulate(begin(lecture), end(lecture), 0), "std::accumulate incorrect");
+    IterateurConstD trouve = std::find(begin(lecture), end(lecture), 4);
+    ASSERT_EQUAL(3, trouve.Index(), "4 devrait être en position 3");
+
+    IterateurD dernier = std::prev(end(liste));
+    ASSERT_EQUAL(10, *dernier, "--end() devrait désigner la queue");
+    ASSERT_EQUAL(liste.queue, dernier.Noeud(), "Le nœud exposé devrait être la queue");
+
+    std::vector<int> envers;
+    for (int valeur : std::views::reverse(liste)) {
+        envers.push_back(valeur);
+    }
+    ASSERT_EQUAL(10, (int)envers.size(), "Le parcours inverse devrait visiter 10 valeurs");
+    ASSERT_EQUAL(10, envers.front(), "Le parcours inverse devrait commencer par la queue");
+    ASSERT_EQUAL(1, envers.back(), "Le parcours inverse devrait finir par la tête");
+
+    std::ranges::reverse(liste);
+    ASSERT_EQUAL(10, liste.tete->donnee, "std::ranges::reverse devrait permuter les valeurs");
+    ASSERT_EQUAL(1, liste.queue->donnee, "La queue devrait valoir 1 après reverse");
+
+    Nettoyer(&liste);
+}
+
+TEST_CASE(TestIterateursDoubleInverseeCirculaire) {
+    ListeDouble liste;
+    Initialiser(&liste);
+    for (int i = 0; i < 8; i++) {
+        InsererFin(&liste, i);
+    }
+    InverserLogique(&liste);
+
+    std::vector<int> valeurs(begin(liste), end(liste));
+    ASSERT_EQUAL(8, (int)valeurs.size(), "8 valeurs attendues");
+    ASSERT_EQUAL(7, valeurs.front(), "Le sens logique inversé devrait commencer par 7");
+    ASSERT_EQUAL(0, valeurs.back(), "Le sens logique inversé devrait finir par 0");
+    ASSERT_EQUAL(0, *std::prev(end(liste)), "--end() devrait suivre le sens logique");
+
+    RendreCirculaire(&liste);
+    int visites = 0;
+    for (int valeur : liste) {
+        (void)valeur;
+        visites++;
+    }
+    ASSERT_EQUAL(8, visites, "Une liste circulaire devrait être parcourue une seule fois");
+    ASSERT_EQUAL(8, (int)std::ranges::distance(liste), "std::ranges::distance incorrect");
+
+    int reculs = 0;
+    for (IterateurD it = end(liste); it != begin(liste); --it) {
+        reculs++;
+    }
+    ASSERT_EQUAL(8, reculs, "Le parcours arrière devrait s'arrêter à la tête logique");
+    ASSERT_EQUAL(3, *std::ranges::find(liste, 3), "std::ranges::find incorrect");
+
+    Nettoyer(&liste);
+}
+
+// ============================================================================
+// TESTS DE LA LISTE DOUBLE GÉNÉRIQUE
+// ============================================================================
+
+static_assert(std::ranges::bidirectional_range<ListeDoubleT<std::string>&>, "ListeDoubleT doit être une plage bidirectionnelle");
+
+TEST_CASE(TestGeneriqueDouble) {
+    ListeDoubleT<std::string>* liste = AllocateDoubleT<std::string>();
+    ASSERT_NOT_NULL(liste, "La liste générique devrait être créée");
+    if (!liste) return;
+
+    NoeudDT<std::string>* milieu = EmplacerFin(liste, "milieu");
+    EmplacerDebut(liste, "debut");
+    EmplacerFin(liste, "fin");
+    EmplacerAvant(liste, milieu, "avant");
+    EmplacerApres(liste, milieu, "apres");
+    ASSERT_EQUAL(5, liste->taille, "5 éléments attendus");
+
+    std::vector<std::string> valeurs(begin(*liste), end(*liste));
+    std::vector<std::string> attendues = {"debut", "avant", "milieu", "apres", "fin"};
+    ASSERT_TRUE(valeurs == attendues, "Ordre après insertions incorrect");
+    ASSERT_EQUAL(std::string("fin"), *std::prev(end(*liste)), "--end() devrait désigner la queue");
+    ASSERT_EQUAL(milieu, ObtenirNoeudPosition(liste, 2), "ObtenirNoeudPosition incorrect");
+
+    std::string extrait;
+    ASSERT_TRUE(ExtraireNoeud(liste, milieu, &extrait), "Le retrait en O(1) devrait réussir");
+    ASSERT_EQUAL(std::string("milieu"), extrait, "La donnée extraite devrait être milieu");
+    ASSERT_TRUE(SupprimerFin(liste), "SupprimerFin devrait réussir");
+    ASSERT_EQUAL(std::string("apres"), liste->queue->donnee, "La queue devrait être apres");
+    ASSERT_NULL(liste->queue->suivant, "La queue ne devrait pas avoir de suivant");
+
+    Inverser(liste);
+    ASSERT_EQUAL(std::string("apres"), liste->tete->donnee, "La tête inversée devrait être apres");
+    ASSERT_NULL(liste->tete->precedent, "La tête ne devrait pas avoir de précédent");
+
+    ListeDoubleT<std::string>* copie = Copier(liste);
+    ASSERT_NOT_NULL(copie, "La copie devrait réussir");
+    if (copie != nullptr) {
+        ASSERT_EQUAL(3, copie->taille, "La copie devrait avoir 3 éléments");
+        ASSERT_EQUAL(std::string("debut"), copie->queue->donnee, "La queue copiée devrait être debut");
+        ASSERT_EQUAL(copie->tete, copie->queue->precedent->precedent, "Les liens arrière copiés devraient être valides");
+        Detruire(copie);
+    }
+    Detruire(liste);
+}
+
+TEST_CASE(TestGeneriqueDoubleDiviserFusionner) {
+    ListeDoubleT<std::unique_ptr<int>> liste = CreerDoubleT<std::unique_ptr<int>>();
+    for (int i = 0; i < 8; i++) {
+        EmplacerFin(&liste, std::make_unique<int>(i * 2));
+    }
+    ListeDoubleT<std::unique_ptr<int>> seconde = CreerDoubleT<std::unique_ptr<int>>();
+    Diviser(&liste, 3, &seconde);
+    ASSERT_EQUAL(3, liste.taille, "La première partie devrait avoir 3 éléments");
+    ASSERT_EQUAL(5, seconde.taille, "La seconde partie devrait avoir 5 éléments");
+    ASSERT_NULL(seconde.tete->precedent, "La seconde tête ne devrait pas avoir de précédent");
+    ASSERT_EQUAL(4, *liste.queue->donnee, "La première queue devrait valoir 4");
+
+    ListeDoubleT<std::unique_ptr<int>> impairs = CreerDoubleT<std::unique_ptr<int>>();
+    for (int i = 0; i < 4; i++) {
+        EmplacerFin(&impairs, std::make_unique<int>(i * 2 + 1));
+    }
+    auto inferieur = [](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a < *b; };
+    Fusionner(&seconde, &impairs, inferieur);
+    ASSERT_EQUAL(9, seconde.taille, "La fusion devrait donner 9 éléments");
+    ASSERT_TRUE(EstVide(&impairs), "La source devrait être vidée");
+
+    std::vector<int> avant;
+    for (const std::unique_ptr<int>& valeur : seconde) {
+        avant.push_back(*valeur);
+    }
+    std::vector<int> arriere;
+    for (NoeudDT<std::unique_ptr<int>>* n = seconde.queue; n != nullptr; n = n->precedent) {
+        arriere.insert(arriere.begin(), *n->donnee);
+    }
+    std::vector<int> attendues = {1, 3, 5, 6, 7, 8, 10, 12, 14};
+    ASSERT_TRUE(avant == attendues, "La fusion devrait être triée");
+    ASSERT_TRUE(arriere == attendues, "Les liens arrière devraient suivre la fusion");
+
+    Concatener(&liste, &seconde);
+    ASSERT_EQUAL(12, liste.taille, "La concaténation devrait donner 12 éléments");
+    NoeudDT<std::unique_ptr<int>>* jonction = ObtenirNoeudPosition(&liste, 3);
+    ASSERT_EQUAL(1, *jonction->donnee, "Le premier nœud concaténé devrait valoir 1");
+    ASSERT_EQUAL(4, *jonction->precedent->donnee, "Les liens arrière devraient traverser la jonction");
+    Nettoyer(&liste);
+}
+
+// ============================================================================
+// TESTS DES RESSOURCES MÉMOIRE (std::pmr)
+// ============================================================================
+
+TEST_CASE(TestRessourceListeDouble) {
+    std::pmr::unsynchronized_pool_resource pool;
+    ListeDoubleT<int>* liste = AllocateDoubleT<int>(&pool);
+    ASSERT_NOT_NULL(liste, "La liste devrait être créée dans le pool");
+    if (!liste) return;
+    for (int i = 0; i < 20; i += 2) {
+        EmplacerFin(liste, i);
+    }
+
+    ListeDoubleT<int>* copie = Copier(liste, std::pmr::new_delete_resource());
+    ASSERT_TRUE(copie->ressource == std::pmr::new_delete_resource(), "Copier accepte une ressource explicite");
+    ListeDoubleT<int>* jumelle = Copier(liste);
+    ASSERT_TRUE(jumelle->ressource == &pool, "Copier propage la ressource");
+    Detruire(jumelle);
+
+    ListeDoubleT<int> seconde = CreerDoubleT<int>();
+    Diviser(liste, 5, &seconde);
+    ASSERT_TRUE(seconde.ressource == &pool, "Diviser propage la ressource");
+
+    ListeDoubleT<int> impairs = CreerDoubleT<int>();
+    for (int i = 1; i < 20; i += 2) {
+        EmplacerFin(&impairs, i);
+    }
+    ASSERT_TRUE(Fusionner(&seconde, &impairs), "La fusion entre ressources devrait réussir");
+    ASSERT_EQUAL(15, seconde.taille, "La fusion devrait donner 15 éléments");
+    ASSERT_TRUE(EstVide(&impairs), "La source devrait être vidée");
+    ASSERT_NULL(impairs.tete, "La source ne devrait plus avoir de nœuds");
+    int precedent = -1;
+    bool ordonne = true;
+    for (int valeur : seconde) {
+        ordonne = ordonne && valeur > precedent;
+        precedent = valeur;
+    }
+    ASSERT_TRUE(ordonne, "La fusion devrait être triée");
+    ASSERT_EQUAL(19, seconde.queue->donnee, "La queue fusionnée devrait valoir 19");
+    ASSERT_EQUAL(18, seconde.queue->precedent->donnee, "Les liens arrière devraient être relogés");
+
+    ListeDoubleT<int>* fusion = FusionnerListesTriees(liste, copie);
+    ASSERT_TRUE(fusion->ressource == &pool, "FusionnerListesTriees prend la ressource de la première liste");
+    ASSERT_EQUAL(15, fusion->taille, "La fusion copiée devrait avoir 15 éléments");
+
+    Detruire(fusion);
+    Nettoyer(&seconde);
+    Detruire(copie);
+    Detruire(liste);
+}
+
+// ============================================================================
+// TESTS DE LA LISTE INTRUSIVE DOUBLE
+// ============================================================================
+
+struct Tampon {
+    int taille;
+    CrochetD<Tampon> lien;
+};
+
+typedef ListeIntrusiveD<Tampon, &Tampon::lien> ListeTampons;
+
+static_assert(std::ranges::bidirectional_range<ListeTampons&>, "La liste intrusive double doit être bidirectionnelle");
+
+TEST_CASE(TestIntrusiveDouble) {
+    Tampon tampons[8];
+    ListeTampons liste;
+    Initialiser(&liste);
+    const int tailles[8] = {64, 8, 512, 32, 8, 256, 16, 128};
+    for (int i = 0; i < 8; i++) {
+        tampons[i].taille = tailles[i];
+        InsererFin(&liste, &tampons[i]);
+    }
+
+    ASSERT_TRUE(Retirer(&liste, &tampons[4]), "Le retrait en O(1) devrait réussir");
+    ASSERT_NULL(tampons[4].lien.suivant, "Les liens de l'objet retiré sont effacés");
+    ASSERT_EQUAL(&tampons[5], tampons[3].lien.suivant, "Les voisins devraient être raccordés");
+    ASSERT_EQUAL(&tampons[3], tampons[5].lien.precedent, "Le lien arrière devrait être raccordé");
+    ASSERT_TRUE(InsererAvant(&liste, &tampons[0], &tampons[4]), "InsererAvant la tête devrait réussir");
+    ASSERT_EQUAL(&tampons[4], liste.tete, "L'objet devrait être en tête");
+    ASSERT_EQUAL(&tampons[7], RetirerFin(&liste), "RetirerFin devrait rendre la queue");
+    InsererApres(&liste, &tampons[2], &tampons[7]);
+    ASSERT_EQUAL(&tampons[7], ObtenirPosition(&liste, 4), "InsererApres devrait placer l'objet en position 4");
+
+    Trier(&liste, [](const Tampon& a, const Tampon& b) { return a.taille < b.taille; });
+    std::vector<int> avant;
+    for (const Tampon& t : liste) {
+        avant.push_back(t.taille);
+    }
+    std::vector<int> arriere;
+    for (Tampon* t = liste.queue; t != nullptr; t = t->lien.precedent) {
+        arriere.insert(arriere.begin(), t->taille);
+    }
+    std::vector<int> attendues = {8, 8, 16, 32, 64, 128, 256, 512};
+    ASSERT_TRUE(avant == attendues, "Le tri devrait ordonner les tailles");
+    ASSERT_TRUE(arriere == attendues, "Les liens arrière devraient suivre le tri");
+    ASSERT_EQUAL(&tampons[4], liste.tete, "Le tri devrait être stable (tampon 4 était devant)");
+
+    Inverser(&liste);
+    ASSERT_EQUAL(512, liste.tete->taille, "L'inversion devrait mettre 512 en tête");
+    ASSERT_EQUAL(8, std::prev(end(liste))->taille, "--end() devrait donner la queue");
+
+    ListeTampons seconde;
+    Initialiser(&seconde);
+    Diviser(&liste, 3, &seconde);
+    ASSERT_EQUAL(3, liste.taille, "La première partie devrait avoir 3 tampons");
+    ASSERT_NULL(seconde.tete->lien.precedent, "La seconde tête ne devrait pas avoir de précédent");
+    Concatener(&seconde, &liste);
+    ASSERT_EQUAL(8, seconde.taille, "La concaténation devrait réunir 8 tampons");
+    Tampon* jonction = ObtenirPosition(&seconde, 5);
+    ASSERT_EQUAL(512, jonction->taille, "La première partie devrait suivre la seconde");
+    ASSERT_EQUAL(8, jonction->lien.precedent->taille, "Les liens arrière devraient traverser la jonction");
+}
+
+// ============================================================================
+// TESTS DE LA LISTE DOUBLE STATIQUE
+// ============================================================================
+
+/**
+ * @brief Valeurs lues vers l'avant, puis vers l'arrière remises à l'endroit
+ */
+template <int N>
+static bool LiensStatiquesCoherents(const ListeDoubleStatique<N>* liste) {
+    std::vector<int> avant;
+    for (int index = liste->tete; index != STATIQUE_AUCUN; index = liste->noeuds[index].suivant) {
+        avant.push_back(liste->noeuds[index].donnee);
+    }
+    std::vector<int> arriere;
+    for (int index = liste->queue; index != STATIQUE_AUCUN; index = liste->noeuds[index].precedent) {
+        arriere.insert(arriere.begin(), liste->noeuds[index].donnee);
+    }
+    return avant == arriere && (int)avant.size() == liste->taille;
+}
+
+TEST_CASE(TestStatiqueDouble) {
+    ListeDoubleStatique<6> liste;
+    Initialiser(&liste);
+    for (int i = 1; i <= 5; i++) {
+        InsererFin(&liste, i * 10);
+    }
+    int trente = RechercherValeur(&liste, 30);
+    ASSERT_TRUE(InsererAvant(&liste, trente, 25), "InsererAvant devrait réussir");
+    ASSERT_FALSE(InsererAvant(&liste, trente, 26), "La capacité de 6 est atteinte");
+    ASSERT_EQUAL(std::string("ListeDouble[Noeud(10) <-> Noeud(20) <-> Noeud(25) <-> Noeud(30) <-> Noeud(40) <-> "
+                             "Noeud(50)]"),
+                 ToString((const ListeDoubleStatique<6>*)&liste), "Le format devrait suivre ToString(ListeDouble)");
+
+    ASSERT_TRUE(SupprimerNoeud(&liste, trente), "SupprimerNoeud devrait réussir en O(1)");
+    ASSERT_TRUE(SupprimerFin(&liste), "SupprimerFin devrait réussir");
+    ASSERT_EQUAL(20, liste.noeuds[ObtenirNoeudPositionInverse(&liste, 2)].donnee, "La position inverse 2 vaut 20");
+    ASSERT_TRUE(LiensStatiquesCoherents(&liste), "Les liens arrière devraient suivre les suppressions");
+
+    ASSERT_TRUE(InsererDebut(&liste, 40), "La place libérée devrait servir");
+    ASSERT_TRUE(InsererApres(&liste, liste.queue, 5), "InsererApres la queue devrait réussir");
+    Trier(&liste);
+    ASSERT_TRUE(LiensStatiquesCoherents(&liste), "Les liens arrière devraient suivre le tri");
+    ASSERT_EQUAL(5, liste.noeuds[liste.tete].donnee, "5 devrait être en tête après le tri");
+    ASSERT_EQUAL(40, liste.noeuds[liste.queue].donnee, "40 devrait être en queue après le tri");
+
+    RotationGauche(&liste, 4);
+    ASSERT_TRUE(LiensStatiquesCoherents(&liste), "Les liens arrière devraient suivre la rotation");
+    Inverser(&liste);
+    ASSERT_TRUE(LiensStatiquesCoherents(&liste), "Les liens arrière devraient suivre l'inversion");
+    ASSERT_EQUAL(std::string("ListeDouble[Noeud(25) <-> Noeud(20) <-> Noeud(10) <-> Noeud(5) <-> Noeud(40) <-> "
+                             "Noeud(40)]"),
+                 ToString((const ListeDoubleStatique<6>*)&liste), "Rotation puis inversion");
+
+    ListeDoubleStatique<6> seconde;
+    Initialiser(&seconde);
+    Diviser(&liste, 5, &seconde);
+    ASSERT_EQUAL(1, CompterElements(&seconde), "ListeDouble accepte une coupure avant la queue");
+    ASSERT_TRUE(LiensStatiquesCoherents(&liste), "La première partie devrait rester cohérente");
+    ASSERT_TRUE(SupprimerPosition(&liste, 0), "SupprimerPosition devrait réussir");
+    ASSERT_TRUE(SupprimerFin(&liste), "SupprimerFin devrait réussir");
+    ASSERT_TRUE(Concatener(&liste, &liste), "Doubler 3 éléments tient dans la capacité");
+    ASSERT_TRUE(LiensStatiquesCoherents(&liste), "L'auto-concaténation devrait rester cohérente");
+    ASSERT_EQUAL(2, SupprimerToutesOccurrences(&liste, 10), "10 apparaît deux fois");
+    ASSERT_EQUAL(4, CompterElements(&liste), "Il devrait rester 4 éléments");
+}
+
+// ============================================================================
+// TESTS DES LECTEURS SANS VERROU (récupération différée)
+// ============================================================================
+
+TEST_CASE(TestLecteursProtegesDouble) {
+    ListeDouble* liste = AllocateDouble();
+    const int cles = 256;
+    for (int cle = 0; cle < cles; cle++) {
+        InsererFinPublie(liste, cle);
+    }
+
+    std::atomic<bool> arret(false);
+    std::atomic<bool> pairesToujoursVues(true);
+    std::vector<std::thread> lecteurs;
+    for (int t = 0; t < 3; t++) {
+        lecteurs.emplace_back([&, t]() {
+            while (!arret.load()) {
+                for (int cle = 2 * t; cle < cles; cle += 6) {
+                    if (!RechercherValeurProtegee(liste, cle)) {
+                        pairesToujoursVues.store(false);
+                    }
+                }
+            }
+        });
+    }
+    std::mutex verrouEcrivains;
+    std::thread ecrivain([&]() {
+        for (int tour = 0; tour < 50; tour++) {
+            for (int cle = 1; cle < cles; cle += 2) {
+                std::lock_guard<std::mutex> garde(verrouEcrivains);
+                SupprimerValeurDifferee(liste, cle);
+                InsererFinPublie(liste, cle);
+            }
+        }
+    });
+    ecrivain.join();
+    arret.store(true);
+    for (std::thread& lecteur : lecteurs) {
+        lecteur.join();
+    }
+
+    ASSERT_TRUE(pairesToujoursVues.load(), "Les clés paires devraient toujours être trouvées");
+    for (int cle = 1; cle < cles; cle += 2) {
+        SupprimerValeurDifferee(liste, cle);
+    }
+    ASSERT_EQUAL(cles / 2, CompterElements((const ListeDouble*)liste), "Seules les paires devraient rester");
+
+    // Les liens precedent, tenus par l'écrivain seul, doivent refléter les suppressions
+    bool liensCoherents = liste->tete->precedent == nullptr;
+    for (NoeudD* noeud = liste->tete; noeud->suivant != nullptr; noeud = noeud->suivant) {
+        liensCoherents = liensCoherents && noeud->suivant->precedent == noeud && noeud->donnee % 2 == 0;
+    }
+    ASSERT_TRUE(liensCoherents, "Les liens arrière devraient rester cohérents");
+    ASSERT_EQUAL(cles - 2, liste->queue->donnee, "La queue devrait être la dernière clé paire");
+    ASSERT_TRUE(InsererFinPublie(liste, 7), "L'insertion publiée devrait réussir");
+    ASSERT_TRUE(liste->queue->precedent->donnee == cles - 2, "Le nouveau nœud pointe vers l'ancienne queue");
+    Detruire(liste);
+}
+
+// ============================================================================
+// TESTS DE LA LISTE DOUBLE RCU
+// ============================================================================
+
+TEST_CASE(TestRcuDoubleSequentiel) {
+    ListeDoubleRcu* liste = AllocateDoubleRcu();
+    ASSERT_NOT_NULL(liste, "La liste RCU devrait être créée");
+    ASSERT_TRUE(InsererFin(liste, 20), "InsererFin devrait réussir");
+    ASSERT_TRUE(InsererDebut(liste, 10), "InsererDebut devrait réussir");
+    ASSERT_TRUE(InsererFin(liste, 40), "InsererFin devrait réussir");
+
+    EntrerLecture(liste);
+    NoeudD* vingt = ObtenirNoeudPosition(liste, 1);
+    NoeudD* quarante = ObtenirNoeudPosition(liste, 2);
+    ASSERT_NULL(ObtenirNoeudPosition(liste, 3), "La position 3 dépasse la liste");
+    SortirLecture(liste);
+    ASSERT_EQUAL(20, vingt->donnee, "La position 1 vaut 20");
+
+    ASSERT_TRUE(InsererApres(liste, vingt, 30), "InsererApres devrait réussir");
+    ASSERT_TRUE(InsererAvant(liste, vingt, 15), "InsererAvant devrait réussir");
+    ASSERT_EQUAL(std::string("ListeDouble[Noeud(10) <-> Noeud(15) <-> Noeud(20) <-> Noeud(30) <-> Noeud(40)]"),
+                 ToString((const ListeDoubleRcu*)liste), "Les insertions devraient être à leur place");
+
+    // Un lecteur arrêté sur le nœud supprimé continue son parcours normalement
+    EntrerLecture(liste);
+    NoeudD* courant = ObtenirNoeudPosition(liste, 2);
+    ASSERT_TRUE(SupprimerNoeud(liste, vingt), "La suppression devrait réussir");
+    ASSERT_EQUAL(20, courant->donnee, "Le nœud supprimé reste lisible en section");
+    ASSERT_EQUAL(30, SuivantRcu(courant)->donnee, "Son lien suivant reste utilisable");
+    // La section ouverte avant la suppression garde vingt en mémoire
+    ASSERT_FALSE(SupprimerNoeud(liste, vingt), "Un nœud supprimé ne se supprime pas deux fois");
+    SortirLecture(liste);
+
+    Synchroniser(liste);
+    Recuperer(DomaineEpoqueGlobal(), ParticipantEpoqueDuThread());
+
+    ASSERT_TRUE(InsererAvant(liste, quarante, 35), "InsererAvant la queue devrait réussir");
+    ASSERT_TRUE(SupprimerNoeud(liste, quarante), "La queue peut être supprimée");
+    ASSERT_EQUAL(std::string("ListeDouble[Noeud(10) <-> Noeud(15) <-> Noeud(30) <-> Noeud(35)]"),
+                 ToString((const ListeDoubleRcu*)liste), "Il devrait rester 10, 15, 30, 35");
+    ASSERT_EQUAL(4, CompterElements(liste), "La liste devrait contenir 4 éléments");
+    ASSERT_EQUAL(35, liste->liste.queue->donnee, "La queue devrait suivre la suppression");
+    ASSERT_NULL(liste->liste.tete->precedent, "La tête n'a pas de précédent");
+    ASSERT_TRUE(RechercherValeur(liste, 30), "30 devrait être trouvé");
+    ASSERT_FALSE(RechercherValeur(liste, 20), "20 ne devrait plus être trouvé");
+    Detruire(liste);
+}
+
+TEST_CASE(TestRcuDoubleLecteurs) {
+    ListeDoubleRcu* liste = AllocateDoubleRcu();
+    const int cles = 128;
+    for (int cle = 0; cle < cles; cle += 2) {
+        InsererFin(liste, cle);
+    }
+
+    // Des écrivains intercalent puis retirent les clés impaires ; les lecteurs vérifient l'ordre
+    std::atomic<bool> arret(false);
+    std::atomic<bool> ordreConserve(true);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; t++) {
+        threads.emplace_back([&]() {
+            while (!arret.load()) {
+                EntrerLecture(liste);
+                int precedente = -1;
+                int paires = 0;
+                for (NoeudD* noeud = PremierRcu(liste); noeud != nullptr; noeud = SuivantRcu(noeud)) {
+                    if (noeud->donnee <= precedente) {
+                        ordreConserve.store(false);
+                    }
+                    precedente = noeud->donnee;
+                    paires += noeud->donnee % 2 == 0 ? 1 : 0;
+                }
+                SortirLecture(liste);
+                if (paires != cles / 2) {
+                    ordreConserve.store(false);
+                }
+            }
+        });
+    }
+    std::vector<std::thread> ecrivains;
+    for (int t = 0; t < 2; t++) {
+        ecrivains.emplace_back([&, t]() {
+            for (int tour = 0; tour < 30; tour++) {
+                for (int position = t; position < cles / 2; position += 2) {
+                    EntrerLecture(liste);
+                    NoeudD* noeud = PremierRcu(liste);
+                    while (noeud != nullptr && noeud->donnee != 2 * position) {
+                        noeud = SuivantRcu(noeud);
+                    }
+                    SortirLecture(liste);
+                    // Les paires ne sont jamais supprimées : noeud reste valide hors section
+                    InsererApres(liste, noeud, 2 * position + 1);
+                    EntrerLecture(liste);
+                    NoeudD* impair = SuivantRcu(noeud);
+                    SortirLecture(liste);
+                    SupprimerNoeud(liste, impair);
+                }
+            }
+        });
+    }
+    for (std::thread& ecrivain : ecrivains) {
+        ecrivain.join();
+    }
+    arret.store(true);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_TRUE(ordreConserve.load(), "Les lecteurs devraient toujours voir toutes les paires, dans l'ordre");
+    ASSERT_EQUAL(cles / 2, CompterElements(liste), "Seules les paires devraient rester");
+    Detruire(liste);
+}
+
+// ============================================================================
+// TESTS DE LA LISTE DOUBLE À VERROUS FINS
+// ============================================================================
+
+TEST_CASE(TestVerrousDoubleSequentiel) {
+    const ModeVerrous modes[] = {VERROUS_COUPLAGE, VERROUS_OPTIMISTE};
+    for (ModeVerrous mode : modes) {
+        ListeDoubleVerrous* liste = AllocateDoubleVerrous(mode);
+        ASSERT_NOT_NULL(liste, "La liste devrait être créée");
+
+        ASSERT_TRUE(InsererPosition(liste, 0, 2), "Insertion dans la liste vide");
+        ASSERT_TRUE(InsererPosition(liste, 0, 1), "Insertion en tête");
+        ASSERT_TRUE(InsererPosition(liste, 2, 4), "Insertion en fin");
+        ASSERT_FALSE(InsererPosition(liste, 4, 9), "Position au-delà de la taille");
+        ASSERT_TRUE(InsererAvant(liste, ObtenirNoeudPosition(liste, 2), 3), "Insertion avant un nœud");
+        ASSERT_TRUE(InsererApres(liste, ObtenirNoeudPosition(liste, 3), 5), "Insertion après la queue");
+        ASSERT_EQUAL(std::string("ListeDouble[Noeud(1) <-> Noeud(2) <-> Noeud(3) <-> Noeud(4) <-> Noeud(5)]"),
+                     ToString((const ListeDoubleVerrous*)liste), "Ordre après insertions");
+        ASSERT_EQUAL(5, CompterElements(liste), "Cinq éléments");
+
+        ASSERT_TRUE(EchangerNoeuds(liste, ObtenirNoeudPosition(liste, 0), ObtenirNoeudPosition(liste, 4)),
+                    "Échange des extrémités");
+        ASSERT_TRUE(EchangerNoeuds(liste, ObtenirNoeudPosition(liste, 2), ObtenirNoeudPosition(liste, 1)),
+                    "Échange de voisins");
+        ASSERT_EQUAL(std::string("ListeDouble[Noeud(5) <-> Noeud(3) <-> Noeud(2) <-> Noeud(4) <-> Noeud(1)]"),
+                     ToString((const ListeDoubleVerrous*)liste), "Ordre après échanges");
+        ASSERT_EQUAL(1, liste->liste.queue->donnee, "La queue suit les échanges");
+        ASSERT_EQUAL(4, liste->liste.queue->precedent->donnee, "Les liens arrière suivent les échanges");
+
+        ASSERT_TRUE(SupprimerPosition(liste, 0), "Suppression en tête");
+        ASSERT_TRUE(SupprimerPosition(liste, 3), "Suppression en queue");
+        ASSERT_FALSE(SupprimerPosition(liste, 3), "Position égale à la taille");
+        // En section, milieu reste lisible après sa suppression
+        EntrerSection(DomaineEpoqueGlobal(), ParticipantEpoqueDuThread());
+        NoeudD* milieu = ObtenirNoeudPosition(liste, 1);
+        ASSERT_TRUE(SupprimerNoeud(liste, milieu), "Suppression d'un nœud");
+        ASSERT_FALSE(SupprimerNoeud(liste, milieu), "Un nœud supprimé ne se supprime pas deux fois");
+        ASSERT_FALSE(InsererApres(liste, milieu, 7), "Pas d'insertion après un nœud supprimé");
+        SortirSection(DomaineEpoqueGlobal(), ParticipantEpoqueDuThread());
+        ASSERT_EQUAL(std::string("ListeDouble[Noeud(3) <-> Noeud(4)]"), ToString((const ListeDoubleVerrous*)liste),
+                     "Ordre après suppressions");
+        ASSERT_EQUAL(2, CompterElements(liste), "Deux éléments");
+        ASSERT_NULL(ObtenirNoeudPosition(liste, 2), "Position hors de la liste");
+        Detruire(liste);
+    }
+    AttendreGrace(DomaineEpoqueGlobal());
+}
+
+TEST_CASE(TestVerrousDoubleEcrivains) {
+    const ModeVerrous modes[] = {VERROUS_COUPLAGE, VERROUS_OPTIMISTE};
+    for (ModeVerrous mode : modes) {
+        ListeDoubleVerrous* liste = AllocateDoubleVerrous(mode);
+        const int initiaux = 64;
+        for (int i = 0; i < initiaux; i++) {
+            InsererPosition(liste, i, i);
+        }
+
+        // Insertions, suppressions et échanges mêlés sur toute la liste
+        std::atomic<int> bilan(initiaux);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([&, t]() {
+                unsigned int graine = 17u * (t + 1);
+                for (int i = 0; i < 2000; i++) {
+                    graine = graine * 1103515245u + 12345u;
+                    int position = (int)((graine >> 8) % (initiaux + 8));
+                    switch ((graine >> 4) % 3) {
+                    case 0:
+                        bilan += InsererPosition(liste, position, i) ? 1 : 0;
+                        break;
+                    case 1:
+                        bilan -= SupprimerPosition(liste, position) ? 1 : 0;
+                        break;
+                    default: {
+                        DomaineEpoque* domaine = DomaineEpoqueGlobal();
+                        ParticipantEpoque* participant = ParticipantEpoqueDuThread();
+                        EntrerSection(domaine, participant);
+                        NoeudD* a = ObtenirNoeudPosition(liste, position);
+                        NoeudD* b = ObtenirNoeudPosition(liste, position / 2);
+                        if (a != nullptr && b != nullptr) {
+                            EchangerNoeuds(liste, a, b);
+                        }
+                        SortirSection(domaine, participant);
+                    }
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        int avant = 0;
+        bool liensCoherents = true;
+        NoeudD* precedent = nullptr;
+        for (NoeudD* noeud = liste->liste.tete; noeud != nullptr; noeud = noeud->suivant) {
+            liensCoherents = liensCoherents && noeud->precedent == precedent;
+            precedent = noeud;
+            avant++;
+        }
+        ASSERT_TRUE(liensCoherents && liste->liste.queue == precedent, "Les liens arrière devraient être cohérents");
+        ASSERT_EQUAL(bilan.load(), avant, "Le parcours devrait compter toutes les insertions non supprimées");
+        ASSERT_EQUAL(avant, CompterElements(liste), "La taille devrait suivre les modifications");
+        Detruire(liste);
+    }
+    AttendreGrace(DomaineEpoqueGlobal());
+}
+
+// ============================================================================
+// TESTS DE LA FILE DE VOL DE TÂCHES (Chase-Lev)
+// ============================================================================
+
+TEST_CASE(TestDequeVolSequentiel) {
+    DequeVol* deque = AllocateDequeVol();
+    ASSERT_NOT_NULL(deque, "La file devrait être créée");
+    int tache = -1;
+    ASSERT_FALSE(SupprimerFin(deque, &tache), "Rien à reprendre dans une file vide");
+    ASSERT_FALSE(Voler(deque, &tache), "Rien à voler dans une file vide");
+
+    InsererFin(deque, 1);
+    InsererFin(deque, 2);
+    InsererFin(deque, 3);
+    ASSERT_EQUAL(std::string("ListeDouble[Noeud(1) <-> Noeud(2) <-> Noeud(3)]"), ToString((const DequeVol*)deque),
+                 "Tâches de tete à queue");
+    ASSERT_TRUE(SupprimerFin(deque, &tache) && tache == 3, "Le propriétaire reprend la dernière tâche");
+    ASSERT_TRUE(Voler(deque, &tache) && tache == 1, "Le voleur prend la plus ancienne");
+    ASSERT_TRUE(SupprimerFin(deque, &tache) && tache == 2, "Dernière tâche");
+    ASSERT_TRUE(EstVide(deque), "La file est vide");
+
+    // Plusieurs tranches, parcourues dans les deux sens
+    const int total = 3 * DEQUE_TACHES_PAR_TRANCHE + 17;
+    bool ordre = true;
+    for (int i = 0; i < total; i++) {
+        ordre = ordre && InsererFin(deque, i);
+    }
+    ASSERT_TRUE(ordre, "Insertions au-delà d'une tranche");
+    ASSERT_EQUAL(total, CompterElements(deque), "Toutes les tâches sont comptées");
+    for (int i = 0; i < DEQUE_TACHES_PAR_TRANCHE + 5; i++) {
+        ordre = ordre && Voler(deque, &tache) && tache == i;
+    }
+    ASSERT_TRUE(ordre, "Les vols suivent l'ordre d'insertion, d'une tranche à l'autre");
+    for (int i = total - 1; i >= 2 * DEQUE_TACHES_PAR_TRANCHE; i--) {
+        ordre = ordre && SupprimerFin(deque, &tache) && tache == i;
+    }
+    ASSERT_TRUE(ordre, "Le propriétaire reprend en ordre inverse, en revenant sur les tranches");
+    for (int i = 0; i < 10; i++) {
+        InsererFin(deque, 1000 + i);
+    }
+    ASSERT_EQUAL(2 * DEQUE_TACHES_PAR_TRANCHE - (DEQUE_TACHES_PAR_TRANCHE + 5) + 10, CompterElements(deque),
+                 "Les tranches gardées par le propriétaire sont réutilisées");
+    ASSERT_TRUE(SupprimerFin(deque, &tache) && tache == 1009, "Reprise après réutilisation");
+    Detruire(deque);
+}
+
+TEST_CASE(TestDequeVolVoleurs) {
+    const int total = 20000;
+    DequeVol* deque = AllocateDequeVol();
+    std::vector<std::atomic<int>> prises(total);
+    for (std::atomic<int>& prise : prises) {
+        prise.store(0);
+    }
+
+    std::atomic<bool> fini(false);
+    std::vector<std::thread> voleurs;
+    for (int t = 0; t < 3; t++) {
+        voleurs.emplace_back([&]() {
+            int tache;
+            while (!fini.load() || !EstVide(deque)) {
+                if (Voler(deque, &tache)) {
+                    prises[tache]++;
+                }
+            }
+        });
+    }
+    // Le propriétaire insère par rafales et reprend une tâche sur trois
+    int tache;
+    for (int i = 0; i < total; i++) {
+        InsererFin(deque, i);
+        if (i % 3 == 0 && SupprimerFin(deque, &tache)) {
+            prises[tache]++;
+        }
+    }
+    while (SupprimerFin(deque, &tache)) {
+        prises[tache]++;
+    }
+    fini.store(true);
+    for (std::thread& voleur : voleurs) {
+        voleur.join();
+    }
+
+    bool uneFoisChacune = true;
+    for (std::atomic<int>& prise : prises) {
+        uneFoisChacune = uneFoisChacune && prise.load() == 1;
+    }
+    ASSERT_TRUE(uneFoisChacune, "Chaque tâche devrait être prise exactement une fois");
+    ASSERT_TRUE(EstVide(deque), "La file devrait être vide");
+    Detruire(deque);
+}
+
+// ============================================================================
+// TESTS DE LA LISTE DOUBLE SEGMENTÉE
+// ============================================================================
+
+TEST_CASE(TestSegmenteeDoubleModifications) {
+    const int pas = 4;
+    ListeDoubleSegmentee* liste = AllocateDoubleSegmentee(pas);
+    ASSERT_NOT_NULL(liste, "La liste devrait être créée");
+
+    std::vector<int> reference;
+    unsigned int graine = 11;
+    bool conforme = true;
+    for (int i = 0; i < 3000; i++) {
+        graine = graine * 1103515245u + 12345u;
+        int taille = (int)reference.size();
+        int position = taille > 0 ? (int)((graine >> 8) % (unsigned int)(taille + 1)) : 0;
+        if ((graine >> 4) % 5 < 3 || taille < 8) {
+            conforme = conforme && InsererPosition(liste, position, i);
+            reference.insert(reference.begin() + position, i);
+        } else if (position < taille) {
+            conforme = conforme && SupprimerPosition(liste, position);
+            reference.erase(reference.begin() + position);
+        }
+
+        NoeudD* noeud = liste->liste.tete;
+        int couverts = 0;
+        for (int s = 0; s < liste->nombreSegments; s++) {
+            conforme = conforme && liste->segments[s].debut == noeud && liste->segments[s].taille >= 1 &&
+                       liste->segments[s].taille <= 2 * pas + pas / 2;
+            for (int k = 0; k < liste->segments[s].taille && noeud != nullptr; k++) {
+                noeud = noeud->suivant;
+                couverts++;
+            }
+        }
+        conforme = conforme && noeud == nullptr && couverts == (int)reference.size();
+    }
+    ASSERT_TRUE(conforme, "La table de segments devrait suivre chaque modification");
+    bool memesValeurs = (int)reference.size() == CompterElements(liste);
+    for (int i = 0; i < (int)reference.size(); i++) {
+        memesValeurs = memesValeurs && ObtenirNoeudPosition(liste, i)->donnee == reference[i];
+    }
+    ASSERT_TRUE(memesValeurs, "Même contenu que la référence, par position");
+    ASSERT_TRUE(reference.empty() || liste->liste.queue->donnee == reference.back(), "La queue suit les modifications");
+    Detruire(liste);
+}
+
+TEST_CASE(TestParcoursParalleleDouble) {
+    ListeDouble* source = AllocateDouble();
+    for (int i = 0; i < 5000; i++) {
+        InsererFin(source, i);
+    }
+    // Une source inversée logiquement est remise dans l'ordre des liens avant découpe
+    InverserLogique(source);
+    ListeDoubleSegmentee* liste = Segmenter(source, 32);
+    ASSERT_NOT_NULL(liste, "La liste devrait être segmentée");
+    ASSERT_EQUAL(4999, liste->liste.tete->donnee, "L'ordre logique est conservé");
+    Detruire(source);
+
+    long long somme = ParcourirParallele(liste, 4, 0LL, [](long long& s, int valeur) { s += valeur; },
+                                         [](long long& s, const long long& p) { s += p; });
+    ASSERT_EQUAL(5000LL * 4999 / 2, somme, "Somme sur 4 threads");
+
+    // Le premier élément de chaque part, fusionné dans l'ordre, doit être le premier de la liste
+    int premier = ParcourirParallele(liste, 4, -1, [](int& p, int valeur) { p = p < 0 ? valeur : p; },
+                                     [](int& p, const int& q) { p = p < 0 ? q : p; });
+    ASSERT_EQUAL(4999, premier, "Les partiels sont fusionnés dans l'ordre de la liste");
+    Detruire(liste);
+}
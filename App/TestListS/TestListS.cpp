@@ -5,8 +5,37 @@
 #include "Unitest/Assertions.h"
 
 #include "List/ListS.h"
+#include "List/ListPersistante.h"
+#include "List/ListChargement.h"
+#include "List/ListPartagee.h"
+#include "List/ListImmuable.h"
+#include "List/ListSIMD.h"
+#include "List/ListParcours.h"
+#include "List/ListIterateurs.h"
+#include "List/ListGenerique.h"
+#include "List/ListIntrusive.h"
+#include "List/ListPetite.h"
+#include "List/ListStatique.h"
+#include "List/ListPile.h"
+#include "List/ListFile.h"
+#include "List/ListEnsemble.h"
+#include "List/ListRecuperation.h"
+#include "List/ListFragmentee.h"
+#include "List/ListSegmentee.h"
+#include "List/ListCombinee.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <ranges>
 #include <string>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 // ============================================================================
@@ -1001,4 +1030,2039 @@ TEST_CASE(TestGestionMemoire) {
         
         NettoyerListe(&liste);
     }
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// TESTS DE LA LISTE PERSISTANTE (PROJECTION MÉMOIRE)
+// ============================================================================
+
+static std::string CheminTemporaire(const std::string& nom) {
+    return (std::filesystem::temp_directory_path() / nom).string();
+}
+
+TEST_CASE(TestPersistanteReouverture) {
+    std::string chemin = CheminTemporaire("TestPersistanteReouverture.liste");
+    std::remove(chemin.c_str());
+
+    ListePersistante* liste = OuvrirPersistante(chemin.c_str());
+    ASSERT_NOT_NULL(liste, "La liste persistante devrait être créée");
+    if (liste == nullptr) {
+        return;
+    }
+
+    // Assez d'éléments pour forcer plusieurs agrandissements du fichier
+    for (int i = 0; i < 1000; i++) {
+        InsererFin(liste, i);
+    }
+    InsererDebut(liste, -1);
+    ASSERT_TRUE(Synchroniser(liste), "La synchronisation devrait réussir");
+    FermerPersistante(liste);
+
+    liste = OuvrirPersistante(chemin.c_str());
+    ASSERT_NOT_NULL(liste, "La liste persistante devrait être rouverte");
+    if (liste != nullptr) {
+        ASSERT_EQUAL(1001, CompterElements(liste), "La taille devrait survivre à la réouverture");
+        ASSERT_EQUAL(-1, ResoudreNoeud(liste, ObtenirNoeudPosition(liste, 0))->donnee, "La tête devrait être -1");
+        ASSERT_EQUAL(999, ResoudreNoeud(liste, ObtenirNoeudPosition(liste, 1000))->donnee, "La queue devrait être 999");
+
+        DecalageP trouve = RechercherValeur(liste, 500);
+        ASSERT_NOT_EQUAL((DecalageP)0, trouve, "Devrait trouver la valeur 500");
+        ASSERT_EQUAL(500, ResoudreNoeud(liste, trouve)->donnee, "Le nœud trouvé devrait contenir 500");
+        ASSERT_EQUAL((DecalageP)0, RechercherValeur(liste, 5000), "Ne devrait pas trouver 5000");
+
+        FermerPersistante(liste);
+    }
+
+    std::remove(chemin.c_str());
+}
+
+TEST_CASE(TestPersistanteRecyclage) {
+    std::string chemin = CheminTemporaire("TestPersistanteRecyclage.liste");
+    std::remove(chemin.c_str());
+
+    ListePersistante* liste = OuvrirPersistante(chemin.c_str());
+    ASSERT_NOT_NULL(liste, "La liste persistante devrait être créée");
+    if (liste == nullptr) {
+        return;
+    }
+
+    InsererFin(liste, 10);
+    InsererFin(liste, 20);
+    InsererFin(liste, 30);
+
+    DecalageP noeud20 = RechercherValeur(liste, 20);
+    ASSERT_TRUE(SupprimerNoeud(liste, noeud20), "Suppression du nœud 20 devrait réussir");
+    ASSERT_TRUE(InsererTrie(liste, 25), "Insertion triée devrait réussir");
+    ASSERT_EQUAL(noeud20, RechercherValeur(liste, 25), "L'emplacement libéré devrait être réutilisé");
+
+    Inverser(liste);
+    ASSERT_EQUAL(30, ResoudreNoeud(liste, ObtenirNoeudPosition(liste, 0))->donnee, "La tête devrait être 30 après inversion");
+    ASSERT_EQUAL(10, ResoudreNoeud(liste, ObtenirNoeudPosition(liste, 2))->donnee, "La queue devrait être 10 après inversion");
+
+    Trier(liste);
+    const ListePersistante* lecture = liste;
+    ASSERT_TRUE(ToString(lecture).find("Noeud(10) -> Noeud(25) -> Noeud(30)") != std::string::npos,
+                "La liste devrait être triée");
+
+    RendreCirculaire(liste);
+    ASSERT_EQUAL(2, SupprimerToutesOccurrences(liste, 10) + SupprimerToutesOccurrences(liste, 30),
+                 "Devrait supprimer 10 et 30 dans la liste circulaire");
+    ASSERT_EQUAL(1, CompterElements(liste), "Il devrait rester un élément");
+
+    Nettoyer(liste);
+    ASSERT_TRUE(EstVide(liste), "La liste devrait être vide après nettoyage");
+
+    FermerPersistante(liste);
+    std::remove(chemin.c_str());
+}
+
+// ============================================================================
+// TESTS DU CHARGEMENT DE TEXTE
+// ============================================================================
+
+TEST_CASE(TestChargerTexte) {
+    std::string chemin = CheminTemporaire("TestChargerTexte.txt");
+    {
+        std::ofstream fichier(chemin, std::ios::binary);
+        fichier << "1,2, 3\n4;abc\r\n-5,99999999999,+6,+-8,++9\n\n7";
+    }
+
+    ListeSimple liste;
+    liste.queue = nullptr;
+    liste.tete = nullptr;
+    if (InitialiserListe(&liste, "TestChargerTexte")) {
+        InsererFin(&liste, 0);
+
+        long long rejetes = 0;
+        long long inseres = ChargerTexte(chemin.c_str(), &liste, &rejetes);
+        ASSERT_EQUAL(7LL, inseres, "Devrait insérer 7 valeurs");
+        ASSERT_EQUAL(4LL, rejetes, "Devrait rejeter 'abc', la valeur hors limites et les signes doublés");
+        ASSERT_EQUAL(8, liste.taille, "La taille devrait inclure l'élément existant");
+        ASSERT_EQUAL(0, liste.tete->donnee, "L'élément existant devrait rester en tête");
+        ASSERT_EQUAL(-5, ObtenirNoeudPosition(&liste, 5)->donnee, "Le sixième élément devrait être -5");
+        ASSERT_EQUAL(7, liste.queue->donnee, "La queue devrait être 7");
+
+        NettoyerListe(&liste);
+    }
+
+    ASSERT_EQUAL(-1LL, ChargerTexte("fichier/inexistant.txt", &liste, nullptr), "Un fichier absent devrait échouer");
+    std::remove(chemin.c_str());
+}
+
+TEST_CASE(TestChargerTexteGrosFichier) {
+    // Plusieurs tampons complets : les jetons coupés entre deux blocs doivent être recollés
+    std::string chemin = CheminTemporaire("TestChargerTexteGrosFichier.txt");
+    const int nombre = 400000;
+    long long sommeAttendue = 0;
+    {
+        std::ofstream fichier(chemin, std::ios::binary);
+        for (int i = 0; i < nombre; i++) {
+            fichier << (int)((i * 7919LL) % 1000003) << (i % 3 == 0 ? "\n" : ",");
+            sommeAttendue += (int)((i * 7919LL) % 1000003);
+        }
+    }
+
+    ListeSimple* liste = CreerEtValiderListe("TestChargerTexteGrosFichier");
+    if (liste != nullptr) {
+        InsererFin(liste, 0);
+        RendreCirculaire(liste);
+        long long rejetes = -1;
+        ASSERT_EQUAL((long long)nombre, ChargerTexte(chemin.c_str(), liste, &rejetes), "Toutes les valeurs devraient être insérées");
+        ASSERT_EQUAL(0LL, rejetes, "Aucun jeton ne devrait être rejeté");
+
+        long long somme = 0;
+        NoeudS* courant = liste->tete;
+        for (int i = 0; i < liste->taille; i++) {
+            somme += courant->donnee;
+            courant = courant->suivant;
+        }
+        ASSERT_EQUAL(sommeAttendue, somme, "La somme des valeurs devrait être conservée");
+        ASSERT_EQUAL(liste->tete, liste->queue->suivant, "La liste devrait rester circulaire");
+
+        DetruireListe(liste);
+    }
+    std::remove(chemin.c_str());
+}
+
+// ============================================================================
+// TESTS DE LA COPIE SUR ÉCRITURE
+// ============================================================================
+
+TEST_CASE(TestPartageeCopierO1) {
+    ListeSimple* source = CreerEtValiderListe("TestPartageeCopierO1");
+    if (source == nullptr) {
+        return;
+    }
+    for (int i = 0; i < 6; i++) {
+        InsererFin(source, i * 10);
+    }
+
+    ListePartagee* originale = ConvertirEnPartagee(source);
+    ListePartagee* copie = Copier(originale);
+    ASSERT_NOT_NULL(copie, "La copie devrait être créée");
+    ASSERT_EQUAL(originale->tete, copie->tete, "La copie devrait partager la tête");
+    ASSERT_EQUAL(6, CompterElements(copie), "La copie devrait avoir 6 éléments");
+
+    // Seul le préfixe 0..2 doit être recopié
+    ASSERT_TRUE(ModifierPosition(copie, 2, 99), "La modification devrait réussir");
+    ASSERT_EQUAL(99, ObtenirNoeudPosition(copie, 2)->donnee, "La copie devrait voir 99");
+    ASSERT_EQUAL(20, ObtenirNoeudPosition(originale, 2)->donnee, "L'originale ne devrait pas changer");
+    ASSERT_NOT_EQUAL(ObtenirNoeudPosition(originale, 0), ObtenirNoeudPosition(copie, 0), "Le préfixe devrait être recopié");
+    ASSERT_EQUAL(ObtenirNoeudPosition(originale, 3), ObtenirNoeudPosition(copie, 3), "Le suffixe devrait rester partagé");
+    ASSERT_EQUAL(originale->queue, copie->queue, "La queue devrait rester partagée");
+
+    // Les opérations en tête ne recopient rien
+    ASSERT_TRUE(SupprimerDebut(copie), "La suppression en tête devrait réussir");
+    ASSERT_TRUE(InsererDebut(copie, -1), "L'insertion en tête devrait réussir");
+    ASSERT_EQUAL(0, ObtenirNoeudPosition(originale, 0)->donnee, "L'originale devrait garder sa tête");
+
+    Detruire(originale);
+    Detruire(copie);
+    DetruireListe(source);
+}
+
+TEST_CASE(TestPartageeModificationsFin) {
+    ListePartagee* originale = AllocatePartagee();
+    InsererFin(originale, 1);
+    InsererFin(originale, 2);
+    InsererFin(originale, 3);
+
+    ListePartagee* copie = Copier(originale);
+    ASSERT_TRUE(InsererFin(copie, 4), "L'insertion en fin devrait réussir");
+    ASSERT_TRUE(SupprimerValeur(copie, 2), "La suppression de 2 devrait réussir");
+    ASSERT_TRUE(InsererPosition(copie, 1, 7), "L'insertion en position 1 devrait réussir");
+    ASSERT_FALSE(SupprimerValeur(copie, 42), "La suppression d'une valeur absente devrait échouer");
+
+    const ListePartagee* lectureOriginale = originale;
+    const ListePartagee* lectureCopie = copie;
+    ASSERT_EQUAL(std::string("ListePartagee[Noeud(1) -> Noeud(2) -> Noeud(3)]"), ToString(lectureOriginale),
+                 "L'originale ne devrait pas changer");
+    ASSERT_EQUAL(std::string("ListePartagee[Noeud(1) -> Noeud(7) -> Noeud(3) -> Noeud(4)]"), ToString(lectureCopie),
+                 "La copie devrait refléter ses modifications");
+    ASSERT_EQUAL(4, copie->queue->donnee, "La queue de la copie devrait être 4");
+    ASSERT_EQUAL(3, originale->queue->donnee, "La queue de l'originale devrait rester 3");
+
+    // La destruction de l'originale ne doit pas libérer les nœuds encore utilisés
+    Detruire(originale);
+    ListeSimple* simple = ConvertirEnSimple(copie);
+    ASSERT_EQUAL(4, simple->taille, "La conversion devrait conserver 4 éléments");
+    ASSERT_EQUAL(1, RechercherValeur(copie, 7), "7 devrait être en position 1");
+
+    DetruireListe(simple);
+    Detruire(copie);
+}
+
+TEST_CASE(TestPartageeInsererFinExclusive) {
+    ListePartagee* originale = AllocatePartagee();
+    for (int i = 0; i < 4; i++) {
+        InsererFin(originale, i);
+    }
+    ASSERT_EQUAL(4, originale->exclusifs.load(), "Une liste construite par la fin devrait être entièrement exclusive");
+
+    // La copie rend la tête à une seule référence en la supprimant, mais la
+    // queue reste partagée : l'ajout en fin de l'originale doit la recopier
+    ListePartagee* copie = Copier(originale);
+    ASSERT_EQUAL(0, originale->exclusifs.load(), "Copier devrait invalider le préfixe exclusif de la source");
+    ASSERT_TRUE(SupprimerDebut(copie), "La suppression en tête devrait réussir");
+    ASSERT_TRUE(InsererFin(originale, 4), "L'insertion en fin devrait réussir");
+    ASSERT_EQUAL(std::string("ListePartagee[Noeud(1) -> Noeud(2) -> Noeud(3)]"), ToString((const ListePartagee*)copie),
+                 "La copie ne devrait pas voir l'ajout");
+    ASSERT_EQUAL(5, originale->exclusifs.load(), "L'originale devrait redevenir entièrement exclusive");
+    ASSERT_NOT_EQUAL(originale->queue, copie->queue, "Les queues devraient être distinctes");
+
+    ListeSimple* simple = ConvertirEnSimple(originale);
+    ASSERT_EQUAL(5, simple->taille, "La conversion devrait conserver 5 éléments");
+    ASSERT_EQUAL(4, simple->queue->donnee, "La queue convertie devrait être 4");
+
+    DetruireListe(simple);
+    Detruire(originale);
+    Detruire(copie);
+}
+
+TEST_CASE(TestPartageeCopiesConcurrentes) {
+    ListePartagee* originale = AllocatePartagee();
+    for (int i = 0; i < 64; i++) {
+        InsererFin(originale, i);
+    }
+    const ListePartagee* lecture = originale;
+    std::string reference = ToString(lecture);
+
+    // Plusieurs threads copient la même source et modifient chacun leur copie
+    std::atomic<int> conformes(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&, t]() {
+            for (int r = 0; r < 200; r++) {
+                ListePartagee* copie = Copier(lecture);
+                bool ok = copie != nullptr && InsererFin(copie, 1000 + t) && ModifierPosition(copie, r % 64, -t);
+                ok = ok && ObtenirNoeudPosition(copie, 64)->donnee == 1000 + t;
+                conformes += ok;
+                Detruire(copie);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQUAL(800, conformes.load(), "Chaque copie devrait voir ses propres modifications");
+    ASSERT_EQUAL(reference, ToString(lecture), "La source ne devrait pas changer");
+    ASSERT_TRUE(InsererFin(originale, 64), "La source reste modifiable après les copies");
+    ASSERT_EQUAL(65, CompterElements(originale), "La source devrait avoir 65 éléments");
+    Detruire(originale);
+}
+
+// ============================================================================
+// TESTS DE LA LISTE IMMUABLE
+// ============================================================================
+
+TEST_CASE(TestImmuableVersions) {
+    ListeImmuable v1 = CreerImmuable();
+    Prefixer(&v1, 3, &v1);
+    Prefixer(&v1, 2, &v1);
+    Prefixer(&v1, 1, &v1);
+
+    ListeImmuable v2 = Instantane(&v1);
+    ASSERT_EQUAL(v1.tete, v2.tete, "L'instantané devrait partager la tête");
+
+    ListeImmuable v3 = CreerImmuable();
+    ASSERT_TRUE(Prefixer(&v1, 0, &v3), "Le préfixage devrait réussir");
+    ASSERT_EQUAL(v1.tete, v3.tete->suivant, "La nouvelle version devrait partager la queue de v1");
+
+    ListeImmuable v4 = CreerImmuable();
+    ASSERT_TRUE(InsererPosition(&v1, 2, 9, &v4), "L'insertion devrait réussir");
+    ASSERT_TRUE(SupprimerPosition(&v4, 0, &v4), "La suppression devrait réussir");
+    ASSERT_EQUAL(std::string("ListeImmuable[Noeud(2) -> Noeud(9) -> Noeud(3)]"), ToString((const ListeImmuable*)&v4),
+                 "v4 devrait contenir 2, 9, 3");
+    ASSERT_EQUAL(std::string("ListeImmuable[Noeud(1) -> Noeud(2) -> Noeud(3)]"), ToString((const ListeImmuable*)&v1),
+                 "v1 ne devrait pas changer");
+
+    Liberer(&v1);
+    ListeImmuable v5 = CreerImmuable();
+    ASSERT_TRUE(Reste(&v2, &v5), "Le reste devrait réussir");
+    int premier = 0;
+    ASSERT_TRUE(Premier(&v5, &premier), "v5 ne devrait pas être vide");
+    ASSERT_EQUAL(2, premier, "Le premier élément de v5 devrait être 2");
+    ASSERT_EQUAL(1, RechercherValeur(&v5, 3), "3 devrait être en position 1 dans v5");
+    ASSERT_EQUAL(3, CompterElements(&v2), "v2 devrait garder 3 éléments");
+
+    Liberer(&v2);
+    Liberer(&v3);
+    Liberer(&v4);
+    Liberer(&v5);
+    ASSERT_TRUE(EstVide(&v5), "Une version libérée devrait être vide");
+}
+
+TEST_CASE(TestImmuableConversionEtLiberationLongue) {
+    ListeSimple* source = CreerEtValiderListe("TestImmuableConversion");
+    if (source == nullptr) {
+        return;
+    }
+    for (int i = 0; i < 5; i++) {
+        InsererFin(source, i);
+    }
+
+    ListeImmuable version = CreerImmuable();
+    ASSERT_TRUE(ConvertirEnImmuable(source, &version), "La conversion devrait réussir");
+    ListeSimple* retour = ConvertirEnSimple(&version);
+    ASSERT_EQUAL(5, retour->taille, "L'aller-retour devrait conserver 5 éléments");
+    ASSERT_EQUAL(4, retour->queue->donnee, "La queue devrait être 4");
+    DetruireListe(retour);
+    DetruireListe(source);
+    Liberer(&version);
+
+    // Une chaîne très longue doit être libérée sans débordement de pile,
+    // pendant qu'un lecteur parcourt son propre instantané.
+    for (int i = 0; i < 1000000; i++) {
+        Prefixer(&version, i, &version);
+    }
+    ListeImmuable instantane = Instantane(&version);
+    long long somme = 0;
+    std::thread lecteur([&]() {
+        for (const NoeudI* courant = instantane.tete; courant != nullptr; courant = courant->suivant) {
+            somme += courant->donnee;
+        }
+    });
+    for (int i = 0; i < 1000; i++) {
+        Prefixer(&version, -i, &version);
+    }
+    lecteur.join();
+    ASSERT_EQUAL(499999500000LL, somme, "L'instantané ne devrait pas voir les écritures suivantes");
+
+    Liberer(&instantane);
+    Liberer(&version);
+    ASSERT_TRUE(EstVide(&version), "La version devrait être vide après libération");
+}
+
+
+// ============================================================================
+// TESTS DES ROTATIONS
+// ============================================================================
+
+TEST_CASE(TestRotationSimple) {
+    ListeSimple* liste = CreerEtValiderListe("TestRotationSimple");
+    if (liste == nullptr) {
+        return;
+    }
+    for (int i = 1; i <= 5; i++) {
+        InsererFin(liste, i);
+    }
+    const ListeSimple* lecture = liste;
+
+    RotationGauche(liste, 2);
+    ASSERT_EQUAL(std::string("Liste[Noeud(3) -> Noeud(4) -> Noeud(5) -> Noeud(1) -> Noeud(2)]"),
+                 ToString(lecture), "Rotation gauche de 2 incorrecte");
+    ASSERT_NULL(liste->queue->suivant, "La queue d'une liste linéaire doit rester terminée");
+
+    RotationDroite(liste, 12); // 12 mod 5 = 2
+    ASSERT_EQUAL(1, liste->tete->donnee, "Rotation droite modulo taille incorrecte");
+    ASSERT_EQUAL(5, liste->queue->donnee, "Queue après rotation droite incorrecte");
+
+    RotationGauche(liste, -1);
+    ASSERT_EQUAL(5, liste->tete->donnee, "Un décalage négatif doit tourner vers la droite");
+    RotationGauche(liste, 5);
+    ASSERT_EQUAL(5, liste->tete->donnee, "Une rotation de taille ne doit rien changer");
+
+    DetruireListe(liste);
+}
+
+TEST_CASE(TestRotationSimpleCirculaire) {
+    ListeSimple* liste = CreerEtValiderListe("TestRotationSimpleCirculaire");
+    if (liste == nullptr) {
+        return;
+    }
+    for (int i = 1; i <= 4; i++) {
+        InsererFin(liste, i);
+    }
+    RendreCirculaire(liste);
+
+    NoeudS* premier = liste->tete;
+    RotationDroite(liste, 1);
+    ASSERT_EQUAL(4, liste->tete->donnee, "Tête après rotation circulaire incorrecte");
+    ASSERT_EQUAL(premier, liste->tete->suivant, "Les liens ne doivent pas changer");
+    ASSERT_EQUAL(liste->tete, liste->queue->suivant, "L'anneau doit rester fermé");
+    ASSERT_TRUE(liste->estCirculaire, "La liste doit rester circulaire");
+
+    DetruireListe(liste);
+}
+
+
+// ============================================================================
+// TESTS DE L'ANALYSE DE CYCLE
+// ============================================================================
+
+TEST_CASE(TestAnalyserCycleSimple) {
+    ListeSimple* liste = CreerEtValiderListe("TestAnalyserCycleSimple");
+    if (liste == nullptr) {
+        return;
+    }
+
+    AnalyseCycleS vide = AnalyserCycle(liste);
+    ASSERT_FALSE(vide.present, "Une liste vide ne boucle pas");
+    ASSERT_EQUAL(0, vide.longueurQueue, "Une liste vide n'a aucun nœud");
+
+    for (int i = 0; i < 7; i++) {
+        InsererFin(liste, i);
+    }
+
+    AnalyseCycleS lineaire = AnalyserCycle(liste);
+    ASSERT_FALSE(lineaire.present, "Une liste linéaire ne boucle pas");
+    ASSERT_NULL(lineaire.entree, "Pas d'entrée sans cycle");
+    ASSERT_EQUAL(7, lineaire.longueurQueue, "La chaîne entière devrait être comptée");
+
+    RendreCirculaire(liste);
+    AnalyseCycleS circulaire = AnalyserCycle(liste);
+    ASSERT_TRUE(circulaire.present, "Une liste circulaire boucle");
+    ASSERT_EQUAL(liste->tete, circulaire.entree, "L'entrée d'une liste circulaire est la tête");
+    ASSERT_EQUAL(7, circulaire.longueurCycle, "Le cycle couvre toute la liste");
+    ASSERT_EQUAL(0, circulaire.longueurQueue, "Aucun nœud avant l'entrée");
+    RendreLineaire(liste);
+
+    // Corruption : la queue reboucle sur le nœud 2
+    NoeudS* entree = ObtenirNoeudPosition(liste, 2);
+    liste->queue->suivant = entree;
+    ASSERT_TRUE(ContientCycle(liste), "Le cycle corrompu devrait être détecté");
+    AnalyseCycleS corrompue = AnalyserCycle(liste);
+    ASSERT_TRUE(corrompue.present, "Le cycle corrompu devrait être présent");
+    ASSERT_EQUAL(entree, corrompue.entree, "L'entrée du cycle devrait être le nœud 2");
+    ASSERT_EQUAL(5, corrompue.longueurCycle, "Le cycle devrait compter 5 nœuds");
+    ASSERT_EQUAL(2, corrompue.longueurQueue, "Deux nœuds précèdent l'entrée");
+
+    // Boucle sur soi-même
+    liste->queue->suivant = liste->queue;
+    corrompue = AnalyserCycle(liste);
+    ASSERT_EQUAL(liste->queue, corrompue.entree, "L'entrée devrait être la queue");
+    ASSERT_EQUAL(1, corrompue.longueurCycle, "Une boucle sur soi compte un nœud");
+    ASSERT_EQUAL(6, corrompue.longueurQueue, "Six nœuds précèdent la queue");
+
+    liste->queue->suivant = nullptr;
+    DetruireListe(liste);
+}
+
+
+// ============================================================================
+// TESTS DU MOTEUR DE RECHERCHE VECTORIEL
+// ============================================================================
+
+TEST_CASE(TestSIMDTableauxTousNiveaux) {
+    std::vector<int> valeurs(77);
+    for (int i = 0; i < (int)valeurs.size(); i++) {
+        valeurs[i] = i % 5;
+    }
+
+    for (int niveau = SIMD_SCALAIRE; niveau <= NiveauSIMDDisponible(); niveau++) {
+        ForcerNiveauSIMD((NiveauSIMD)niveau);
+        std::string contexte = " (niveau " + std::to_string(niveau) + ")";
+
+        // Chaque longueur exerce une combinaison différente de blocs et de reste
+        for (int nombre = 0; nombre <= (int)valeurs.size(); nombre++) {
+            int attendu = 0;
+            for (int i = 0; i < nombre; i++) {
+                attendu += (valeurs[i] == 3);
+            }
+            ASSERT_EQUAL(attendu, CompterEntier(valeurs.data(), nombre, 3), "Comptage incorrect" + contexte);
+        }
+
+        for (int cible = 0; cible < (int)valeurs.size(); cible++) {
+            valeurs[cible] = 42;
+            ASSERT_EQUAL(cible, ChercherEntier(valeurs.data(), (int)valeurs.size(), 42), "Position trouvée incorrecte" + contexte);
+            valeurs[cible] = cible % 5;
+        }
+        ASSERT_EQUAL(-1, ChercherEntier(valeurs.data(), (int)valeurs.size(), 42), "Valeur absente" + contexte);
+    }
+
+    ForcerNiveauSIMD(NiveauSIMDDisponible());
+    ASSERT_EQUAL((int)NiveauSIMDDisponible(), (int)NiveauSIMDActif(), "Le niveau détecté devrait être rétabli");
+}
+
+TEST_CASE(TestSIMDSerieDeNoeudsContigus) {
+    // Nœuds placés à pas constant : la recherche passe par le moteur vectoriel
+    std::vector<NoeudS> noeuds(50);
+    for (int i = 0; i < 50; i++) {
+        noeuds[i].donnee = i % 7;
+        noeuds[i].suivant = (i + 1 < 50) ? &noeuds[i + 1] : nullptr;
+    }
+    ASSERT_EQUAL(50, MesurerSerie(&noeuds[0], sizeof(NoeudS), offsetof(NoeudS, suivant), 50), "La série devrait couvrir tous les nœuds");
+
+    // Rupture de la série après le nœud 20 : un détour remplace le nœud 21
+    NoeudS detour;
+    detour.donnee = 99;
+    detour.suivant = &noeuds[22];
+    noeuds[20].suivant = &detour;
+    ASSERT_EQUAL(21, MesurerSerie(&noeuds[0], sizeof(NoeudS), offsetof(NoeudS, suivant), 50), "La série devrait s'arrêter au détour");
+
+    ListeSimple liste;
+    liste.tete = &noeuds[0];
+    liste.queue = &noeuds[49];
+    liste.taille = 50; // 49 nœuds du tableau + le détour
+    liste.estCirculaire = false;
+    liste.estAllouee = false;
+    liste.sauts = nullptr;
+    liste.capaciteSauts = 0;
+
+    for (int niveau = SIMD_SCALAIRE; niveau <= NiveauSIMDDisponible(); niveau++) {
+        ForcerNiveauSIMD((NiveauSIMD)niveau);
+        std::string contexte = " (niveau " + std::to_string(niveau) + ")";
+
+        ASSERT_EQUAL(&noeuds[6], RechercherValeur(&liste, 6), "Première occurrence incorrecte" + contexte);
+        ASSERT_EQUAL(&detour, RechercherValeur(&liste, 99), "Le détour devrait être trouvé" + contexte);
+        ASSERT_NULL(RechercherValeur(&liste, 1000), "Valeur absente" + contexte);
+
+        int count = 0;
+        NoeudS** occurrences = RechercherToutesOccurrences(&liste, 0, &count);
+        ASSERT_EQUAL(7, count, "Nombre d'occurrences incorrect" + contexte); // 0, 7, ..., 49 sauf 21
+        if (occurrences != nullptr) {
+            ASSERT_EQUAL(&noeuds[28], occurrences[3], "Quatrième occurrence incorrecte" + contexte);
+            ASSERT_NULL(occurrences[count], "Le tableau devrait être terminé par NULL" + contexte);
+            free(occurrences);
+        }
+    }
+
+    ForcerNiveauSIMD(NiveauSIMDDisponible());
+}
+
+TEST_CASE(TestSIMDSerieParTroncons) {
+    // Série plus longue qu'un tronçon : chaque tronçon est comparé dès qu'il est mesuré
+    const int nombre = 4 * LISTE_SIMD_TRONCON + 5;
+    std::vector<NoeudS> noeuds(nombre);
+    for (int i = 0; i < nombre; i++) {
+        noeuds[i].donnee = i;
+        noeuds[i].suivant = (i + 1 < nombre) ? &noeuds[i + 1] : nullptr;
+    }
+    ASSERT_EQUAL(LISTE_SIMD_TRONCON, MesurerSerie(&noeuds[0], sizeof(NoeudS), offsetof(NoeudS, suivant), LISTE_SIMD_TRONCON), "La mesure devrait s'arrêter au maximum");
+
+    ListeSimple liste;
+    liste.tete = &noeuds[0];
+    liste.queue = &noeuds[nombre - 1];
+    liste.taille = nombre;
+    liste.estCirculaire = false;
+    liste.estAllouee = false;
+    liste.sauts = nullptr;
+    liste.capaciteSauts = 0;
+
+    const int positions[] = {0, LISTE_SIMD_TRONCON - 1, LISTE_SIMD_TRONCON, LISTE_SIMD_TRONCON + 1, 3 * LISTE_SIMD_TRONCON + 7, nombre - 1};
+    for (int position : positions) {
+        ASSERT_EQUAL(&noeuds[position], RechercherValeur(&liste, position), "Occurrence en position " + std::to_string(position) + " manquée");
+    }
+
+    // Une occurrence de part et d'autre de chaque frontière de tronçon
+    for (int i = 0; i < nombre; i++) {
+        noeuds[i].donnee = (i % LISTE_SIMD_TRONCON == 0 || i % LISTE_SIMD_TRONCON == LISTE_SIMD_TRONCON - 1) ? -1 : i;
+    }
+    int count = 0;
+    NoeudS** occurrences = RechercherToutesOccurrences(&liste, -1, &count);
+    ASSERT_EQUAL(9, count, "Nombre d'occurrences incorrect"); // 4 tronçons complets et le début du cinquième
+    if (occurrences != nullptr) {
+        ASSERT_EQUAL(&noeuds[LISTE_SIMD_TRONCON - 1], occurrences[1], "Deuxième occurrence incorrecte");
+        ASSERT_EQUAL(&noeuds[LISTE_SIMD_TRONCON], occurrences[2], "Troisième occurrence incorrecte");
+        free(occurrences);
+    }
+}
+
+TEST_CASE(TestSIMDSupprimerToutesOccurrences) {
+    ListeSimple* liste = CreerEtValiderListe("TestSIMDSupprimerToutesOccurrences");
+    if (liste == nullptr) {
+        return;
+    }
+
+    for (int i = 0; i < 300; i++) {
+        InsererFin(liste, i % 3);
+    }
+    RendreCirculaire(liste);
+
+    ASSERT_EQUAL(100, SupprimerToutesOccurrences(liste, 0), "Cent zéros devraient être supprimés");
+    ASSERT_EQUAL(200, liste->taille, "Taille après suppression incorrecte");
+    ASSERT_EQUAL(1, liste->tete->donnee, "La tête devrait être 1");
+    ASSERT_EQUAL(liste->tete, liste->queue->suivant, "La liste devrait rester circulaire");
+    ASSERT_NULL(RechercherValeur(liste, 0), "Plus aucun zéro ne devrait rester");
+
+    ASSERT_EQUAL(100, SupprimerToutesOccurrences(liste, 2), "Cent deux devraient être supprimés");
+    ASSERT_EQUAL(100, SupprimerToutesOccurrences(liste, 1), "Cent uns devraient être supprimés");
+    ASSERT_TRUE(EstVide(liste), "La liste devrait être vide");
+
+    DetruireListe(liste);
+}
+
+TEST_CASE(TestSIMDPersistante) {
+    std::string chemin = CheminTemporaire("TestSIMDPersistante.liste");
+    std::remove(chemin.c_str());
+
+    ListePersistante* liste = OuvrirPersistante(chemin.c_str());
+    ASSERT_NOT_NULL(liste, "La liste persistante devrait être créée");
+    if (liste == nullptr) {
+        return;
+    }
+
+    // Nœuds alloués à la suite dans le fichier : longues séries de pas 16
+    for (int i = 0; i < 500; i++) {
+        InsererFin(liste, i % 10);
+    }
+    InsererDebut(liste, 77);
+
+    ASSERT_EQUAL(77, ResoudreNoeud(liste, RechercherValeur(liste, 77))->donnee, "La tête hors série devrait être trouvée");
+    ASSERT_EQUAL(ObtenirNoeudPosition(liste, 10), RechercherValeur(liste, 9), "Première occurrence de 9 incorrecte");
+    ASSERT_EQUAL(50, SupprimerToutesOccurrences(liste, 4), "Cinquante 4 devraient être supprimés");
+    ASSERT_EQUAL((DecalageP)0, RechercherValeur(liste, 4), "Plus aucun 4 ne devrait rester");
+    ASSERT_EQUAL(451, CompterElements(liste), "Taille après suppression incorrecte");
+    ASSERT_EQUAL(5, ResoudreNoeud(liste, ObtenirNoeudPosition(liste, 5))->donnee, "Ordre après suppression incorrect");
+
+    FermerPersistante(liste);
+    std::remove(chemin.c_str());
+}
+
+
+// ============================================================================
+// TESTS DU MOTEUR DE PARCOURS AVEC PRÉCHARGEMENT
+// ============================================================================
+
+TEST_CASE(TestParcoursSautsResultatsIdentiques) {
+    ListeSimple* liste = CreerEtValiderListe("TestParcoursSautsResultatsIdentiques");
+    if (liste == nullptr) {
+        return;
+    }
+
+    // Insertions en tête et au milieu : l'ordre de la liste ne suit pas les adresses
+    for (int i = 0; i < 200; i++) {
+        if (i % 3 == 0) {
+            InsererDebut(liste, i);
+        } else {
+            InsererPosition(liste, liste->taille / 2, i);
+        }
+    }
+    const ListeSimple* lecture = liste;
+    std::string reference = ToString(lecture);
+    NoeudS* position150 = ObtenirNoeudPosition(liste, 150);
+
+    ASSERT_FALSE(SautsActifs(liste), "Les sauts sont optionnels");
+    ASSERT_TRUE(ActiverSauts(liste), "L'activation des sauts devrait réussir");
+    ASSERT_TRUE(SautsActifs(liste), "Les sauts devraient être actifs");
+
+    for (int distance = 0; distance <= 32; distance += 8) {
+        DefinirDistancePrefetch(distance);
+        std::string contexte = " (distance " + std::to_string(distance) + ")";
+        ASSERT_EQUAL(reference, ToString(lecture), "Le parcours devrait être inchangé" + contexte);
+        ASSERT_EQUAL(position150, ObtenirNoeudPosition(liste, 150), "Position 150 incorrecte" + contexte);
+        ASSERT_EQUAL(position150, TrouverPrecedent(liste, position150->suivant), "Précédent incorrect" + contexte);
+        ASSERT_NOT_NULL(RechercherValeur(liste, 99), "La valeur 99 devrait être trouvée" + contexte);
+    }
+    DefinirDistancePrefetch(DISTANCE_PREFETCH_DEFAUT);
+    ASSERT_EQUAL(DISTANCE_PREFETCH_DEFAUT, ObtenirDistancePrefetch(), "La distance par défaut devrait être rétablie");
+
+    DetruireListe(liste);
+}
+
+TEST_CASE(TestParcoursSautsApresModifications) {
+    ListeSimple* liste = CreerEtValiderListe("TestParcoursSautsApresModifications");
+    if (liste == nullptr) {
+        return;
+    }
+
+    for (int i = 0; i < 100; i++) {
+        InsererFin(liste, i);
+    }
+    ActiverSauts(liste);
+    ASSERT_NOT_NULL(RechercherValeur(liste, 99), "Le premier parcours remplit la table");
+
+    // La table devient périmée : elle ne sert que d'indice, le résultat reste exact
+    for (int i = 0; i < 50; i++) {
+        SupprimerPosition(liste, 10);
+    }
+    for (int i = 0; i < 30; i++) {
+        InsererPosition(liste, 5, 1000 + i);
+    }
+    ASSERT_EQUAL(80, liste->taille, "Taille après modifications incorrecte");
+    ASSERT_EQUAL(1029, ObtenirNoeudPosition(liste, 5)->donnee, "Position 5 incorrecte");
+    ASSERT_EQUAL(99, ObtenirNoeudPosition(liste, 79)->donnee, "Dernière position incorrecte");
+    int retrouvees = 0;
+    for (int i = 0; i < 30; i++) {
+        retrouvees += (RechercherValeur(liste, 1000 + i) != nullptr);
+    }
+    ASSERT_EQUAL(30, retrouvees, "Les insertions devraient être retrouvées");
+
+    ListeSimple* copie = Copier(liste);
+    ASSERT_NOT_NULL(copie, "La copie devrait réussir");
+    if (copie != nullptr) {
+        ASSERT_EQUAL(liste->taille, copie->taille, "La copie devrait avoir la même taille");
+        DetruireListe(copie);
+    }
+
+    Nettoyer(liste);
+    ASSERT_FALSE(SautsActifs(liste), "Nettoyer devrait rendre la table");
+    InsererFin(liste, 7);
+    ASSERT_NOT_NULL(RechercherValeur(liste, 7), "La liste vidée devrait rester utilisable");
+
+    // La table suit les insertions au-delà de sa capacité initiale
+    ASSERT_TRUE(ActiverSauts(liste), "La réactivation devrait réussir");
+    for (int i = 0; i < 500; i++) {
+        InsererFin(liste, i);
+    }
+    ASSERT_TRUE(liste->capaciteSauts >= liste->taille, "La table devrait couvrir toute la liste");
+    ASSERT_NOT_NULL(RechercherValeur(liste, 499), "La dernière valeur devrait être trouvée");
+
+    DesactiverSauts(liste);
+    ASSERT_FALSE(SautsActifs(liste), "La table devrait être rendue");
+    DetruireListe(liste);
+}
+
+TEST_CASE(TestParcoursSautsDiviser) {
+    ListeSimple* liste = CreerEtValiderListe("TestParcoursSautsDiviser");
+    if (liste == nullptr) {
+        return;
+    }
+    for (int i = 0; i < 40; i++) {
+        InsererFin(liste, i);
+    }
+    ActiverSauts(liste);
+    ASSERT_NOT_NULL(RechercherValeur(liste, 39), "Le parcours remplit la table");
+
+    ListeSimple seconde;
+    seconde.tete = nullptr;
+    InitialiserListe(&seconde, "TestParcoursSautsDiviser");
+    Diviser(liste, 10, &seconde);
+    ASSERT_FALSE(SautsActifs(&seconde), "La seconde liste part sans table");
+    bool effacees = true;
+    for (int i = 10; i < liste->capaciteSauts; i++) {
+        effacees = effacees && liste->sauts[i] == nullptr;
+    }
+    ASSERT_TRUE(effacees, "Les entrées au-delà de la coupe devraient être effacées");
+    ASSERT_EQUAL(liste->tete, liste->sauts[0], "Les entrées avant la coupe restent");
+
+    Concatener(liste, &seconde);
+    ASSERT_TRUE(liste->capaciteSauts >= liste->taille, "La table devrait suivre la concaténation");
+    ASSERT_NOT_NULL(RechercherValeur(liste, 39), "La dernière valeur devrait être trouvée");
+
+    Nettoyer(&seconde);
+    DetruireListe(liste);
+}
+
+TEST_CASE(TestParcoursSautsLecteursConcurrents) {
+    ListeSimple* liste = CreerEtValiderListe("TestParcoursSautsLecteursConcurrents");
+    if (liste == nullptr) {
+        return;
+    }
+    for (int i = 0; i < 2000; i++) {
+        InsererFin(liste, i);
+    }
+    ActiverSauts(liste);
+
+    // Les lecteurs se partagent la table sans verrou : elle n'est jamais réallouée pendant un parcours
+    std::atomic<int> trouvees(0);
+    std::vector<std::thread> lecteurs;
+    for (int t = 0; t < 4; t++) {
+        lecteurs.emplace_back([&]() {
+            for (int r = 0; r < 20; r++) {
+                trouvees += (RechercherValeur(liste, 1999) != nullptr);
+            }
+        });
+    }
+    for (std::thread& lecteur : lecteurs) {
+        lecteur.join();
+    }
+    ASSERT_EQUAL(80, trouvees.load(), "Chaque lecteur devrait trouver la valeur");
+
+    DetruireListe(liste);
+}
+
+// ============================================================================
+// TESTS DES ITÉRATEURS
+// ============================================================================
+
+static_assert(std::forward_iterator<IterateurS>, "IterateurS doit être un itérateur avant");
+static_assert(std::forward_iterator<IterateurConstS>, "IterateurConstS doit être un itérateur avant");
+static_assert(std::ranges::forward_range<ListeSimple&>, "ListeSimple doit être une plage");
+static_assert(std::ranges::common_range<const ListeSimple&>, "begin et end doivent être de même type");
+
+TEST_CASE(TestIterateursParcours) {
+    ListeSimple* liste = CreerEtValiderListe("TestIterateursParcours");
+    if (!liste) return;
+
+    int somme = 0;
+    for (int valeur : *liste) {
+        somme += valeur;
+    }
+    ASSERT_EQUAL(0, somme, "Une liste vide ne devrait rien parcourir");
+
+    for (int i = 1; i <= 10; i++) {
+        InsererFin(liste, i);
+    }
+    for (int valeur : *liste) {
+        somme += valeur;
+    }
+    ASSERT_EQUAL(55, somme, "La somme de 1 à 10 devrait être 55");
+
+    const ListeSimple& lecture = *liste;
+    ASSERT_EQUAL(55, std::accumulate(begin(lecture), end(lecture), 0), "std::accumulate incorrect");
+
+    IterateurConstS trouve = std::find(begin(lecture), end(lecture), 7);
+    ASSERT_TRUE(trouve != end(lecture), "7 devrait être trouvé");
+    ASSERT_EQUAL(6, trouve.Index(), "7 devrait être en position 6");
+    ASSERT_EQUAL(7, trouve.Noeud()->donnee, "Le nœud exposé devrait contenir 7");
+    ASSERT_TRUE(std::find(begin(lecture), end(lecture), 42) == end(lecture), "42 ne devrait pas être trouvé");
+
+    for (int& valeur : *liste) {
+        valeur *= 2;
+    }
+    ASSERT_EQUAL(4, ObtenirNoeudPosition(liste, 1)->donnee, "Les valeurs devraient être modifiables");
+    ASSERT_EQUAL(5, std::ranges::count_if(*liste, [](int v) { return v > 10; }), "std::ranges::count_if incorrect");
+    ASSERT_EQUAL(10, (int)std::ranges::distance(*liste), "std::ranges::distance incorrect");
+
+    DetruireListe(liste);
+}
+
+TEST_CASE(TestIterateursCirculaire) {
+    ListeSimple* liste = CreerEtValiderListe("TestIterateursCirculaire");
+    if (!liste) return;
+
+    for (int i = 0; i < 6; i++) {
+        InsererFin(liste, i % 3);
+    }
+    RendreCirculaire(liste);
+
+    int visites = 0;
+    for (int valeur : *liste) {
+        (void)valeur;
+        visites++;
+    }
+    ASSERT_EQUAL(6, visites, "Une liste circulaire devrait être parcourue une seule fois");
+    ASSERT_EQUAL(2, (int)std::ranges::count(*liste, 1), "std::ranges::count incorrect");
+
+    auto premierDeux = std::ranges::find(*liste, 2);
+    ASSERT_EQUAL(2, premierDeux.Index(), "Le premier 2 devrait être en position 2");
+    ASSERT_TRUE(std::ranges::find(*liste, 9) == end(*liste), "9 ne devrait pas être trouvé");
+
+    RendreLineaire(liste);
+    DetruireListe(liste);
+}
+
+// ============================================================================
+// TESTS DE LA LISTE SIMPLE GÉNÉRIQUE
+// ============================================================================
+
+/**
+ * @brief Donnée qui compte ses instances vivantes
+ */
+struct Compteur {
+    static inline int vivants = 0;
+    int valeur;
+    explicit Compteur(int v) : valeur(v) { vivants++; }
+    Compteur(const Compteur& autre) : valeur(autre.valeur) { vivants++; }
+    ~Compteur() { vivants--; }
+    bool operator<(const Compteur& autre) const { return valeur < autre.valeur; }
+};
+
+TEST_CASE(TestGeneriqueChaines) {
+    ListeSimpleT<std::string>* liste = AllocateSimpleT<std::string>();
+    ASSERT_NOT_NULL(liste, "La liste générique devrait être créée");
+    if (!liste) return;
+
+    EmplacerFin(liste, "beta");
+    EmplacerDebut(liste, 3, 'a');
+    std::string gamma = "gamma";
+    InsererFin(liste, gamma);
+    InsererFin(liste, std::string("delta"));
+    ASSERT_EQUAL(4, liste->taille, "4 éléments attendus");
+    ASSERT_EQUAL(std::string("aaa"), liste->tete->donnee, "EmplacerDebut devrait construire sur place");
+    ASSERT_EQUAL(std::string("gamma"), gamma, "InsererFin d'une lvalue devrait copier");
+
+    NoeudST<std::string>* beta = RechercherValeur(liste, "beta");
+    ASSERT_NOT_NULL(beta, "beta devrait être trouvé");
+    EmplacerApres(liste, beta, "apres-beta");
+    ASSERT_EQUAL(std::string("apres-beta"), ObtenirNoeudPosition(liste, 2)->donnee, "EmplacerApres incorrect");
+    ASSERT_EQUAL(std::string("delta"), liste->queue->donnee, "La queue devrait être delta");
+
+    std::string extrait;
+    ASSERT_TRUE(ExtraireDebut(liste, &extrait), "L'extraction devrait réussir");
+    ASSERT_EQUAL(std::string("aaa"), extrait, "La donnée extraite devrait être aaa");
+
+    ListeSimpleT<std::string>* copie = Copier(liste);
+    ASSERT_NOT_NULL(copie, "La copie devrait réussir");
+    if (copie != nullptr) {
+        ASSERT_EQUAL(4, copie->taille, "La copie devrait avoir 4 éléments");
+        ASSERT_TRUE(copie->tete != liste->tete, "La copie devrait avoir ses propres nœuds");
+        ASSERT_EQUAL(std::string("beta"), copie->tete->donnee, "La copie devrait commencer par beta");
+        Detruire(copie);
+    }
+
+    std::string concatenation;
+    for (const std::string& valeur : *liste) {
+        concatenation += valeur + ";";
+    }
+    ASSERT_EQUAL(std::string("beta;apres-beta;gamma;delta;"), concatenation, "Parcours générique incorrect");
+
+    Detruire(liste);
+}
+
+TEST_CASE(TestGeneriqueDeplacable) {
+    ListeSimpleT<std::unique_ptr<int>> liste = CreerSimpleT<std::unique_ptr<int>>();
+    for (int i = 0; i < 5; i++) {
+        EmplacerFin(&liste, std::make_unique<int>(i * 10));
+    }
+    std::unique_ptr<int> dix = std::make_unique<int>(-1);
+    InsererDebut(&liste, std::move(dix));
+    ASSERT_NULL(dix.get(), "InsererDebut d'une rvalue devrait déplacer");
+    ASSERT_EQUAL(6, liste.taille, "6 éléments attendus");
+
+    Inverser(&liste);
+    ASSERT_EQUAL(40, *liste.tete->donnee, "La tête inversée devrait valoir 40");
+    ASSERT_EQUAL(-1, *liste.queue->donnee, "La queue inversée devrait valoir -1");
+
+    std::unique_ptr<int> sortie;
+    ExtraireDebut(&liste, &sortie);
+    ASSERT_EQUAL(40, *sortie, "La donnée extraite devrait valoir 40");
+    ASSERT_TRUE(SupprimerApres(&liste, liste.tete), "SupprimerApres devrait réussir");
+    ASSERT_EQUAL(4, liste.taille, "4 éléments attendus après suppressions");
+
+    Nettoyer(&liste);
+    ASSERT_TRUE(EstVide(&liste), "La liste devrait être vide");
+}
+
+TEST_CASE(TestGeneriqueDiviserFusionner) {
+    Compteur::vivants = 0;
+    ListeSimpleT<Compteur> liste = CreerSimpleT<Compteur>();
+    for (int i = 0; i < 10; i++) {
+        EmplacerFin(&liste, i * 2);
+    }
+
+    ListeSimpleT<Compteur> seconde = CreerSimpleT<Compteur>();
+    Diviser(&liste, 4, &seconde);
+    ASSERT_EQUAL(4, liste.taille, "La première partie devrait avoir 4 éléments");
+    ASSERT_EQUAL(6, seconde.taille, "La seconde partie devrait avoir 6 éléments");
+    ASSERT_EQUAL(6, liste.queue->donnee.valeur, "La première queue devrait valoir 6");
+    ASSERT_NULL(liste.queue->suivant, "La première partie devrait être terminée");
+    ASSERT_EQUAL(8, seconde.tete->donnee.valeur, "La seconde tête devrait valoir 8");
+
+    ListeSimpleT<Compteur> impairs = CreerSimpleT<Compteur>();
+    for (int i = 0; i < 5; i++) {
+        EmplacerFin(&impairs, i * 2 + 1);
+    }
+    Fusionner(&liste, &impairs);
+    ASSERT_EQUAL(9, liste.taille, "La fusion devrait donner 9 éléments");
+    ASSERT_TRUE(EstVide(&impairs), "La source devrait être vidée");
+    ASSERT_EQUAL(9, liste.queue->donnee.valeur, "La queue fusionnée devrait valoir 9");
+    std::vector<int> valeurs;
+    for (const Compteur& c : liste) {
+        valeurs.push_back(c.valeur);
+    }
+    std::vector<int> attendues = {0, 1, 2, 3, 4, 5, 6, 7, 9};
+    ASSERT_TRUE(valeurs == attendues, "La fusion devrait être triée");
+
+    Concatener(&liste, &seconde);
+    ASSERT_EQUAL(15, liste.taille, "La concaténation devrait donner 15 éléments");
+    ASSERT_EQUAL(18, liste.queue->donnee.valeur, "La queue concaténée devrait valoir 18");
+    ASSERT_EQUAL(15, Compteur::vivants, "Aucune donnée ne devrait être copiée ni perdue");
+
+    Nettoyer(&liste);
+    ASSERT_EQUAL(0, Compteur::vivants, "Nettoyer devrait détruire toutes les données");
+}
+
+// ============================================================================
+// TESTS DES RESSOURCES MÉMOIRE (std::pmr)
+// ============================================================================
+
+/**
+ * @brief Ressource qui compte les blocs qu'elle a en circulation
+ */
+class RessourceComptee : public std::pmr::memory_resource {
+public:
+    int enCirculation = 0;
+    int allocations = 0;
+
+private:
+    void* do_allocate(size_t taille, size_t alignement) override {
+        enCirculation++;
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(taille, alignement);
+    }
+    void do_deallocate(void* bloc, size_t taille, size_t alignement) override {
+        enCirculation--;
+        std::pmr::new_delete_resource()->deallocate(bloc, taille, alignement);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& autre) const noexcept override {
+        return this == &autre;
+    }
+};
+
+TEST_CASE(TestRessourceListeSimple) {
+    RessourceComptee ressource;
+    ListeSimpleT<std::string>* liste = AllocateSimpleT<std::string>(&ressource);
+    ASSERT_NOT_NULL(liste, "La liste devrait être créée dans la ressource");
+    if (!liste) return;
+    for (int i = 0; i < 10; i++) {
+        EmplacerFin(liste, std::to_string(i));
+    }
+    ASSERT_EQUAL(10, ressource.enCirculation, "Les 10 nœuds viennent de la ressource");
+
+    ListeSimpleT<std::string>* copie = Copier(liste);
+    ASSERT_TRUE(copie->ressource == &ressource, "Copier propage la ressource");
+    ASSERT_EQUAL(20, ressource.enCirculation, "La copie est allouée dans la même ressource");
+
+    ListeSimpleT<std::string> seconde = CreerSimpleT<std::string>();
+    Diviser(copie, 6, &seconde);
+    ASSERT_TRUE(seconde.ressource == &ressource, "Diviser propage la ressource");
+    Nettoyer(&seconde);
+    ASSERT_EQUAL(16, ressource.enCirculation, "Les nœuds divisés retournent à leur ressource");
+    Detruire(copie);
+    ASSERT_EQUAL(10, ressource.enCirculation, "Detruire rend la copie à la ressource");
+
+    // Une liste sur malloc fusionnée dans la ressource : ses données y sont relogées
+    ListeSimpleT<std::string>* ailleurs = AllocateSimpleT<std::string>();
+    EmplacerFin(ailleurs, "05");
+    EmplacerFin(ailleurs, "55");
+    NoeudST<std::string>* avant = ailleurs->tete;
+    ASSERT_TRUE(Fusionner(liste, ailleurs), "La fusion devrait réussir");
+    ASSERT_EQUAL(12, ressource.enCirculation, "Les nœuds fusionnés viennent de la ressource de destination");
+    ASSERT_TRUE(RechercherValeur(liste, "05") != avant, "Le nœud étranger devrait avoir été relogé");
+    ASSERT_EQUAL(std::string("05"), ObtenirNoeudPosition(liste, 1)->donnee, "La fusion devrait rester triée");
+    Detruire(ailleurs);
+
+    ListeSimpleT<std::string>* autres = AllocateSimpleT<std::string>();
+    EmplacerFin(autres, "7");
+    ListeSimpleT<std::string>* fusion = FusionnerListesTriees(autres, liste);
+    ASSERT_NULL(fusion->ressource, "FusionnerListesTriees prend la ressource de la première liste");
+    ASSERT_EQUAL(13, fusion->taille, "La fusion copiée devrait avoir 13 éléments");
+    ASSERT_EQUAL(12, ressource.enCirculation, "La fusion copiée ne devrait rien prendre à la ressource");
+    Detruire(fusion);
+    Detruire(autres);
+
+    Detruire(liste);
+    ASSERT_EQUAL(0, ressource.enCirculation, "Tous les blocs devraient être rendus");
+}
+
+TEST_CASE(TestRessourceMonotone) {
+    char tampon[4096];
+    std::pmr::monotonic_buffer_resource requete(tampon, sizeof(tampon), std::pmr::null_memory_resource());
+    ListeSimpleT<int> liste = CreerSimpleT<int>(&requete);
+    int inserees = 0;
+    while (EmplacerFin(&liste, inserees) != nullptr) {
+        inserees++;
+    }
+    ASSERT_TRUE(inserees > 100, "Le tampon devrait accueillir plus de 100 nœuds");
+    ASSERT_EQUAL(inserees, liste.taille, "L'échec d'allocation ne devrait pas modifier la liste");
+    ASSERT_TRUE((char*)liste.tete >= tampon && (char*)liste.queue < tampon + sizeof(tampon),
+                "Les nœuds devraient être dans le tampon");
+    ASSERT_NULL(Copier(&liste), "Une copie ne tient plus dans le tampon");
+    Nettoyer(&liste);
+}
+
+// ============================================================================
+// TESTS DE LA LISTE INTRUSIVE SIMPLE
+// ============================================================================
+
+/**
+ * @brief Objet utilisateur présent dans deux listes à la fois
+ */
+struct Requete {
+    int identifiant;
+    int priorite;
+    CrochetS<Requete> lienArrivee;
+    CrochetS<Requete> lienPriorite;
+};
+
+typedef ListeIntrusiveS<Requete, &Requete::lienArrivee> FileArrivee;
+typedef ListeIntrusiveS<Requete, &Requete::lienPriorite> FilePriorite;
+
+static_assert(std::ranges::forward_range<FileArrivee&>, "La liste intrusive doit être une plage");
+
+TEST_CASE(TestIntrusiveSimple) {
+    Requete requetes[6];
+    FileArrivee arrivee;
+    FilePriorite priorite;
+    Initialiser(&arrivee);
+    Initialiser(&priorite);
+    for (int i = 0; i < 6; i++) {
+        requetes[i].identifiant = i;
+        requetes[i].priorite = (i * 7) % 4;
+        InsererFin(&arrivee, &requetes[i]);
+        InsererDebut(&priorite, &requetes[i]);
+    }
+    ASSERT_EQUAL(6, arrivee.taille, "6 requêtes en file d'arrivée");
+    ASSERT_EQUAL(&requetes[5], priorite.tete, "La seconde liste a son propre ordre");
+
+    ASSERT_TRUE(Retirer(&arrivee, &requetes[3]), "Le retrait par pointeur devrait réussir");
+    ASSERT_FALSE(Retirer(&arrivee, &requetes[3]), "Un objet délié n'est plus trouvé");
+    ASSERT_EQUAL(6, priorite.taille, "Le retrait ne touche pas l'autre liste");
+    ASSERT_TRUE(InsererAvant(&arrivee, &requetes[4], &requetes[3]), "InsererAvant devrait réussir");
+    ASSERT_EQUAL(&requetes[3], ObtenirPosition(&arrivee, 3), "La requête 3 devrait être revenue en position 3");
+    ASSERT_EQUAL(&requetes[0], RetirerDebut(&arrivee), "RetirerDebut devrait rendre la tête");
+    ASSERT_TRUE(InsererApres(&arrivee, arrivee.queue, &requetes[0]), "InsererApres la queue devrait réussir");
+    ASSERT_EQUAL(&requetes[0], arrivee.queue, "La requête 0 devrait être en queue");
+
+    Trier(&priorite, [](const Requete& a, const Requete& b) { return a.priorite < b.priorite; });
+    bool triee = true;
+    int derniere = -1;
+    int visites = 0;
+    for (const Requete& r : priorite) {
+        triee = triee && r.priorite >= derniere;
+        derniere = r.priorite;
+        visites++;
+    }
+    ASSERT_TRUE(triee, "Le tri par comparateur devrait ordonner les priorités");
+    ASSERT_EQUAL(6, visites, "Le tri ne devrait perdre aucun objet");
+    ASSERT_NULL(priorite.queue->lienPriorite.suivant, "La queue triée devrait terminer la chaîne");
+
+    Inverser(&arrivee);
+    ASSERT_EQUAL(&requetes[0], arrivee.tete, "L'inversion devrait mettre la requête 0 en tête");
+    ASSERT_EQUAL(&requetes[1], arrivee.queue, "L'inversion devrait mettre la requête 1 en queue");
+
+    FileArrivee seconde;
+    Initialiser(&seconde);
+    Diviser(&arrivee, 2, &seconde);
+    ASSERT_EQUAL(2, arrivee.taille, "La première partie devrait avoir 2 requêtes");
+    ASSERT_EQUAL(4, seconde.taille, "La seconde partie devrait avoir 4 requêtes");
+    ASSERT_NULL(arrivee.queue->lienArrivee.suivant, "La première partie devrait être terminée");
+    Concatener(&seconde, &arrivee);
+    ASSERT_EQUAL(6, seconde.taille, "La concaténation devrait réunir les 6 requêtes");
+    ASSERT_TRUE(EstVide(&arrivee), "La source devrait être vide");
+    ASSERT_EQUAL(&requetes[5], seconde.queue, "La queue concaténée devrait être la requête 5");
+}
+
+// ============================================================================
+// TESTS DE LA PETITE LISTE (zone locale)
+// ============================================================================
+
+typedef ListePetiteS<4> PetiteListe;
+
+/**
+ * @brief Vérifie l'invariant : débordement non vide => zone locale pleine
+ */
+static bool InvariantPetite(const PetiteListe* liste) {
+    return liste->debordement.taille == 0 || liste->nombreLocales == 4;
+}
+
+TEST_CASE(TestPetiteSansAllocation) {
+    ListePetiteS<8> liste = CreerPetiteS<8>();
+    for (int i = 0; i < 8; i++) {
+        InsererFin(&liste, i * 10);
+    }
+    SupprimerFin(&liste);
+    InsererPosition(&liste, 7, 70);
+    Inverser(&liste);
+    Trier(&liste);
+    RotationGauche(&liste, 3);
+    ASSERT_EQUAL(8, CompterElements(&liste), "La liste devrait avoir 8 éléments");
+    ASSERT_NULL(liste.debordement.tete, "8 valeurs devraient tenir dans la zone locale");
+    ASSERT_EQUAL(3, RechercherValeur(&liste, 60), "60 devrait être en position 3");
+
+    InsererDebut(&liste, -1);
+    ASSERT_TRUE(Deborde(&liste), "La 9e valeur devrait déborder");
+    ASSERT_EQUAL(1, liste.debordement.taille, "Un seul nœud devrait être alloué");
+    ASSERT_EQUAL(20, liste.debordement.tete->donnee, "La dernière valeur locale devrait passer au débordement");
+    SupprimerDebut(&liste);
+    ASSERT_FALSE(Deborde(&liste), "La suppression devrait reprendre la valeur débordée");
+    ASSERT_EQUAL(std::string("Liste[Noeud(30) -> Noeud(40) -> Noeud(50) -> Noeud(60) -> Noeud(70) -> "
+                             "Noeud(0) -> Noeud(10) -> Noeud(20)]"),
+                 ToString((const ListePetiteS<8>*)&liste), "L'ordre devrait être conservé");
+    Nettoyer(&liste);
+    ASSERT_TRUE(EstVide(&liste), "La liste devrait être vide");
+}
+
+TEST_CASE(TestPetiteParite) {
+    ListeSimple* reference = CreerEtValiderListe("référence petite liste");
+    PetiteListe petite = CreerPetiteS<4>();
+    unsigned int graine = 12345;
+    auto tirer = [&graine](int borne) {
+        graine = graine * 1103515245u + 12345u;
+        return (int)((graine >> 16) % (unsigned int)borne);
+    };
+
+    bool identiques = true;
+    bool invariant = true;
+    for (int etape = 0; etape < 2000 && identiques; etape++) {
+        int taille = reference->taille;
+        int valeur = tirer(12);
+        switch (tirer(taille > 10 ? 16 : 10)) {
+            case 0: InsererDebut(reference, valeur); InsererDebut(&petite, valeur); break;
+            case 1: InsererFin(reference, valeur); InsererFin(&petite, valeur); break;
+            case 2: {
+                int position = tirer(taille + 2);
+                identiques = InsererPosition(reference, position, valeur) == InsererPosition(&petite, position, valeur);
+                break;
+            }
+            case 3:
+                Trier(reference); Trier(&petite);
+                InsererTrie(reference, valeur); InsererTrie(&petite, valeur);
+                break;
+            case 4: Inverser(reference); Inverser(&petite); break;
+            case 5: {
+                int k = tirer(20) - 10;
+                RotationGauche(reference, k); RotationGauche(&petite, k);
+                RotationDroite(reference, k / 2); RotationDroite(&petite, k / 2);
+                break;
+            }
+            case 6: {
+                int mi = TrouverMilieu(&petite);
+                NoeudS* milieu = TrouverMilieu(reference);
+                identiques = (milieu == nullptr) ? mi == -1 : milieu == ObtenirNoeudPosition(reference, mi);
+                NoeudS* trouve = RechercherValeur(reference, valeur);
+                int position = RechercherValeur(&petite, valeur);
+                identiques = identiques && (trouve == nullptr ? position == -1
+                                                             : trouve == ObtenirNoeudPosition(reference, position));
+                break;
+            }
+            case 7: {
+                // Diviser réinitialise la seconde liste (estAllouee compris) : liste sur la pile
+                ListeSimple secondeRef;
+                secondeRef.tete = nullptr;
+                InitialiserListe(&secondeRef, "seconde référence");
+                PetiteListe seconde = CreerPetiteS<4>();
+                int position = tirer(taille + 1);
+                Diviser(reference, position, &secondeRef);
+                Diviser(&petite, position, &seconde);
+                identiques = ToString((const ListeSimple*)&secondeRef) == ToString((const PetiteListe*)&seconde);
+                Concatener(reference, &secondeRef);
+                Concatener(&petite, &seconde);
+                Nettoyer(&secondeRef);
+                Nettoyer(&seconde);
+                break;
+            }
+            case 8: {
+                if (taille > 20) {
+                    break;
+                }
+                PetiteListe copie = Copier(&petite);
+                Concatener(&petite, &copie);
+                Concatener(reference, reference);
+                Nettoyer(&copie);
+                break;
+            }
+            case 9:
+                Trier(reference); Trier(&petite);
+                SupprimerDoublonsTries(reference); SupprimerDoublonsTries(&petite);
+                break;
+            case 10: SupprimerDoublonsNonTries(reference); SupprimerDoublonsNonTries(&petite); break;
+            case 11:
+                identiques = SupprimerValeur(reference, valeur) == SupprimerValeur(&petite, valeur);
+                break;
+            case 12:
+                identiques = SupprimerToutesOccurrences(reference, valeur) == SupprimerToutesOccurrences(&petite, valeur);
+                break;
+            case 13: {
+                int position = tirer(taille + 1);
+                identiques = SupprimerPosition(reference, position) == SupprimerPosition(&petite, position);
+                break;
+            }
+            case 14: SupprimerDebut(reference); SupprimerDebut(&petite); break;
+            default: SupprimerFin(reference); SupprimerFin(&petite); break;
+        }
+        identiques = identiques && ToString((const ListeSimple*)reference) == ToString((const PetiteListe*)&petite) &&
+                     reference->taille == CompterElements(&petite);
+        invariant = invariant && InvariantPetite(&petite);
+    }
+
+    ASSERT_TRUE(identiques, "La petite liste devrait suivre ListeSimple opération par opération");
+    ASSERT_TRUE(invariant, "Le débordement ne devrait exister qu'avec une zone locale pleine");
+
+    DetruireListe(reference);
+    Nettoyer(&petite);
+}
+
+TEST_CASE(TestPetiteFusionPalindrome) {
+    PetiteListe paires = CreerPetiteS<4>();
+    PetiteListe impaires = CreerPetiteS<4>();
+    for (int i = 0; i < 5; i++) {
+        InsererFin(&paires, 2 * i);
+        InsererFin(&impaires, 2 * i + 1);
+    }
+    PetiteListe fusion = FusionnerListesTriees(&paires, &impaires);
+    ASSERT_EQUAL(10, CompterElements(&fusion), "La fusion devrait contenir 10 valeurs");
+    int attendu = 0;
+    bool ordonnee = true;
+    for (int valeur : fusion) {
+        ordonnee = ordonnee && valeur == attendu++;
+    }
+    ASSERT_TRUE(ordonnee, "La fusion devrait donner 0..9");
+    int valeur = 0;
+    ASSERT_TRUE(ObtenirValeur(&fusion, 7, &valeur), "La position 7 devrait être lisible");
+    ASSERT_EQUAL(7, valeur, "La position 7 devrait valoir 7");
+    ASSERT_FALSE(ObtenirValeur(&fusion, 10, &valeur), "La position 10 est hors liste");
+    ASSERT_FALSE(EstPalindrome(&fusion), "0..9 n'est pas un palindrome");
+
+    // Palindromes de toutes les longueurs, de part et d'autre de la zone locale
+    bool palindromes = true;
+    bool nonPalindromes = true;
+    for (int taille = 1; taille <= 11; taille++) {
+        PetiteListe liste = CreerPetiteS<4>();
+        for (int i = 0; i < taille; i++) {
+            InsererFin(&liste, std::min(i, taille - 1 - i));
+        }
+        palindromes = palindromes && EstPalindrome(&liste);
+        if (taille >= 2) {
+            SupprimerPosition(&liste, taille / 2);
+            InsererPosition(&liste, taille / 2, 99);
+            nonPalindromes = nonPalindromes && (taille % 2 == 1 || !EstPalindrome(&liste));
+            SupprimerFin(&liste);
+            InsererFin(&liste, 42);
+            nonPalindromes = nonPalindromes && !EstPalindrome(&liste);
+        }
+        Nettoyer(&liste);
+    }
+    ASSERT_TRUE(palindromes, "Les palindromes devraient être reconnus quelle que soit la taille");
+    ASSERT_TRUE(nonPalindromes, "Une valeur différente devrait être détectée des deux côtés");
+
+    Nettoyer(&paires);
+    Nettoyer(&impaires);
+    Nettoyer(&fusion);
+}
+
+// ============================================================================
+// TESTS DE LA LISTE SIMPLE STATIQUE
+// ============================================================================
+
+TEST_CASE(TestStatiqueSimple) {
+    ListeStatique<8> liste;
+    Initialiser(&liste);
+    for (int i = 0; i < 8; i++) {
+        ASSERT_TRUE(InsererFin(&liste, i), "L'insertion devrait réussir sous la capacité");
+    }
+    ASSERT_TRUE(EstPleine(&liste), "La liste devrait être pleine");
+    ASSERT_FALSE(InsererDebut(&liste, 99), "Une liste pleine devrait refuser l'insertion");
+    ASSERT_FALSE(InsererPosition(&liste, 4, 99), "Une liste pleine devrait refuser l'insertion");
+    ASSERT_EQUAL(8, CompterElements(&liste), "Le refus ne devrait pas modifier la liste");
+
+    // Le nœud rendu par la suppression est réutilisé
+    int ancienneTete = liste.tete;
+    ASSERT_TRUE(SupprimerDebut(&liste), "SupprimerDebut devrait réussir");
+    ASSERT_TRUE(InsererTrie(&liste, 4), "La place libérée devrait servir");
+    ASSERT_EQUAL(ancienneTete, RechercherValeur(&liste, 4), "Le nœud libéré devrait être réutilisé");
+    ASSERT_EQUAL(std::string("Liste[Noeud(1) -> Noeud(2) -> Noeud(3) -> Noeud(4) -> Noeud(4) -> Noeud(5) -> "
+                             "Noeud(6) -> Noeud(7)]"),
+                 ToString((const ListeStatique<8>*)&liste), "Le format devrait suivre ToString(ListeSimple)");
+
+    SupprimerDoublonsTries(&liste);
+    ASSERT_TRUE(SupprimerFin(&liste), "SupprimerFin devrait réussir");
+    ASSERT_TRUE(SupprimerNoeud(&liste, ObtenirNoeudPosition(&liste, 2)), "SupprimerNoeud devrait réussir");
+    ASSERT_FALSE(SupprimerNoeud(&liste, ancienneTete + 100), "Un index étranger devrait être refusé");
+    ASSERT_EQUAL(std::string("Liste[Noeud(1) -> Noeud(2) -> Noeud(4) -> Noeud(5) -> Noeud(6)]"),
+                 ToString((const ListeStatique<8>*)&liste), "Les suppressions devraient donner 1 2 4 5 6");
+
+    RotationGauche(&liste, 2);
+    RotationDroite(&liste, 7);
+    Inverser(&liste);
+    ASSERT_EQUAL(std::string("Liste[Noeud(6) -> Noeud(5) -> Noeud(4) -> Noeud(2) -> Noeud(1)]"),
+                 ToString((const ListeStatique<8>*)&liste), "Rotations et inversion devraient suivre ListeSimple");
+
+    ListeStatique<8> seconde;
+    Initialiser(&seconde);
+    Diviser(&liste, 2, &seconde);
+    ASSERT_EQUAL(2, CompterElements(&liste), "La première partie devrait avoir 2 éléments");
+    ASSERT_EQUAL(3, CompterElements(&seconde), "La seconde partie devrait avoir 3 éléments");
+    ASSERT_TRUE(Concatener(&liste, &seconde), "La concaténation devrait tenir dans la capacité");
+    ASSERT_FALSE(Concatener(&liste, &liste), "Doubler 5 éléments dépasserait la capacité");
+    ASSERT_EQUAL(5, CompterElements(&liste), "Une concaténation refusée ne change rien");
+
+    // Tri fusion itératif sur une liste pleine, nœuds recyclés dans le désordre
+    ListeStatique<64> grande;
+    Initialiser(&grande);
+    std::vector<int> attendues;
+    unsigned int graine = 7;
+    for (int i = 0; i < 64; i++) {
+        graine = graine * 1103515245u + 12345u;
+        int valeur = (int)((graine >> 16) % 50);
+        InsererPosition(&grande, i / 2, valeur);
+        attendues.push_back(valeur);
+    }
+    Trier(&grande);
+    std::sort(attendues.begin(), attendues.end());
+    std::vector<int> obtenues;
+    for (int index = grande.tete; index != STATIQUE_AUCUN; index = grande.noeuds[index].suivant) {
+        obtenues.push_back(grande.noeuds[index].donnee);
+    }
+    ASSERT_TRUE(obtenues == attendues, "Le tri devrait ordonner les 64 valeurs");
+    ASSERT_EQUAL(attendues.back(), grande.noeuds[grande.queue].donnee, "La queue devrait suivre le tri");
+
+    Nettoyer(&grande);
+    ASSERT_TRUE(EstVide(&grande), "Nettoyer devrait vider la liste");
+    ASSERT_TRUE(InsererFin(&grande, 1), "La liste nettoyée devrait accepter de nouveau");
+}
+
+// ============================================================================
+// TESTS DE LA PILE CONCURRENTE (Treiber)
+// ============================================================================
+
+TEST_CASE(TestPileConcurrenteSequentielle) {
+    PileConcurrente* pile = AllocatePileConcurrente();
+    ASSERT_NOT_NULL(pile, "La pile devrait être créée");
+    ASSERT_TRUE(EstVide(pile), "Une nouvelle pile est vide");
+
+    for (int i = 1; i <= 3; i++) {
+        ASSERT_TRUE(InsererDebut(pile, i * 10), "L'empilement devrait réussir");
+    }
+    ASSERT_EQUAL(std::string("Liste[Noeud(30) -> Noeud(20) -> Noeud(10)]"), ToString((const PileConcurrente*)pile),
+                 "Le sommet devrait être la dernière valeur empilée");
+
+    int valeur = 0;
+    ASSERT_TRUE(SupprimerDebut(pile, &valeur), "Le dépilement devrait réussir");
+    ASSERT_EQUAL(30, valeur, "La pile est LIFO");
+
+    // Le nœud dépilé est repris par l'empilement suivant
+    NoeudS* recycle = AdresseDe<NoeudS>(pile->reserve.load());
+    ASSERT_TRUE(InsererDebut(pile, 40), "L'empilement devrait réussir");
+    ASSERT_EQUAL(recycle, AdresseDe<NoeudS>(pile->tete.load()), "Le nœud de la réserve devrait être réutilisé");
+
+    ListeSimple* source = CreerEtValiderListe("source de la pile");
+    InsererFin(source, 1);
+    InsererFin(source, 2);
+    ASSERT_TRUE(InsererListe(pile, source), "La liste devrait être empilée d'un coup");
+    ASSERT_TRUE(EstVide(source), "La source devrait être vidée");
+    ASSERT_EQUAL(5, CompterElements(pile), "La pile devrait contenir 5 éléments");
+
+    ListeSimple* extraite = ExtraireListe(pile);
+    ASSERT_NOT_NULL(extraite, "L'extraction devrait réussir");
+    ASSERT_EQUAL(std::string("Liste[Noeud(1) -> Noeud(2) -> Noeud(40) -> Noeud(20) -> Noeud(10)]"),
+                 ToString((const ListeSimple*)extraite), "L'extraction devrait suivre l'ordre de la pile");
+    ASSERT_TRUE(EstVide(pile), "La pile devrait être vide après extraction");
+    ASSERT_FALSE(SupprimerDebut(pile, &valeur), "Dépiler une pile vide échoue");
+
+    DetruireListe(source);
+    DetruireListe(extraite);
+    Detruire(pile);
+}
+
+TEST_CASE(TestPileConcurrenteThreads) {
+    PileConcurrente* pile = AllocatePileConcurrente();
+    const int nombreThreads = 8;
+    const int parThread = 20000;
+
+    // Chaque thread empile des valeurs qui lui sont propres et dépile au passage
+    std::vector<std::vector<int>> depilees(nombreThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nombreThreads; t++) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < parThread; i++) {
+                InsererDebut(pile, t * parThread + i);
+                int valeur;
+                if (i % 3 != 0 && SupprimerDebut(pile, &valeur)) {
+                    depilees[t].push_back(valeur);
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<int> vues(nombreThreads * parThread, 0);
+    for (const std::vector<int>& serie : depilees) {
+        for (int valeur : serie) {
+            vues[valeur]++;
+        }
+    }
+    int valeur;
+    while (SupprimerDebut(pile, &valeur)) {
+        vues[valeur]++;
+    }
+
+    bool chaqueValeurUneFois = std::all_of(vues.begin(), vues.end(), [](int n) { return n == 1; });
+    ASSERT_TRUE(chaqueValeurUneFois, "Chaque valeur devrait être dépilée exactement une fois");
+    ASSERT_EQUAL(0, CompterElements(pile), "Le compteur devrait revenir à zéro");
+    Detruire(pile);
+}
+
+// ============================================================================
+// TESTS DE LA FILE CONCURRENTE (Michael-Scott)
+// ============================================================================
+
+TEST_CASE(TestFileConcurrenteSequentielle) {
+    FileConcurrente* file = AllocateFileConcurrente();
+    ASSERT_NOT_NULL(file, "La file devrait être créée");
+    ASSERT_TRUE(EstVide(file), "Une nouvelle file est vide");
+
+    int valeur = 0;
+    ASSERT_FALSE(SupprimerDebut(file, &valeur), "Défiler une file vide échoue");
+    for (int i = 1; i <= 3; i++) {
+        ASSERT_TRUE(InsererFin(file, i * 10), "L'enfilement devrait réussir");
+    }
+    ASSERT_EQUAL(std::string("Liste[Noeud(10) -> Noeud(20) -> Noeud(30)]"), ToString((const FileConcurrente*)file),
+                 "Les valeurs devraient être dans l'ordre d'arrivée");
+    ASSERT_TRUE(SupprimerDebut(file, &valeur), "Le défilement devrait réussir");
+    ASSERT_EQUAL(10, valeur, "La file est FIFO");
+
+    // L'ancien factice part en réserve et sert au prochain enfilement
+    NoeudS* recycle = AdresseDe<NoeudS>(file->reserve.load());
+    ASSERT_NOT_NULL(recycle, "L'ancien factice devrait être en réserve");
+    ASSERT_TRUE(InsererFin(file, 40), "L'enfilement devrait réussir");
+    ASSERT_EQUAL(recycle, AdresseDe<NoeudS>(file->queue.load()), "Le nœud de la réserve devrait être réutilisé");
+
+    ASSERT_EQUAL(3, CompterElements(file), "La file devrait contenir 3 éléments");
+    std::vector<int> defilees;
+    while (SupprimerDebut(file, &valeur)) {
+        defilees.push_back(valeur);
+    }
+    ASSERT_TRUE((defilees == std::vector<int>{20, 30, 40}), "Le reste devrait sortir dans l'ordre");
+    ASSERT_TRUE(EstVide(file), "La file devrait être vide");
+    Detruire(file);
+}
+
+TEST_CASE(TestFileConcurrenteThreads) {
+    FileConcurrente* file = AllocateFileConcurrente();
+    const int producteurs = 4;
+    const int consommateurs = 4;
+    const int parProducteur = 20000;
+    std::atomic<int> restants(producteurs * parProducteur);
+
+    std::vector<std::vector<int>> recues(consommateurs);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producteurs; p++) {
+        threads.emplace_back([&, p]() {
+            for (int i = 0; i < parProducteur; i++) {
+                InsererFin(file, p * parProducteur + i);
+            }
+        });
+    }
+    for (int c = 0; c < consommateurs; c++) {
+        threads.emplace_back([&, c]() {
+            int valeur;
+            while (restants.load() > 0) {
+                if (SupprimerDebut(file, &valeur)) {
+                    recues[c].push_back(valeur);
+                    restants.fetch_sub(1);
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Chaque valeur une fois, et l'ordre de chaque producteur respecté par chaque consommateur
+    std::vector<int> vues(producteurs * parProducteur, 0);
+    bool ordreProducteur = true;
+    for (const std::vector<int>& serie : recues) {
+        std::vector<int> derniere(producteurs, -1);
+        for (int valeur : serie) {
+            vues[valeur]++;
+            int producteur = valeur / parProducteur;
+            ordreProducteur = ordreProducteur && valeur > derniere[producteur];
+            derniere[producteur] = valeur;
+        }
+    }
+    bool chaqueValeurUneFois = std::all_of(vues.begin(), vues.end(), [](int n) { return n == 1; });
+    ASSERT_TRUE(chaqueValeurUneFois, "Chaque valeur devrait être défilée exactement une fois");
+    ASSERT_TRUE(ordreProducteur, "La file devrait conserver l'ordre de chaque producteur");
+    ASSERT_TRUE(EstVide(file), "La file devrait être vide");
+    Detruire(file);
+}
+
+// ============================================================================
+// TESTS DE L'ENSEMBLE CONCURRENT (Harris-Michael)
+// ============================================================================
+
+TEST_CASE(TestEnsembleConcurrentSequentiel) {
+    EnsembleConcurrent* ensemble = AllocateEnsembleConcurrent();
+    ASSERT_NOT_NULL(ensemble, "L'ensemble devrait être créé");
+    ASSERT_TRUE(EstVide(ensemble), "Un nouvel ensemble est vide");
+
+    for (int valeur : {30, 10, 20, 40}) {
+        ASSERT_TRUE(InsererTrie(ensemble, valeur), "L'insertion devrait réussir");
+    }
+    ASSERT_FALSE(InsererTrie(ensemble, 20), "Une valeur déjà présente est refusée");
+    ASSERT_EQUAL(std::string("Liste[Noeud(10) -> Noeud(20) -> Noeud(30) -> Noeud(40)]"),
+                 ToString((const EnsembleConcurrent*)ensemble), "Les valeurs devraient être triées");
+
+    ASSERT_TRUE(RechercherValeur(ensemble, 30), "30 devrait être trouvé");
+    ASSERT_FALSE(RechercherValeur(ensemble, 25), "25 est absent");
+    ASSERT_TRUE(SupprimerValeur(ensemble, 30), "La suppression devrait réussir");
+    ASSERT_FALSE(SupprimerValeur(ensemble, 30), "Une seconde suppression échoue");
+    ASSERT_FALSE(RechercherValeur(ensemble, 30), "30 ne devrait plus être trouvé");
+
+    // Le nœud décroché est retiré dans le domaine d'époques, puis libéré hors section
+    DomaineEpoque* domaine = DomaineEpoqueGlobal();
+    ASSERT_TRUE(CompterNonRecuperes(domaine) > 0, "Le nœud supprimé devrait attendre sa libération");
+    Recuperer(domaine, ParticipantEpoqueDuThread());
+    ASSERT_EQUAL(0, CompterNonRecuperes(domaine), "Sans lecteur en section, tout devrait être libéré");
+
+    ASSERT_TRUE(InsererTrie(ensemble, 30), "La valeur peut revenir");
+    ASSERT_TRUE(SupprimerValeur(ensemble, 10), "La tête peut être supprimée");
+    ASSERT_TRUE(SupprimerValeur(ensemble, 40), "La fin peut être supprimée");
+    ASSERT_EQUAL(std::string("Liste[Noeud(20) -> Noeud(30)]"), ToString((const EnsembleConcurrent*)ensemble),
+                 "Il devrait rester 20 et 30");
+    ASSERT_EQUAL(2, CompterElements(ensemble), "L'ensemble devrait contenir 2 éléments");
+    Detruire(ensemble);
+}
+
+TEST_CASE(TestEnsembleConcurrentThreads) {
+    EnsembleConcurrent* ensemble = AllocateEnsembleConcurrent();
+    const int threadsEcriture = 4;
+    const int cles = 512;
+
+    // Chaque thread insère toutes les clés par ordre croissant, puis supprime les
+    // clés impaires de sa classe modulo threadsEcriture : les paires doivent survivre
+    std::atomic<int> suppressions(0);
+    std::atomic<bool> arret(false);
+    std::atomic<bool> pairesVues(true);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsEcriture; t++) {
+        threads.emplace_back([&, t]() {
+            for (int tour = 0; tour < 20; tour++) {
+                for (int cle = 0; cle < cles; cle++) {
+                    InsererTrie(ensemble, cle);
+                }
+                for (int cle = t; cle < cles; cle += threadsEcriture) {
+                    if (cle % 2 == 1 && SupprimerValeur(ensemble, cle)) {
+                        suppressions.fetch_add(1);
+                    }
+                }
+            }
+        });
+    }
+    threads.emplace_back([&]() {
+        // Lecteur : si la dernière clé paire est présente, toutes les paires le sont
+        while (!arret.load()) {
+            for (int cle = 0; cle < cles; cle += 2) {
+                if (RechercherValeur(ensemble, cles - 2) && !RechercherValeur(ensemble, cle)) {
+                    pairesVues.store(false);
+                }
+            }
+        }
+    });
+    for (int t = 0; t < threadsEcriture; t++) {
+        threads[t].join();
+    }
+    arret.store(true);
+    threads.back().join();
+    for (int cle = 1; cle < cles; cle += 2) {
+        SupprimerValeur(ensemble, cle);
+    }
+
+    ASSERT_TRUE(pairesVues.load(), "Une clé paire ne devrait jamais paraître absente après son insertion");
+    std::string attendu = "Liste[";
+    for (int cle = 0; cle < cles; cle += 2) {
+        attendu += (cle == 0 ? "" : " -> ") + std::string("Noeud(") + std::to_string(cle) + ")";
+    }
+    ASSERT_EQUAL(attendu + "]", ToString((const EnsembleConcurrent*)ensemble), "Seules les clés paires devraient rester");
+    ASSERT_EQUAL(cles / 2, CompterElements(ensemble), "Le compteur devrait égaler le nombre de clés paires");
+    ASSERT_TRUE(suppressions.load() > 0, "Des suppressions devraient avoir réussi");
+    Detruire(ensemble);
+}
+
+// ============================================================================
+// TESTS DE LA RÉCUPÉRATION DIFFÉRÉE (pointeurs de danger, époques)
+// ============================================================================
+
+static std::atomic<int> nombreLiberesTest(0);
+
+static void LibererEtCompter(void* pointeur) {
+    nombreLiberesTest.fetch_add(1);
+    free(pointeur);
+}
+
+TEST_CASE(TestRecuperationDanger) {
+    nombreLiberesTest.store(0);
+    DomaineDanger* domaine = AllocateDomaineDanger(4, LibererEtCompter);
+    ParticipantDanger* lecteur = Rejoindre(domaine);
+    ParticipantDanger* ecrivain = Rejoindre(domaine);
+    ASSERT_TRUE(lecteur != ecrivain, "Chaque participant a sa case");
+
+    NoeudS* annonce = CreerNoeudS(1);
+    NoeudS* libre = CreerNoeudS(2);
+    Annoncer(lecteur, 0, annonce);
+    Retirer(domaine, ecrivain, annonce);
+    Retirer(domaine, ecrivain, libre);
+    ASSERT_EQUAL(2, CompterNonRecuperes(domaine), "Les deux nœuds attendent");
+
+    ASSERT_EQUAL(1, Recuperer(domaine, ecrivain), "Seul le nœud non annoncé est libéré");
+    ASSERT_EQUAL(1, nombreLiberesTest.load(), "La fonction de libération devrait avoir servi une fois");
+    EffacerAnnonces(lecteur);
+    ASSERT_EQUAL(1, Recuperer(domaine, ecrivain), "Le nœud n'est plus annoncé");
+    ASSERT_EQUAL(0, CompterNonRecuperes(domaine), "Plus rien n'attend");
+
+    // Au-delà du seuil, Retirer déclenche lui-même la passe : la mémoire en attente reste bornée
+    for (int i = 0; i < 1000; i++) {
+        Retirer(domaine, ecrivain, CreerNoeudS(i));
+    }
+    ASSERT_TRUE(CompterNonRecuperes(domaine) < 4 + DANGER_PAR_PARTICIPANT * 2,
+                "Les retraits en attente devraient rester sous seuil + annonces possibles");
+
+    Quitter(domaine, lecteur);
+    Quitter(domaine, ecrivain);
+    Detruire(domaine);
+    ASSERT_EQUAL(1002, nombreLiberesTest.load(), "Tous les nœuds retirés devraient être libérés");
+}
+
+TEST_CASE(TestRecuperationEpoque) {
+    nombreLiberesTest.store(0);
+    DomaineEpoque* domaine = AllocateDomaineEpoque(1000, LibererEtCompter);
+    ParticipantEpoque* lecteur = Rejoindre(domaine);
+    ParticipantEpoque* ecrivain = Rejoindre(domaine);
+
+    EntrerSection(domaine, lecteur);
+    EntrerSection(domaine, lecteur);
+    SortirSection(domaine, lecteur);
+    Retirer(domaine, ecrivain, CreerNoeudS(1));
+    Retirer(domaine, ecrivain, CreerNoeudS(2));
+    ASSERT_EQUAL(0, Recuperer(domaine, ecrivain), "Un lecteur en section bloque la libération");
+    ASSERT_EQUAL(2, CompterNonRecuperes(domaine), "Les deux nœuds attendent");
+
+    SortirSection(domaine, lecteur);
+    ASSERT_EQUAL(2, Recuperer(domaine, ecrivain), "Hors section, les deux nœuds sont libérés");
+    ASSERT_EQUAL(2, nombreLiberesTest.load(), "La fonction de libération devrait avoir servi deux fois");
+
+    Retirer(domaine, ecrivain, CreerNoeudS(3));
+    Quitter(domaine, lecteur);
+    Quitter(domaine, ecrivain);
+    Detruire(domaine);
+    ASSERT_EQUAL(3, nombreLiberesTest.load(), "Tous les nœuds retirés devraient être libérés");
+}
+
+TEST_CASE(TestLecteursProtegesSimple) {
+    ListeSimple* liste = AllocateSimple();
+    const int cles = 256;
+    for (int cle = 0; cle < cles; cle++) {
+        InsererFinPublie(liste, cle);
+    }
+
+    // Un écrivain supprime et réinsère les clés impaires ; les paires ne bougent jamais
+    std::atomic<bool> arret(false);
+    std::atomic<bool> pairesToujoursVues(true);
+    std::vector<std::thread> lecteurs;
+    for (int t = 0; t < 3; t++) {
+        lecteurs.emplace_back([&, t]() {
+            while (!arret.load()) {
+                for (int cle = 2 * t; cle < cles; cle += 6) {
+                    if (!RechercherValeurProtegee(liste, cle)) {
+                        pairesToujoursVues.store(false);
+                    }
+                }
+            }
+        });
+    }
+    std::mutex verrouEcrivains;
+    std::thread ecrivain([&]() {
+        for (int tour = 0; tour < 50; tour++) {
+            for (int cle = 1; cle < cles; cle += 2) {
+                std::lock_guard<std::mutex> garde(verrouEcrivains);
+                SupprimerValeurDifferee(liste, cle);
+                InsererFinPublie(liste, cle);
+            }
+        }
+    });
+    ecrivain.join();
+    arret.store(true);
+    for (std::thread& lecteur : lecteurs) {
+        lecteur.join();
+    }
+
+    ASSERT_TRUE(pairesToujoursVues.load(), "Les clés paires devraient toujours être trouvées");
+    ASSERT_EQUAL(cles, CompterElements((const ListeSimple*)liste), "La taille devrait être conservée");
+    for (int cle = 1; cle < cles; cle += 2) {
+        SupprimerValeurDifferee(liste, cle);
+    }
+    ASSERT_EQUAL(cles / 2, CompterElements((const ListeSimple*)liste), "Seules les paires devraient rester");
+    ASSERT_EQUAL(0, liste->queue->donnee % 2, "La queue devrait suivre les suppressions");
+    ASSERT_FALSE(RechercherValeurProtegee(liste, 1), "Une clé supprimée n'est plus trouvée");
+    Detruire(liste);
+}
+
+// ============================================================================
+// TESTS DE LA LISTE FRAGMENTÉE
+// ============================================================================
+
+TEST_CASE(TestFragmenteeParValeur) {
+    ASSERT_NULL(AllocateFragmentee(0), "Il faut au moins un fragment");
+    ListeFragmentee* liste = AllocateFragmentee(4);
+    ASSERT_NOT_NULL(liste, "Le conteneur devrait être créé");
+    ASSERT_TRUE(EstVide(liste), "Le conteneur commence vide");
+
+    for (int i = 0; i < 20; i++) {
+        ASSERT_TRUE(InsererFin(liste, i), "Insertion d'une valeur");
+    }
+    const int lot[] = {100, 101, 102, 103, 104};
+    ASSERT_EQUAL(5, InsererLot(liste, lot, 5), "Insertion d'un lot");
+    ASSERT_EQUAL(25, CompterElements(liste), "Le total couvre tous les fragments");
+    ASSERT_TRUE(RechercherValeur(liste, 13), "Valeur insérée seule");
+    ASSERT_TRUE(RechercherValeur(liste, 104), "Valeur insérée par lot");
+    ASSERT_FALSE(RechercherValeur(liste, 50), "Valeur absente");
+
+    ASSERT_TRUE(SupprimerValeur(liste, 13), "Suppression d'une valeur présente");
+    ASSERT_FALSE(SupprimerValeur(liste, 13), "La valeur n'est plus présente");
+    std::string texte = ToString(liste);
+    ASSERT_EQUAL(0, (int)texte.find("Fragments[Liste["), "Format fragment par fragment");
+    ASSERT_EQUAL(3, (int)std::count(texte.begin(), texte.end(), '|'), "Un séparateur entre chaque fragment");
+
+    // Les nœuds sont raccordés à la suite de la destination, sans copie
+    ListeSimple* destination = AllocateSimple();
+    InsererFin(destination, -1);
+    ASSERT_EQUAL(24, ConcatenerTout(liste, destination), "Tous les éléments sont déplacés");
+    ASSERT_TRUE(EstVide(liste), "Les fragments sont vidés");
+    ASSERT_EQUAL(25, CompterElements((const ListeSimple*)destination), "La destination garde ses éléments");
+    ASSERT_EQUAL(-1, destination->tete->donnee, "Les fragments sont ajoutés après la destination");
+    int vus = 0;
+    int somme = 0;
+    for (NoeudS* noeud = destination->tete; noeud != nullptr; noeud = noeud->suivant) {
+        vus++;
+        somme += noeud->donnee;
+        ASSERT_TRUE(noeud->suivant != nullptr || noeud == destination->queue, "La queue est le dernier nœud");
+    }
+    ASSERT_EQUAL(25, vus, "La chaîne raccordée a la bonne longueur");
+    ASSERT_EQUAL(-1 + 190 - 13 + 510, somme, "Aucune valeur perdue ni dupliquée");
+
+    ASSERT_EQUAL(0, ConcatenerTout(liste, destination), "Un conteneur vide ne déplace rien");
+    Detruire(destination);
+    Detruire(liste);
+}
+
+TEST_CASE(TestFragmenteeChargeursParalleles) {
+    const int chargeurs = 4;
+    const int parChargeur = 2000;
+    ListeFragmentee* liste = AllocateFragmentee(chargeurs, FRAGMENTS_PAR_THREAD);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < chargeurs; t++) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < parChargeur; i += 2) {
+                InsererFin(liste, t * parChargeur + i);
+                int suivante = t * parChargeur + i + 1;
+                InsererLot(liste, &suivante, 1);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQUAL(chargeurs * parChargeur, CompterElements(liste), "Aucune insertion perdue");
+
+    ListeSimple* resultat = AllocateSimple();
+    ASSERT_EQUAL(chargeurs * parChargeur, ConcatenerTout(liste, resultat), "Tout est déplacé");
+
+    // Chaque chargeur écrit dans un seul fragment : ses valeurs restent croissantes
+    std::vector<int> derniere(chargeurs, -1);
+    bool ordreConserve = true;
+    for (NoeudS* noeud = resultat->tete; noeud != nullptr; noeud = noeud->suivant) {
+        int chargeur = noeud->donnee / parChargeur;
+        ordreConserve = ordreConserve && noeud->donnee > derniere[chargeur];
+        derniere[chargeur] = noeud->donnee;
+    }
+    ASSERT_TRUE(ordreConserve, "L'ordre d'insertion est conservé pour chaque chargeur");
+    ASSERT_EQUAL(chargeurs * parChargeur, CompterElements((const ListeSimple*)resultat), "Taille de la destination");
+    Detruire(resultat);
+    Detruire(liste);
+}
+
+// ============================================================================
+// TESTS DE LA LISTE SEGMENTÉE ET DU PARCOURS PARALLÈLE
+// ============================================================================
+
+TEST_CASE(TestSegmenteeSimpleModifications) {
+    const int pas = 4;
+    ListeSimpleSegmentee* liste = AllocateSimpleSegmentee(pas);
+    ASSERT_NOT_NULL(liste, "La liste devrait être créée");
+    ASSERT_NULL(AllocateSimpleSegmentee(1), "Un pas de 1 est refusé");
+
+    // Modifications pseudo-aléatoires comparées à un vecteur de référence
+    std::vector<int> reference;
+    unsigned int graine = 7;
+    bool conforme = true;
+    for (int i = 0; i < 3000; i++) {
+        graine = graine * 1103515245u + 12345u;
+        int taille = (int)reference.size();
+        int position = taille > 0 ? (int)((graine >> 8) % (unsigned int)(taille + 1)) : 0;
+        if ((graine >> 4) % 5 < 3 || taille < 8) {
+            conforme = conforme && InsererPosition(liste, position, i);
+            reference.insert(reference.begin() + position, i);
+        } else if (position < taille) {
+            conforme = conforme && SupprimerPosition(liste, position);
+            reference.erase(reference.begin() + position);
+        }
+
+        // Les segments couvrent la liste, dans l'ordre, avec des longueurs bornées
+        NoeudS* noeud = liste->liste.tete;
+        int couverts = 0;
+        for (int s = 0; s < liste->nombreSegments; s++) {
+            conforme = conforme && liste->segments[s].debut == noeud && liste->segments[s].taille >= 1 &&
+                       liste->segments[s].taille <= 2 * pas + pas / 2;
+            for (int k = 0; k < liste->segments[s].taille && noeud != nullptr; k++) {
+                noeud = noeud->suivant;
+                couverts++;
+            }
+        }
+        conforme = conforme && noeud == nullptr && couverts == (int)reference.size();
+    }
+    ASSERT_TRUE(conforme, "La table de segments devrait suivre chaque modification");
+    ASSERT_EQUAL((int)reference.size(), CompterElements(liste), "Même taille que la référence");
+    bool memesValeurs = true;
+    for (int i = 0; i < (int)reference.size(); i++) {
+        memesValeurs = memesValeurs && ObtenirNoeudPosition(liste, i)->donnee == reference[i];
+    }
+    ASSERT_TRUE(memesValeurs, "Même contenu que la référence, par position");
+    ASSERT_FALSE(SupprimerPosition(liste, (int)reference.size()), "Position hors de la liste");
+    ASSERT_NULL(ObtenirNoeudPosition(liste, -1), "Position négative");
+    Detruire(liste);
+}
+
+TEST_CASE(TestParcoursParalleleSimple) {
+    ListeSimple* source = AllocateSimple();
+    for (int i = 0; i < 10000; i++) {
+        InsererFin(source, i % 97);
+    }
+    ListeSimpleSegmentee* liste = Segmenter(source, 64);
+    ASSERT_NOT_NULL(liste, "La liste devrait être segmentée");
+    ASSERT_TRUE(EstVide(source), "Les nœuds quittent la source");
+    ASSERT_EQUAL(10000, CompterElements(liste), "Tous les nœuds sont repris");
+    Detruire(source);
+
+    long long attendue = 0;
+    for (int i = 0; i < 10000; i++) {
+        attendue += i % 97;
+    }
+    auto accumuler = [](long long& somme, int valeur) { somme += valeur; };
+    auto fusionner = [](long long& somme, const long long& partiel) { somme += partiel; };
+    ASSERT_EQUAL(attendue, ParcourirParallele(liste, 4, 0LL, accumuler, fusionner), "Somme sur 4 threads");
+    ASSERT_EQUAL(attendue, ParcourirParallele(liste, 1, 0LL, accumuler, fusionner), "Somme sur 1 thread");
+
+    // Histogramme et comptage filtré
+    std::vector<int> histogramme = ParcourirParallele(liste, 3, std::vector<int>(97, 0),
+        [](std::vector<int>& h, int valeur) { h[valeur]++; },
+        [](std::vector<int>& h, const std::vector<int>& p) {
+            for (size_t i = 0; i < h.size(); i++) {
+                h[i] += p[i];
+            }
+        });
+    ASSERT_EQUAL(104, histogramme[0], "Occurrences de 0");
+    ASSERT_EQUAL(103, histogramme[96], "Occurrences de 96");
+    int pairs = ParcourirParallele(liste, 0, 0,
+        [](int& n, int valeur) { n += valeur % 2 == 0 ? 1 : 0; },
+        [](int& n, const int& p) { n += p; });
+    ASSERT_EQUAL(10000 - ParcourirParallele(liste, 2, 0, [](int& n, int valeur) { n += valeur % 2; },
+                                            [](int& n, const int& p) { n += p; }),
+                 pairs, "Comptage filtré");
+
+    // Réduction flottante : même résultat bit à bit quel que soit le nombre de threads
+    auto accumulerFlottant = [](double& somme, int valeur) { somme += 1.0 / (valeur + 1); };
+    auto fusionnerFlottant = [](double& somme, const double& partiel) { somme += partiel; };
+    double un = ParcourirParallele(liste, 1, 0.0, accumulerFlottant, fusionnerFlottant);
+    double huit = ParcourirParallele(liste, 8, 0.0, accumulerFlottant, fusionnerFlottant);
+    ASSERT_TRUE(un == huit, "La réduction est déterministe");
+
+    ListeSimpleSegmentee* vide = AllocateSimpleSegmentee();
+    ASSERT_EQUAL(0LL, ParcourirParallele(vide, 4, 0LL, accumuler, fusionner), "Liste vide : valeur neutre");
+    Detruire(vide);
+    Detruire(liste);
+}
+
+// ============================================================================
+// TESTS DE LA LISTE TRIÉE À COMBINAISON
+// ============================================================================
+
+TEST_CASE(TestCombineeSequentiel) {
+    ListeCombinee* liste = AllocateCombinee();
+    ASSERT_NOT_NULL(liste, "La liste devrait être créée");
+
+    const int valeurs[] = {5, 1, 9, 5, 3};
+    for (int valeur : valeurs) {
+        ASSERT_TRUE(InsererTrie(liste, valeur), "Insertion triée");
+    }
+    ASSERT_EQUAL(std::string("Liste[Noeud(1) -> Noeud(3) -> Noeud(5) -> Noeud(5) -> Noeud(9)]"),
+                 ToString((const ListeCombinee*)liste), "Les valeurs sont rangées");
+    ASSERT_TRUE(RechercherValeur(liste, 9), "Valeur présente");
+    ASSERT_FALSE(RechercherValeur(liste, 4), "Valeur absente");
+    ASSERT_TRUE(SupprimerValeur(liste, 5), "Suppression d'une occurrence");
+    ASSERT_TRUE(SupprimerValeur(liste, 9), "Suppression de la queue");
+    ASSERT_FALSE(SupprimerValeur(liste, 9), "Plus d'occurrence");
+    ASSERT_TRUE(InsererTrie(liste, 10), "Insertion après la nouvelle queue");
+    ASSERT_EQUAL(10, liste->liste.queue->donnee, "La queue suit les suppressions");
+    ASSERT_EQUAL(4, CompterElements(liste), "Quatre éléments");
+    Detruire(liste);
+}
+
+TEST_CASE(TestCombineeThreads) {
+    ListeCombinee* liste = AllocateCombinee();
+    const int threadsNombre = 4;
+    const int parThread = 500;
+
+    // Chaque thread insère ses valeurs (t, t + 4, ...), retire ses multiples de 3 et vérifie les autres
+    std::atomic<bool> coherent(true);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsNombre; t++) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < parThread; i++) {
+                InsererTrie(liste, i * threadsNombre + t);
+            }
+            for (int i = 0; i < parThread; i++) {
+                int valeur = i * threadsNombre + t;
+                if (valeur % 3 == 0) {
+                    coherent = coherent && SupprimerValeur(liste, valeur) && !RechercherValeur(liste, valeur);
+                } else {
+                    coherent = coherent && RechercherValeur(liste, valeur);
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_TRUE(coherent.load(), "Chaque thread devrait voir ses propres modifications");
+    int attendus = 0;
+    for (int valeur = 0; valeur < threadsNombre * parThread; valeur++) {
+        attendus += valeur % 3 != 0 ? 1 : 0;
+    }
+    ASSERT_EQUAL(attendus, CompterElements(liste), "Taille après insertions et suppressions");
+    bool trie = true;
+    int vus = 0;
+    for (NoeudS* noeud = liste->liste.tete; noeud != nullptr; noeud = noeud->suivant) {
+        trie = trie && noeud->donnee % 3 != 0 && (noeud->suivant == nullptr || noeud->donnee < noeud->suivant->donnee);
+        vus++;
+    }
+    ASSERT_TRUE(trie && vus == attendus, "La liste reste triée, sans valeur supprimée");
+    Detruire(liste);
+}
@@ -0,0 +1,187 @@
+#ifndef LISTE_ATOMIQUE_H
+#define LISTE_ATOMIQUE_H
+
+#include "ListS.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+/**
+ * Outils communs aux structures sans verrou : pointeurs marqués, accès
+ * atomiques aux liens d'un NoeudS et attente active.
+ *
+ * Un pointeur marqué range une adresse sur 48 bits et un compteur de
+ * modifications (la marque) sur les 16 bits de poids fort d'un même mot de
+ * 64 bits. Chaque écriture incrémente la marque : un compare-and-swap qui
+ * attend (A, m) échoue si la tête est passée par B puis revenue à A entre
+ * temps (problème ABA), sauf si exactement 65536 modifications ont eu lieu
+ * entre la lecture et l'échange.
+ */
+
+static_assert(sizeof(void*) == 8, "Les pointeurs marqués supposent des adresses sur 64 bits");
+
+/**
+ * @brief Adresse (48 bits de poids faible) et marque (16 bits de poids fort)
+ */
+typedef uint64_t PointeurMarque;
+
+#define MARQUE_DECALAGE 48
+#define MARQUE_MASQUE_ADRESSE ((UINT64_C(1) << MARQUE_DECALAGE) - 1)
+
+/**
+ * @brief Assemble une adresse et une marque
+ */
+static inline PointeurMarque Marquer(const void* adresse, uint16_t marque) {
+    return ((uint64_t)(uintptr_t)adresse & MARQUE_MASQUE_ADRESSE) | ((uint64_t)marque << MARQUE_DECALAGE);
+}
+
+/**
+ * @brief Adresse contenue dans un pointeur marqué
+ */
+template <typename T>
+static inline T* AdresseDe(PointeurMarque valeur) {
+    return (T*)(uintptr_t)(valeur & MARQUE_MASQUE_ADRESSE);
+}
+
+static inline uint16_t MarqueDe(PointeurMarque valeur) {
+    return (uint16_t)(valeur >> MARQUE_DECALAGE);
+}
+
+/**
+ * @brief Valeur qui remplace ancien par adresse en incrémentant la marque
+ */
+static inline PointeurMarque Remplacer(PointeurMarque ancien, const void* adresse) {
+    return Marquer(adresse, (uint16_t)(MarqueDe(ancien) + 1));
+}
+
+// ============================================================================
+// LIENS ATOMIQUES D'UN NŒUD
+// ============================================================================
+
+/**
+ * @brief Lit le lien suivant d'un nœud que d'autres threads peuvent réécrire
+ */
+static inline NoeudS* LireSuivant(NoeudS* noeud, std::memory_order ordre = std::memory_order_acquire) {
+    return std::atomic_ref<NoeudS*>(noeud->suivant).load(ordre);
+}
+
+static inline void EcrireSuivant(NoeudS* noeud, NoeudS* suivant, std::memory_order ordre = std::memory_order_release) {
+    std::atomic_ref<NoeudS*>(noeud->suivant).store(suivant, ordre);
+}
+
+/**
+ * @brief Lit le lien suivant d'un nœud comme un pointeur marqué
+ *
+ * Les structures dont le lien suivant lui-même est disputé (file, ensemble)
+ * y rangent un pointeur marqué : l'adresse reste dans les 48 bits de poids
+ * faible et seule la marque distingue deux écritures de la même adresse.
+ * Leur contenu ne se lit donc qu'à travers AdresseDe.
+ */
+static inline PointeurMarque LireLienMarque(NoeudS* noeud, std::memory_order ordre = std::memory_order_acquire) {
+    return (PointeurMarque)(uintptr_t)std::atomic_ref<NoeudS*>(noeud->suivant).load(ordre);
+}
+
+static inline void EcrireLienMarque(NoeudS* noeud, PointeurMarque lien,
+                                    std::memory_order ordre = std::memory_order_release) {
+    std::atomic_ref<NoeudS*>(noeud->suivant).store((NoeudS*)(uintptr_t)lien, ordre);
+}
+
+/**
+ * @brief Compare-and-swap du lien suivant marqué
+ * @return true si le lien valait attendu et vaut désormais nouveau
+ */
+static inline bool EchangerLienMarque(NoeudS* noeud, PointeurMarque attendu, PointeurMarque nouveau) {
+    NoeudS* attenduBrut = (NoeudS*)(uintptr_t)attendu;
+    return std::atomic_ref<NoeudS*>(noeud->suivant).compare_exchange_strong(
+        attenduBrut, (NoeudS*)(uintptr_t)nouveau, std::memory_order_acq_rel, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Indique si un lien porte la marque de retrait logique (bit de poids faible)
+ *
+ * Dans un ensemble de Harris, un nœud est supprimé logiquement en marquant
+ * son propre lien suivant : plus aucun compare-and-swap ne peut alors
+ * accrocher un nœud derrière lui, puis il est décroché physiquement.
+ * Les nœuds (NoeudS comme NoeudD) étant alignés sur 8 octets, le bit 0
+ * d'une adresse est libre.
+ */
+template <typename Noeud>
+static inline bool EstRetire(const Noeud* lien) {
+    return ((uintptr_t)lien & 1u) != 0;
+}
+
+template <typename Noeud>
+static inline Noeud* AvecRetrait(const Noeud* lien) {
+    return (Noeud*)((uintptr_t)lien | 1u);
+}
+
+template <typename Noeud>
+static inline Noeud* SansRetrait(const Noeud* lien) {
+    return (Noeud*)((uintptr_t)lien & ~(uintptr_t)1u);
+}
+
+/**
+ * @brief Compare-and-swap du lien suivant (valeurs brutes, marque comprise)
+ */
+static inline bool EchangerSuivant(NoeudS* noeud, NoeudS* attendu, NoeudS* nouveau) {
+    return std::atomic_ref<NoeudS*>(noeud->suivant).compare_exchange_strong(
+        attendu, nouveau, std::memory_order_acq_rel, std::memory_order_acquire);
+}
+
+/**
+ * @brief Donnée d'un nœud qu'un autre thread peut recycler pendant la lecture
+ */
+static inline int LireDonnee(NoeudS* noeud) {
+    return std::atomic_ref<int>(noeud->donnee).load(std::memory_order_relaxed);
+}
+
+static inline void EcrireDonnee(NoeudS* noeud, int valeur) {
+    std::atomic_ref<int>(noeud->donnee).store(valeur, std::memory_order_relaxed);
+}
+
+// ============================================================================
+// ATTENTE ACTIVE
+// ============================================================================
+
+/**
+ * @brief Indique au processeur une boucle d'attente (libère le cœur voisin en SMT)
+ */
+static inline void PauseProcesseur() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#else
+    std::this_thread::yield();
+#endif
+}
+
+/**
+ * @brief Recul exponentiel borné entre deux tentatives de compare-and-swap
+ */
+typedef struct {
+    int attente;          /**< Nombre de pauses de la prochaine attente */
+    int maximum;          /**< Plafond de attente */
+} ReculExponentiel;
+
+static inline ReculExponentiel CreerRecul(int maximum = 1024) {
+    return ReculExponentiel{1, maximum};
+}
+
+static inline void Reculer(ReculExponentiel* recul) {
+    for (int i = 0; i < recul->attente; i++) {
+        PauseProcesseur();
+    }
+    if (recul->attente < recul->maximum) {
+        recul->attente *= 2;
+    } else {
+        // Au plafond, laisser la main : indispensable quand les threads dépassent les cœurs
+        std::this_thread::yield();
+    }
+}
+
+#endif
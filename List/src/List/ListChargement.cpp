@@ -0,0 +1,206 @@
+#include "ListChargement.h"
+#include "ListParcours.h"
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#define lire_fichier _read
+#define ouvrir_fichier _open
+#define fermer_fichier _close
+#define OUVERTURE_LECTURE (_O_RDONLY | _O_BINARY)
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#define lire_fichier read
+#define ouvrir_fichier open
+#define fermer_fichier close
+#define OUVERTURE_LECTURE O_RDONLY
+#endif
+
+// ============================================================================
+// OUTILS INTERNES
+// ============================================================================
+
+/**
+ * @brief Chaîne de nœuds construite hors de la liste puis raccordée en O(1)
+ */
+typedef struct {
+    NoeudS* tete;
+    NoeudS* queue;
+    int taille;
+} LotNoeuds;
+
+static inline bool EstSeparateur(char c) {
+    return c == ',' || c == '\n' || c == ';' || c == '\r';
+}
+
+static inline bool EstEspace(char c) {
+    return c == ' ' || c == '\t';
+}
+
+static void RaccorderLot(ListeSimple* liste, LotNoeuds* lot) {
+    if (lot->tete == nullptr) {
+        return;
+    }
+
+    if (EstVide(liste)) {
+        liste->tete = lot->tete;
+    } else {
+        liste->queue->suivant = lot->tete;
+    }
+    liste->queue = lot->queue;
+    if (liste->estCirculaire) {
+        liste->queue->suivant = liste->tete;
+    }
+    liste->taille += lot->taille;
+    AjusterSauts(liste);
+
+    lot->tete = nullptr;
+    lot->queue = nullptr;
+    lot->taille = 0;
+}
+
+/**
+ * @brief Analyse une zone ne contenant que des jetons complets
+ * @return false si un nœud n'a pas pu être alloué
+ */
+static bool AnalyserBloc(const char* p, const char* fin, LotNoeuds* lot, long long* rejetes) {
+    while (p < fin) {
+        while (p < fin && EstEspace(*p)) {
+            p++;
+        }
+        if (p == fin) {
+            break;
+        }
+        if (EstSeparateur(*p)) {
+            p++;
+            continue;
+        }
+
+        const char* debut = (*p == '+') ? p + 1 : p;
+        int valeur = 0;
+        std::from_chars_result resultat = {debut, std::errc::invalid_argument};
+        // Un seul signe : "+-5" et "++5" sont des jetons invalides
+        if (debut == p || (debut < fin && *debut != '-' && *debut != '+')) {
+            resultat = std::from_chars(debut, fin, valeur);
+        }
+        const char* q = resultat.ptr;
+        while (q < fin && EstEspace(*q)) {
+            q++;
+        }
+
+        if (resultat.ec == std::errc() && (q == fin || EstSeparateur(*q))) {
+            NoeudS* nouveau = CreerNoeudS(valeur);
+            if (nouveau == nullptr) {
+                return false;
+            }
+            if (lot->queue == nullptr) {
+                lot->tete = nouveau;
+            } else {
+                lot->queue->suivant = nouveau;
+            }
+            lot->queue = nouveau;
+            lot->taille++;
+        } else {
+            (*rejetes)++;
+            while (q < fin && !EstSeparateur(*q)) {
+                q++;
+            }
+        }
+        p = q;
+    }
+    return true;
+}
+
+// ============================================================================
+// FONCTIONS DE CHARGEMENT
+// ============================================================================
+
+long long ChargerTexte(int descripteur, ListeSimple* liste, long long* rejetes) {
+    if (liste == nullptr || descripteur < 0) {
+        return -1;
+    }
+
+    char* tampon = (char*)malloc(TAILLE_TAMPON_CHARGEMENT);
+    if (tampon == nullptr) {
+        return -1;
+    }
+
+    long long inseres = 0;
+    long long invalides = 0;
+    size_t rempli = 0;
+    bool finFichier = false;
+    bool ignorerJeton = false; // Jeton plus long que le tampon : ignoré jusqu'au séparateur
+    bool erreur = false;
+    LotNoeuds lot = { nullptr, nullptr, 0 };
+
+    while (!finFichier && !erreur) {
+        long lus = (long)lire_fichier(descripteur, tampon + rempli, (unsigned)(TAILLE_TAMPON_CHARGEMENT - rempli));
+        if (lus < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            erreur = true;
+            break;
+        }
+        finFichier = (lus == 0);
+        rempli += (size_t)lus;
+
+        size_t debut = 0;
+        if (ignorerJeton) {
+            while (debut < rempli && !EstSeparateur(tampon[debut])) {
+                debut++;
+            }
+            ignorerJeton = (debut == rempli && !finFichier);
+        }
+
+        // Seuls les jetons terminés par un séparateur sont analysés ; la fin
+        // du tampon (jeton coupé) est reportée au bloc suivant.
+        size_t limite = rempli;
+        if (!finFichier) {
+            while (limite > debut && !EstSeparateur(tampon[limite - 1])) {
+                limite--;
+            }
+            if (limite == debut && rempli == TAILLE_TAMPON_CHARGEMENT) {
+                if (!ignorerJeton) {
+                    invalides++;
+                }
+                ignorerJeton = true;
+                rempli = 0;
+                continue;
+            }
+        }
+
+        erreur = !AnalyserBloc(tampon + debut, tampon + limite, &lot, &invalides);
+        inseres += lot.taille;
+        RaccorderLot(liste, &lot);
+
+        memmove(tampon, tampon + limite, rempli - limite);
+        rempli -= limite;
+    }
+
+    free(tampon);
+    if (rejetes != nullptr) {
+        *rejetes = invalides;
+    }
+    return erreur ? -1 : inseres;
+}
+
+long long ChargerTexte(const char* chemin, ListeSimple* liste, long long* rejetes) {
+    if (chemin == nullptr || liste == nullptr) {
+        return -1;
+    }
+
+    int descripteur = ouvrir_fichier(chemin, OUVERTURE_LECTURE);
+    if (descripteur < 0) {
+        return -1;
+    }
+
+    long long resultat = ChargerTexte(descripteur, liste, rejetes);
+    fermer_fichier(descripteur);
+    return resultat;
+}
@@ -0,0 +1,43 @@
+#ifndef LISTE_CHARGEMENT_H
+#define LISTE_CHARGEMENT_H
+
+#include "ListS.h"
+
+/**
+ * @brief Taille du tampon de lecture utilisé par ChargerTexte (octets)
+ *
+ * La mémoire consommée par le chargement est bornée par cette valeur,
+ * quelle que soit la taille du fichier lu.
+ */
+#define TAILLE_TAMPON_CHARGEMENT (1 << 20)
+
+// ============================================================================
+// FONCTIONS DE CHARGEMENT
+// ============================================================================
+
+/**
+ * @brief Ajoute à la fin de la liste les entiers lus dans un fichier texte
+ *
+ * Les valeurs sont séparées par des virgules, points-virgules ou fins de ligne
+ * (les espaces autour sont ignorés). Le fichier est lu par blocs, analysé avec
+ * std::from_chars puis chaque bloc est raccordé à la liste en une seule fois.
+ * Chaque valeur reste un nœud alloué par malloc, que Detruire et les
+ * suppressions libèrent un à un : le débit est borné par cette allocation
+ * autant que par l'analyse (voir le benchmark ChargementTexte).
+ * @param chemin Chemin du fichier à lire
+ * @param liste Pointeur vers la liste qui reçoit les valeurs
+ * @param rejetes Pointeur pour stocker le nombre de jetons invalides (peut être NULL)
+ * @return Nombre de valeurs insérées, ou -1 si le fichier n'a pas pu être lu
+ */
+long long ChargerTexte(const char* chemin, ListeSimple* liste, long long* rejetes);
+
+/**
+ * @brief Ajoute à la fin de la liste les entiers lus depuis un descripteur ouvert
+ * @param descripteur Descripteur de fichier en lecture (non fermé par la fonction)
+ * @param liste Pointeur vers la liste qui reçoit les valeurs
+ * @param rejetes Pointeur pour stocker le nombre de jetons invalides (peut être NULL)
+ * @return Nombre de valeurs insérées, ou -1 en cas d'erreur de lecture
+ */
+long long ChargerTexte(int descripteur, ListeSimple* liste, long long* rejetes);
+
+#endif
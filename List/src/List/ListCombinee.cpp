@@ -0,0 +1,288 @@
+#include "ListCombinee.h"
+#include "ListAtomique.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+// ============================================================================
+// CASES DE PUBLICATION (usage interne)
+// ============================================================================
+
+#define CASE_LIBRE 0
+#define CASE_RESERVEE 1
+#define CASE_EN_ATTENTE 2
+#define CASE_TRAITEE 3
+
+// Passes de ramassage au plus par combineur, pour ne pas le garder indéfiniment
+#define COMBINAISON_PASSES 4
+
+/**
+ * @brief Indices de départ attribués aux threads vivants, partagés par toutes les listes
+ */
+static std::atomic<bool> indicesOccupes[COMBINAISON_PUBLICATIONS_MAX];
+
+namespace {
+
+    /**
+     * @brief Indice de départ du thread, rendu à sa fin pour que les cases utilisées restent denses
+     */
+    struct AttacheCombinaison {
+        int indice = -1;
+
+        ~AttacheCombinaison() {
+            if (indice >= 0) {
+                indicesOccupes[indice].store(false, std::memory_order_release);
+            }
+        }
+    };
+
+} // namespace
+
+static int IndiceDuThread() {
+    static thread_local AttacheCombinaison attache;
+    if (attache.indice < 0) {
+        for (int i = 0; i < COMBINAISON_PUBLICATIONS_MAX; i++) {
+            bool attendu = false;
+            if (indicesOccupes[i].compare_exchange_strong(attendu, true, std::memory_order_acquire)) {
+                attache.indice = i;
+                break;
+            }
+        }
+    }
+    // Plus de threads que de cases : partir de 0 et chercher une case libre
+    return attache.indice >= 0 ? attache.indice : 0;
+}
+
+/**
+ * @brief Réserve une case de publication, en commençant par celle du thread
+ */
+static PublicationCombinee* ReserverCase(ListeCombinee* liste) {
+    int depart = IndiceDuThread();
+    ReculExponentiel recul = CreerRecul();
+    while (true) {
+        for (int k = 0; k < COMBINAISON_PUBLICATIONS_MAX; k++) {
+            int i = (depart + k) % COMBINAISON_PUBLICATIONS_MAX;
+            PublicationCombinee* publication = &liste->publications[i];
+            int attendu = CASE_LIBRE;
+            if (publication->etat.load(std::memory_order_relaxed) == CASE_LIBRE &&
+                publication->etat.compare_exchange_strong(attendu, CASE_RESERVEE, std::memory_order_acquire)) {
+                // Le combineur ne parcourt que [0, limite)
+                int limite = liste->limite.load(std::memory_order_relaxed);
+                while (limite <= i && !liste->limite.compare_exchange_weak(limite, i + 1, std::memory_order_release)) {
+                }
+                return publication;
+            }
+        }
+        Reculer(&recul);
+    }
+}
+
+// ============================================================================
+// COMBINAISON (usage interne, verrou de combinaison tenu)
+// ============================================================================
+
+/**
+ * @brief Ramasse les requêtes en attente, classées par valeur (à valeur égale, dans l'ordre des cases)
+ * @return Nombre de requêtes ramassées
+ */
+static int Ramasser(ListeCombinee* liste, PublicationCombinee** requetes) {
+    int nombre = 0;
+    int limite = liste->limite.load(std::memory_order_acquire);
+    for (int i = 0; i < limite; i++) {
+        PublicationCombinee* publication = &liste->publications[i];
+        if (publication->etat.load(std::memory_order_acquire) != CASE_EN_ATTENTE) {
+            continue;
+        }
+        // Tri par insertion : les lots sont petits et l'ordre doit rester stable
+        int j = nombre++;
+        while (j > 0 && requetes[j - 1]->valeur > publication->valeur) {
+            requetes[j] = requetes[j - 1];
+            j--;
+        }
+        requetes[j] = publication;
+    }
+    return nombre;
+}
+
+/**
+ * @brief Applique des requêtes classées par valeur en une seule marche sur la liste triée
+ *
+ * Un nœud inséré devient le courant : une recherche ou une suppression
+ * de la même valeur plus loin dans le lot le voit.
+ */
+static void Appliquer(ListeSimple* liste, PublicationCombinee** requetes, int nombre) {
+    NoeudS* precedent = nullptr;
+    NoeudS* courant = liste->tete;
+    int taille = liste->taille;
+
+    for (int r = 0; r < nombre; r++) {
+        PublicationCombinee* requete = requetes[r];
+        while (courant != nullptr && courant->donnee < requete->valeur) {
+            precedent = courant;
+            courant = courant->suivant;
+        }
+
+        switch (requete->operation) {
+        case COMBINAISON_INSERER: {
+            NoeudS* noeud = requete->noeud;
+            noeud->suivant = courant;
+            if (precedent == nullptr) {
+                liste->tete = noeud;
+            } else {
+                precedent->suivant = noeud;
+            }
+            if (courant == nullptr) {
+                liste->queue = noeud;
+            }
+            courant = noeud;
+            taille++;
+            requete->resultat = true;
+            break;
+        }
+        case COMBINAISON_SUPPRIMER:
+            requete->resultat = courant != nullptr && courant->donnee == requete->valeur;
+            requete->noeud = nullptr;
+            if (requete->resultat) {
+                // Le nœud est rendu au déposant, qui le libère hors du verrou
+                requete->noeud = courant;
+                courant = courant->suivant;
+                if (precedent == nullptr) {
+                    liste->tete = courant;
+                } else {
+                    precedent->suivant = courant;
+                }
+                if (courant == nullptr) {
+                    liste->queue = precedent;
+                }
+                taille--;
+            }
+            break;
+        case COMBINAISON_RECHERCHER:
+            requete->resultat = courant != nullptr && courant->donnee == requete->valeur;
+            break;
+        }
+    }
+    std::atomic_ref<int>(liste->taille).store(taille, std::memory_order_relaxed);
+}
+
+static void Combiner(ListeCombinee* liste) {
+    PublicationCombinee* requetes[COMBINAISON_PUBLICATIONS_MAX];
+    for (int passe = 0; passe < COMBINAISON_PASSES; passe++) {
+        int nombre = Ramasser(liste, requetes);
+        if (nombre == 0) {
+            return;
+        }
+        Appliquer(&liste->liste, requetes, nombre);
+        for (int r = 0; r < nombre; r++) {
+            requetes[r]->etat.store(CASE_TRAITEE, std::memory_order_release);
+        }
+    }
+}
+
+/**
+ * @brief Publie une requête et attend sa réponse, en devenant combineur si le verrou est libre
+ * @param noeud Nœud préparé pour une insertion ; reçoit le nœud rendu par une suppression
+ */
+static bool Executer(ListeCombinee* liste, OperationCombinee operation, int valeur, NoeudS** noeud) {
+    PublicationCombinee* publication = ReserverCase(liste);
+    publication->operation = operation;
+    publication->valeur = valeur;
+    publication->noeud = *noeud;
+    publication->etat.store(CASE_EN_ATTENTE, std::memory_order_release);
+
+    ReculExponentiel recul = CreerRecul();
+    while (publication->etat.load(std::memory_order_acquire) != CASE_TRAITEE) {
+        if (!liste->verrou.load(std::memory_order_relaxed) &&
+            !liste->verrou.exchange(true, std::memory_order_acquire)) {
+            // Notre requête était publiée avant la prise du verrou : ce passage la traite
+            Combiner(liste);
+            liste->verrou.store(false, std::memory_order_release);
+        } else {
+            Reculer(&recul);
+        }
+    }
+
+    bool resultat = publication->resultat;
+    *noeud = publication->noeud;
+    publication->etat.store(CASE_LIBRE, std::memory_order_release);
+    return resultat;
+}
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+ListeCombinee* AllocateCombinee() {
+    ListeCombinee* liste = new (std::nothrow) ListeCombinee;
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    liste->liste = CreerSimple();
+    liste->verrou.store(false, std::memory_order_relaxed);
+    liste->limite.store(0, std::memory_order_relaxed);
+    for (int i = 0; i < COMBINAISON_PUBLICATIONS_MAX; i++) {
+        liste->publications[i].etat.store(CASE_LIBRE, std::memory_order_relaxed);
+    }
+    return liste;
+}
+
+void Detruire(ListeCombinee* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    Nettoyer(&liste->liste);
+    delete liste;
+}
+
+// ============================================================================
+// OPÉRATIONS CONCURRENTES
+// ============================================================================
+
+bool InsererTrie(ListeCombinee* liste, int valeur) {
+    if (liste == nullptr) {
+        return false;
+    }
+    // Allocation hors combinaison : le combineur ne fait que relier
+    NoeudS* noeud = CreerNoeudS(valeur);
+    if (noeud == nullptr) {
+        return false;
+    }
+    return Executer(liste, COMBINAISON_INSERER, valeur, &noeud);
+}
+
+bool SupprimerValeur(ListeCombinee* liste, int valeur) {
+    if (liste == nullptr) {
+        return false;
+    }
+    NoeudS* rendu = nullptr;
+    bool supprime = Executer(liste, COMBINAISON_SUPPRIMER, valeur, &rendu);
+    free(rendu);
+    return supprime;
+}
+
+bool RechercherValeur(ListeCombinee* liste, int valeur) {
+    if (liste == nullptr) {
+        return false;
+    }
+    NoeudS* aucun = nullptr;
+    return Executer(liste, COMBINAISON_RECHERCHER, valeur, &aucun);
+}
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+int CompterElements(const ListeCombinee* liste) {
+    if (liste == nullptr) {
+        return 0;
+    }
+    return std::atomic_ref<int>(const_cast<int&>(liste->liste.taille)).load(std::memory_order_relaxed);
+}
+
+std::string ToString(const ListeCombinee* liste) {
+    if (liste == nullptr) {
+        return "Liste[NULL]";
+    }
+    return ToString(&liste->liste);
+}
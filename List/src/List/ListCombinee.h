@@ -0,0 +1,104 @@
+#ifndef LISTE_COMBINEE_H
+#define LISTE_COMBINEE_H
+
+#include "ListS.h"
+#include <atomic>
+#include <string>
+
+#define COMBINAISON_PUBLICATIONS_MAX 256
+
+/**
+ * @brief Opération déposée dans une case de publication
+ */
+typedef enum {
+    COMBINAISON_INSERER = 0,      /**< InsererTrie */
+    COMBINAISON_SUPPRIMER = 1,    /**< SupprimerValeur */
+    COMBINAISON_RECHERCHER = 2    /**< RechercherValeur */
+} OperationCombinee;
+
+/**
+ * @brief Case de publication : une requête, puis sa réponse
+ *
+ * etat passe de libre à réservée (par son déposant), en attente (requête
+ * publiée), traitée (réponse publiée par le combineur), puis de nouveau
+ * libre quand le déposant a lu la réponse.
+ */
+typedef struct {
+    alignas(64) std::atomic<int> etat;  /**< Étape de la case (voir ListCombinee.cpp) */
+    OperationCombinee operation;        /**< Opération demandée */
+    int valeur;                         /**< Argument de l'opération */
+    NoeudS* noeud;                      /**< Nœud préparé (insertion) ou rendu (suppression) */
+    bool resultat;                      /**< Réponse du combineur */
+} PublicationCombinee;
+
+/**
+ * @brief ListeSimple triée partagée par combinaison (flat combining)
+ *
+ * Au lieu de se disputer un verrou, chaque thread dépose sa requête dans
+ * sa case de publication. Celui qui obtient le verrou de combinaison
+ * devient combineur : il ramasse toutes les requêtes en attente, les
+ * classe par valeur et les applique en une seule marche sur la liste
+ * triée. k insertions coûtent ainsi une fusion au lieu de k parcours. Les
+ * autres threads attendent leur réponse en lisant leur propre case, sans
+ * faire circuler la ligne du verrou.
+ *
+ * Les nœuds sont alloués par le déposant avant publication et les nœuds
+ * supprimés lui sont rendus pour libération : le combineur ne fait ni
+ * malloc ni free.
+ */
+typedef struct {
+    ListeSimple liste;                                              /**< Liste triée (combineur seulement) */
+    alignas(64) std::atomic<bool> verrou;                           /**< Verrou de combinaison */
+    std::atomic<int> limite;                                        /**< Cases [0, limite) déjà utilisées */
+    PublicationCombinee publications[COMBINAISON_PUBLICATIONS_MAX]; /**< Cases de publication */
+} ListeCombinee;
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+/**
+ * @brief Crée une liste triée vide à combinaison
+ * @return Pointeur vers la liste, ou NULL en cas d'échec
+ */
+ListeCombinee* AllocateCombinee();
+
+/**
+ * @brief Libère la liste et ses nœuds (plus aucun thread ne doit l'utiliser)
+ */
+void Detruire(ListeCombinee* liste);
+
+// ============================================================================
+// OPÉRATIONS CONCURRENTES
+// ============================================================================
+
+/**
+ * @brief Insère une valeur à sa place dans l'ordre croissant
+ * @return false si l'allocation échoue
+ */
+bool InsererTrie(ListeCombinee* liste, int valeur);
+
+/**
+ * @brief Supprime une occurrence d'une valeur
+ * @return true si une occurrence a été supprimée
+ */
+bool SupprimerValeur(ListeCombinee* liste, int valeur);
+
+bool RechercherValeur(ListeCombinee* liste, int valeur);
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+/**
+ * @brief Nombre d'éléments (exact seulement en l'absence d'opérations en cours)
+ */
+int CompterElements(const ListeCombinee* liste);
+
+/**
+ * @brief Représentation au format de ToString(const ListeSimple*)
+ * @note À n'appeler qu'en l'absence d'opérations concurrentes
+ */
+std::string ToString(const ListeCombinee* liste);
+
+#endif
@@ -1,3 +1,1057 @@
 #include "ListD.h"
+#include "ListSIMD.h"
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
-#include <string>
\ No newline at end of file
+#include <string>
+
+// ============================================================================
+// ACCÈS AUX LIENS SELON LE SENS LOGIQUE
+// ============================================================================
+
+// Quand estInversee est vrai, le suivant logique d'un nœud est son champ
+// precedent. Toutes les fonctions passent par ces accesseurs plutôt que par
+// les champs, ce qui rend InverserLogique en O(1).
+
+static inline NoeudD* Suivant(const ListeDouble* liste, const NoeudD* noeud) {
+    return liste->estInversee ? noeud->precedent : noeud->suivant;
+}
+
+static inline NoeudD* Precedent(const ListeDouble* liste, const NoeudD* noeud) {
+    return liste->estInversee ? noeud->suivant : noeud->precedent;
+}
+
+static inline void LierSuivant(const ListeDouble* liste, NoeudD* noeud, NoeudD* suivant) {
+    if (liste->estInversee) {
+        noeud->precedent = suivant;
+    } else {
+        noeud->suivant = suivant;
+    }
+}
+
+static inline void LierPrecedent(const ListeDouble* liste, NoeudD* noeud, NoeudD* precedent) {
+    if (liste->estInversee) {
+        noeud->suivant = precedent;
+    } else {
+        noeud->precedent = precedent;
+    }
+}
+
+/**
+ * @brief Nœud avant noeud dans la liste, NULL pour la tête (même si circulaire)
+ */
+static inline NoeudD* Avant(const ListeDouble* liste, const NoeudD* noeud) {
+    return noeud == liste->tete ? nullptr : Precedent(liste, noeud);
+}
+
+/**
+ * @brief Nœud après noeud dans la liste, NULL pour la queue (même si circulaire)
+ */
+static inline NoeudD* Apres(const ListeDouble* liste, const NoeudD* noeud) {
+    return noeud == liste->queue ? nullptr : Suivant(liste, noeud);
+}
+
+/**
+ * @brief Referme la boucle tete/queue si la liste est circulaire, la coupe sinon
+ */
+static void RaccorderExtremites(ListeDouble* liste) {
+    if (liste->tete == nullptr) {
+        return;
+    }
+    NoeudD* bouclage = liste->estCirculaire ? liste->tete : nullptr;
+    LierSuivant(liste, liste->queue, bouclage);
+    LierPrecedent(liste, liste->tete, liste->estCirculaire ? liste->queue : nullptr);
+}
+
+/**
+ * @brief Insère un nœud existant après precedent (NULL = en tête)
+ */
+static void LierApres(ListeDouble* liste, NoeudD* precedent, NoeudD* nouveau) {
+    NoeudD* suivant = (precedent == nullptr) ? liste->tete : Apres(liste, precedent);
+
+    LierPrecedent(liste, nouveau, precedent);
+    LierSuivant(liste, nouveau, suivant);
+
+    if (precedent == nullptr) {
+        liste->tete = nouveau;
+    } else {
+        LierSuivant(liste, precedent, nouveau);
+    }
+
+    if (suivant == nullptr) {
+        liste->queue = nouveau;
+    } else {
+        LierPrecedent(liste, suivant, nouveau);
+    }
+
+    liste->taille++;
+    RaccorderExtremites(liste);
+}
+
+/**
+ * @brief Retire un nœud de la chaîne sans le libérer
+ */
+static void Detacher(ListeDouble* liste, NoeudD* noeud) {
+    NoeudD* precedent = Avant(liste, noeud);
+    NoeudD* suivant = Apres(liste, noeud);
+
+    if (precedent == nullptr) {
+        liste->tete = suivant;
+    } else {
+        LierSuivant(liste, precedent, suivant);
+    }
+
+    if (suivant == nullptr) {
+        liste->queue = precedent;
+    } else {
+        LierPrecedent(liste, suivant, precedent);
+    }
+
+    noeud->precedent = nullptr;
+    noeud->suivant = nullptr;
+    liste->taille--;
+    RaccorderExtremites(liste);
+}
+
+/**
+ * @brief Vérifie en O(1) que les voisins d'un nœud pointent bien vers lui
+ */
+static bool EstLie(const ListeDouble* liste, const NoeudD* noeud) {
+    NoeudD* precedent = Avant(liste, noeud);
+    NoeudD* suivant = Apres(liste, noeud);
+    bool lienAvant = (precedent == nullptr) ? noeud == liste->tete : Suivant(liste, precedent) == noeud;
+    bool lienApres = (suivant == nullptr) ? noeud == liste->queue : Precedent(liste, suivant) == noeud;
+    return lienAvant && lienApres;
+}
+
+// ============================================================================
+// PARCOURS PAR SÉRIES CONTIGUËS
+// ============================================================================
+
+/**
+ * @brief Cherche valeur parmi au plus *restants nœuds à partir de courant
+ *
+ * Les séries de nœuds placés à pas constant dans le sens logique sont
+ * comparées par le moteur vectoriel, tronçon par tronçon, le reste nœud
+ * par nœud.
+ * @param restants Nœuds restant à examiner ; décrémenté des nœuds passés
+ * @return Nœud trouvé (non décompté de restants), ou NULL
+ */
+static NoeudD* ChercherDepuis(const ListeDouble* liste, NoeudD* courant, int* restants, int valeur) {
+    size_t decalageLien = liste->estInversee ? offsetof(NoeudD, precedent) : offsetof(NoeudD, suivant);
+
+    while (*restants > 0 && courant != nullptr) {
+        NoeudD* suivant = Suivant(liste, courant);
+        ptrdiff_t pas = (ptrdiff_t)((uintptr_t)suivant - (uintptr_t)courant);
+
+        int maximum = (*restants < LISTE_SIMD_TRONCON) ? *restants : LISTE_SIMD_TRONCON;
+
+        int serie = 1;
+        if (maximum >= LISTE_SIMD_SERIE_MIN && suivant != nullptr && PasSerieValide(pas, sizeof(NoeudD))) {
+            serie = MesurerSerie(courant, pas, decalageLien, maximum);
+        }
+
+        if (serie >= LISTE_SIMD_SERIE_MIN) {
+            int index = ChercherEntierPas(&courant->donnee, pas, serie, valeur);
+            if (index >= 0) {
+                *restants -= index;
+                return (NoeudD*)((uintptr_t)courant + (uintptr_t)(index * pas));
+            }
+            NoeudD* dernier = (NoeudD*)((uintptr_t)courant + (uintptr_t)((serie - 1) * pas));
+            *restants -= serie;
+            courant = Suivant(liste, dernier);
+            continue;
+        }
+
+        for (int i = 0; i < serie; i++) {
+            if (courant->donnee == valeur) {
+                return courant;
+            }
+            courant = Suivant(liste, courant);
+            (*restants)--;
+        }
+    }
+
+    return nullptr;
+}
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+ListeDouble* AllocateDouble() {
+    ListeDouble* nouvelleListe = (ListeDouble*)malloc(sizeof(ListeDouble));
+    if (nouvelleListe != nullptr) {
+        nouvelleListe->tete = nullptr;
+        nouvelleListe->queue = nullptr;
+        nouvelleListe->taille = 0;
+        nouvelleListe->estCirculaire = false;
+        nouvelleListe->estInversee = false;
+    }
+    return nouvelleListe;
+}
+
+ListeDouble CreerDouble() {
+    ListeDouble nouvelleListe;
+    nouvelleListe.tete = nullptr;
+    nouvelleListe.queue = nullptr;
+    nouvelleListe.taille = 0;
+    nouvelleListe.estCirculaire = false;
+    nouvelleListe.estInversee = false;
+    return nouvelleListe;
+}
+
+NoeudD* CreerNoeudD(int valeur) {
+    NoeudD* nouveau = (NoeudD*)malloc(sizeof(NoeudD));
+    if (nouveau == nullptr) {
+        return nullptr;
+    }
+    nouveau->donnee = valeur;
+    nouveau->precedent = nullptr;
+    nouveau->suivant = nullptr;
+    return nouveau;
+}
+
+void Initialiser(ListeDouble* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+
+    // Les champs peuvent être non initialisés (liste sur la pile) : on ne
+    // tente pas de libérer un contenu précédent.
+    liste->tete = nullptr;
+    liste->queue = nullptr;
+    liste->taille = 0;
+    liste->estCirculaire = false;
+    liste->estInversee = false;
+}
+
+void Nettoyer(ListeDouble* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+
+    // Le parcours est borné par taille : valable pour les listes circulaires
+    NoeudD* courant = liste->tete;
+    for (int i = 0; i < liste->taille && courant != nullptr; i++) {
+        NoeudD* suivant = Suivant(liste, courant);
+        free(courant);
+        courant = suivant;
+    }
+
+    liste->tete = nullptr;
+    liste->queue = nullptr;
+    liste->taille = 0;
+    liste->estCirculaire = false;
+    liste->estInversee = false;
+}
+
+void Detruire(ListeDouble* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+
+    Nettoyer(liste);
+    free(liste);
+}
+
+// ============================================================================
+// FONCTIONS D'INSERTION
+// ============================================================================
+
+void InsererDebut(ListeDouble* liste, int valeur) {
+    if (liste == nullptr) {
+        return;
+    }
+
+    NoeudD* nouveau = CreerNoeudD(valeur);
+    if (nouveau == nullptr) {
+        return;
+    }
+
+    LierApres(liste, nullptr, nouveau);
+}
+
+void InsererFin(ListeDouble* liste, int valeur) {
+    if (liste == nullptr) {
+        return;
+    }
+
+    NoeudD* nouveau = CreerNoeudD(valeur);
+    if (nouveau == nullptr) {
+        return;
+    }
+
+    LierApres(liste, liste->queue, nouveau);
+}
+
+bool InsererAvant(ListeDouble* liste, NoeudD* suivant, int valeur) {
+    if (liste == nullptr || suivant == nullptr || EstVide(liste)) {
+        return false;
+    }
+
+    NoeudD* nouveau = CreerNoeudD(valeur);
+    if (nouveau == nullptr) {
+        return false;
+    }
+
+    LierApres(liste, Avant(liste, suivant), nouveau);
+    return true;
+}
+
+bool InsererApres(ListeDouble* liste, NoeudD* precedent, int valeur) {
+    if (liste == nullptr || precedent == nullptr || EstVide(liste)) {
+        return false;
+    }
+
+    NoeudD* nouveau = CreerNoeudD(valeur);
+    if (nouveau == nullptr) {
+        return false;
+    }
+
+    LierApres(liste, precedent, nouveau);
+    return true;
+}
+
+bool InsererPosition(ListeDouble* liste, int position, int valeur) {
+    if (liste == nullptr || position < 0 || position > liste->taille) {
+        return false;
+    }
+
+    if (position == 0) {
+        InsererDebut(liste, valeur);
+        return true;
+    }
+
+    if (position == liste->taille) {
+        InsererFin(liste, valeur);
+        return true;
+    }
+
+    return InsererAvant(liste, ObtenirNoeudPosition(liste, position), valeur);
+}
+
+void InsererTrie(ListeDouble* liste, int valeur) {
+    if (liste == nullptr) {
+        return;
+    }
+
+    if (EstVide(liste) || valeur <= liste->tete->donnee) {
+        InsererDebut(liste, valeur);
+        return;
+    }
+
+    if (valeur >= liste->queue->donnee) {
+        InsererFin(liste, valeur);
+        return;
+    }
+
+    NoeudD* courant = liste->tete;
+    while (Apres(liste, courant)->donnee < valeur) {
+        courant = Apres(liste, courant);
+    }
+
+    InsererApres(liste, courant, valeur);
+}
+
+// ============================================================================
+// FONCTIONS DE SUPPRESSION
+// ============================================================================
+
+bool SupprimerDebut(ListeDouble* liste) {
+    if (liste == nullptr || EstVide(liste)) {
+        return false;
+    }
+
+    NoeudD* ancienneTete = liste->tete;
+    Detacher(liste, ancienneTete);
+    free(ancienneTete);
+    return true;
+}
+
+bool SupprimerFin(ListeDouble* liste) {
+    if (liste == nullptr || EstVide(liste)) {
+        return false;
+    }
+
+    NoeudD* ancienneQueue = liste->queue;
+    Detacher(liste, ancienneQueue);
+    free(ancienneQueue);
+    return true;
+}
+
+bool SupprimerNoeud(ListeDouble* liste, NoeudD* cible) {
+    if (liste == nullptr || cible == nullptr || EstVide(liste) || !EstLie(liste, cible)) {
+        return false;
+    }
+
+    Detacher(liste, cible);
+    free(cible);
+    return true;
+}
+
+bool SupprimerValeur(ListeDouble* liste, int valeur) {
+    if (liste == nullptr) {
+        return false;
+    }
+
+    NoeudD* cible = RechercherValeur(liste, valeur);
+    if (cible != nullptr) {
+        return SupprimerNoeud(liste, cible);
+    }
+    return false;
+}
+
+int SupprimerToutesOccurrences(ListeDouble* liste, int valeur) {
+    if (liste == nullptr || EstVide(liste)) {
+        return 0;
+    }
+
+    int compteur = 0;
+    int restants = liste->taille;
+    NoeudD* cible = ChercherDepuis(liste, liste->tete, &restants, valeur);
+
+    while (cible != nullptr) {
+        NoeudD* suivant = Suivant(liste, cible);
+        Detacher(liste, cible);
+        free(cible);
+        compteur++;
+
+        restants--;
+        cible = ChercherDepuis(liste, suivant, &restants, valeur);
+    }
+
+    return compteur;
+}
+
+bool SupprimerPosition(ListeDouble* liste, int position) {
+    if (liste == nullptr || position < 0 || position >= liste->taille) {
+        return false;
+    }
+
+    NoeudD* cible = ObtenirNoeudPosition(liste, position);
+    Detacher(liste, cible);
+    free(cible);
+    return true;
+}
+
+// ============================================================================
+// FONCTIONS DE RECHERCHE
+// ============================================================================
+
+NoeudD* RechercherValeur(const ListeDouble* liste, int valeur) {
+    if (liste == nullptr || EstVide(liste)) {
+        return nullptr;
+    }
+
+    int restants = liste->taille;
+    return ChercherDepuis(liste, liste->tete, &restants, valeur);
+}
+
+NoeudD** RechercherToutesOccurrences(const ListeDouble* liste, int valeur, int* count) {
+    if (liste == nullptr || count == nullptr) {
+        return nullptr;
+    }
+
+    *count = 0;
+
+    // Premier passage : compter les occurrences
+    int restants = liste->taille;
+    NoeudD* trouve = ChercherDepuis(liste, liste->tete, &restants, valeur);
+    while (trouve != nullptr) {
+        (*count)++;
+        restants--;
+        trouve = ChercherDepuis(liste, Suivant(liste, trouve), &restants, valeur);
+    }
+
+    if (*count == 0) {
+        return nullptr;
+    }
+
+    // Deuxième passage : remplir le tableau
+    NoeudD** resultats = (NoeudD**)malloc((*count + 1) * sizeof(NoeudD*));
+    if (resultats == nullptr) {
+        *count = 0;
+        return nullptr;
+    }
+
+    int index = 0;
+    restants = liste->taille;
+    trouve = ChercherDepuis(liste, liste->tete, &restants, valeur);
+    while (trouve != nullptr) {
+        resultats[index++] = trouve;
+        restants--;
+        trouve = ChercherDepuis(liste, Suivant(liste, trouve), &restants, valeur);
+    }
+
+    resultats[index] = nullptr;
+    return resultats;
+}
+
+NoeudD* ObtenirNoeudPosition(const ListeDouble* liste, int position) {
+    if (liste == nullptr || position < 0 || position >= liste->taille) {
+        return nullptr;
+    }
+
+    // Parcours depuis l'extrémité la plus proche
+    NoeudD* courant;
+    if (position <= liste->taille / 2) {
+        courant = liste->tete;
+        for (int i = 0; i < position; i++) {
+            courant = Suivant(liste, courant);
+        }
+    } else {
+        courant = liste->queue;
+        for (int i = liste->taille - 1; i > position; i--) {
+            courant = Precedent(liste, courant);
+        }
+    }
+
+    return courant;
+}
+
+NoeudD* ObtenirNoeudPositionInverse(const ListeDouble* liste, int position) {
+    if (liste == nullptr || position < 0 || position >= liste->taille) {
+        return nullptr;
+    }
+
+    return ObtenirNoeudPosition(liste, liste->taille - 1 - position);
+}
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+std::string ToString(const NoeudD* noeud) {
+    if (noeud == nullptr) {
+        return "NULL";
+    }
+    return "Noeud(" + std::to_string(noeud->donnee) + ")";
+}
+
+std::string ToString(const ListeDouble* liste) {
+    if (liste == nullptr) {
+        return "ListeDouble[NULL]";
+    }
+
+    if (EstVide(liste)) {
+        return "ListeDouble[]";
+    }
+
+    std::string resultat = "ListeDouble[";
+    NoeudD* courant = liste->tete;
+    for (int i = 0; i < liste->taille; i++) {
+        if (i > 0) {
+            resultat += " <-> ";
+        }
+        resultat += ToString(courant);
+        courant = Suivant(liste, courant);
+    }
+
+    resultat += "]";
+    if (liste->estCirculaire) {
+        resultat += " (circulaire)";
+    }
+
+    return resultat;
+}
+
+int CompterElements(const ListeDouble* liste) {
+    if (liste == nullptr) {
+        return 0;
+    }
+    return liste->taille;
+}
+
+bool EstVide(const ListeDouble* liste) {
+    return liste == nullptr || liste->tete == nullptr || liste->taille == 0;
+}
+
+bool ContientCycle(const ListeDouble* liste) {
+    if (liste == nullptr || EstVide(liste)) {
+        return false;
+    }
+
+    if (liste->estCirculaire) {
+        return true;
+    }
+
+    return AnalyserCycle(liste).present;
+}
+
+/**
+ * @brief Algorithme de Brent sur la chaîne qui part de depart en suivant avancer
+ */
+template <typename Avancer>
+static CycleChaineD AnalyserChaine(NoeudD* depart, Avancer avancer) {
+    CycleChaineD analyse;
+    analyse.present = false;
+    analyse.entree = nullptr;
+    analyse.longueurCycle = 0;
+    analyse.longueurQueue = 0;
+
+    if (depart == nullptr) {
+        return analyse;
+    }
+
+    // La tortue se téléporte sur le lièvre à chaque puissance de deux,
+    // le lièvre seul avance : une lecture de lien par pas.
+    NoeudD* tortue = depart;
+    NoeudD* lievre = avancer(depart);
+    int puissance = 1;
+    int longueur = 1;
+    int parcourus = 1;
+
+    while (lievre != tortue) {
+        if (lievre == nullptr) {
+            analyse.longueurQueue = parcourus;
+            return analyse;
+        }
+        if (puissance == longueur) {
+            tortue = lievre;
+            puissance *= 2;
+            longueur = 0;
+        }
+        lievre = avancer(lievre);
+        longueur++;
+        parcourus++;
+    }
+
+    // Entrée du cycle : deux curseurs séparés de longueur pas avancent ensemble
+    tortue = depart;
+    lievre = depart;
+    for (int i = 0; i < longueur; i++) {
+        lievre = avancer(lievre);
+    }
+
+    int queue = 0;
+    while (tortue != lievre) {
+        tortue = avancer(tortue);
+        lievre = avancer(lievre);
+        queue++;
+    }
+
+    analyse.present = true;
+    analyse.entree = tortue;
+    analyse.longueurCycle = longueur;
+    analyse.longueurQueue = queue;
+    return analyse;
+}
+
+AnalyseCycleD AnalyserCycle(const ListeDouble* liste) {
+    AnalyseCycleD analyse;
+    if (liste == nullptr) {
+        analyse.suivant = AnalyserChaine(nullptr, [](NoeudD* noeud) { return noeud; });
+        analyse.precedent = analyse.suivant;
+        analyse.present = false;
+        return analyse;
+    }
+
+    analyse.suivant = AnalyserChaine(liste->tete, [liste](NoeudD* noeud) { return Suivant(liste, noeud); });
+    analyse.precedent = AnalyserChaine(liste->queue, [liste](NoeudD* noeud) { return Precedent(liste, noeud); });
+    analyse.present = analyse.suivant.present || analyse.precedent.present;
+    return analyse;
+}
+
+// ============================================================================
+// FONCTIONS DE CONVERSION ET TRANSFORMATION
+// ============================================================================
+
+void RendreCirculaire(ListeDouble* liste) {
+    if (liste == nullptr || liste->estCirculaire || EstVide(liste)) {
+        return;
+    }
+
+    liste->estCirculaire = true;
+    RaccorderExtremites(liste);
+}
+
+void RendreLineaire(ListeDouble* liste) {
+    if (liste == nullptr || !liste->estCirculaire) {
+        return;
+    }
+
+    liste->estCirculaire = false;
+    RaccorderExtremites(liste);
+}
+
+void Inverser(ListeDouble* liste) {
+    if (liste == nullptr || EstVide(liste) || liste->tete == liste->queue) {
+        return;
+    }
+
+    // Échange physique des liens de chaque nœud : l'ordre logique s'inverse
+    // quel que soit estInversee.
+    NoeudD* courant = liste->tete;
+    for (int i = 0; i < liste->taille; i++) {
+        NoeudD* suivant = Suivant(liste, courant);
+        NoeudD* temp = courant->suivant;
+        courant->suivant = courant->precedent;
+        courant->precedent = temp;
+        courant = suivant;
+    }
+
+    NoeudD* ancienneTete = liste->tete;
+    liste->tete = liste->queue;
+    liste->queue = ancienneTete;
+}
+
+void InverserLogique(ListeDouble* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+
+    NoeudD* ancienneTete = liste->tete;
+    liste->tete = liste->queue;
+    liste->queue = ancienneTete;
+    liste->estInversee = !liste->estInversee;
+}
+
+void Materialiser(ListeDouble* liste) {
+    if (liste == nullptr || !liste->estInversee) {
+        return;
+    }
+
+    NoeudD* courant = liste->tete;
+    for (int i = 0; i < liste->taille; i++) {
+        NoeudD* suivant = courant->precedent; // suivant logique avant l'échange
+        courant->precedent = courant->suivant;
+        courant->suivant = suivant;
+        courant = suivant;
+    }
+
+    liste->estInversee = false;
+}
+
+static NoeudD* FusionnerChainesD(NoeudD* a, NoeudD* b) {
+    NoeudD tete;
+    NoeudD* dernier = &tete;
+
+    while (a != nullptr && b != nullptr) {
+        if (a->donnee <= b->donnee) {
+            dernier->suivant = a;
+            a = a->suivant;
+        } else {
+            dernier->suivant = b;
+            b = b->suivant;
+        }
+        dernier = dernier->suivant;
+    }
+    dernier->suivant = (a != nullptr) ? a : b;
+
+    return tete.suivant;
+}
+
+void Trier(ListeDouble* liste) {
+    if (liste == nullptr || EstVide(liste) || liste->tete == liste->queue) {
+        return;
+    }
+
+    Materialiser(liste);
+    bool etaitCirculaire = liste->estCirculaire;
+    RendreLineaire(liste);
+
+    // Tri fusion ascendant sur les liens suivant (stable, sans récursion)
+    NoeudD* tete = liste->tete;
+    for (int largeur = 1; largeur < liste->taille; largeur *= 2) {
+        NoeudD* reste = tete;
+        NoeudD* nouvelleTete = nullptr;
+        NoeudD* finFusion = nullptr;
+
+        while (reste != nullptr) {
+            NoeudD* gauche = reste;
+            NoeudD* finGauche = gauche;
+            for (int i = 1; i < largeur && finGauche->suivant != nullptr; i++) {
+                finGauche = finGauche->suivant;
+            }
+            NoeudD* droite = finGauche->suivant;
+            finGauche->suivant = nullptr;
+
+            NoeudD* finDroite = droite;
+            for (int i = 1; i < largeur && finDroite != nullptr && finDroite->suivant != nullptr; i++) {
+                finDroite = finDroite->suivant;
+            }
+            reste = (finDroite != nullptr) ? finDroite->suivant : nullptr;
+            if (finDroite != nullptr) {
+                finDroite->suivant = nullptr;
+            }
+
+            NoeudD* fusion = FusionnerChainesD(gauche, droite);
+            if (finFusion == nullptr) {
+                nouvelleTete = fusion;
+            } else {
+                finFusion->suivant = fusion;
+            }
+            finFusion = fusion;
+            while (finFusion->suivant != nullptr) {
+                finFusion = finFusion->suivant;
+            }
+        }
+
+        tete = nouvelleTete;
+    }
+
+    // Reconstruction des liens precedent en un passage
+    NoeudD* precedent = nullptr;
+    for (NoeudD* courant = tete; courant != nullptr; courant = courant->suivant) {
+        courant->precedent = precedent;
+        precedent = courant;
+    }
+    liste->tete = tete;
+    liste->queue = precedent;
+
+    if (etaitCirculaire) {
+        RendreCirculaire(liste);
+    }
+}
+
+ListeDouble* Copier(const ListeDouble* liste) {
+    if (liste == nullptr) {
+        return nullptr;
+    }
+
+    ListeDouble* nouvelleListe = AllocateDouble();
+    if (nouvelleListe == nullptr) {
+        return nullptr;
+    }
+
+    NoeudD* courant = liste->tete;
+    for (int i = 0; i < liste->taille; i++) {
+        InsererFin(nouvelleListe, courant->donnee);
+        courant = Suivant(liste, courant);
+    }
+
+    if (liste->estCirculaire) {
+        RendreCirculaire(nouvelleListe);
+    }
+
+    return nouvelleListe;
+}
+
+void Concatener(ListeDouble* liste1, const ListeDouble* liste2) {
+    if (liste1 == nullptr || liste2 == nullptr || EstVide(liste2)) {
+        return;
+    }
+
+    // taille est figé avant la boucle : Concatener(l, l) double la liste
+    int aCopier = liste2->taille;
+    NoeudD* courant = liste2->tete;
+    for (int i = 0; i < aCopier; i++) {
+        NoeudD* suivant = Suivant(liste2, courant);
+        InsererFin(liste1, courant->donnee);
+        courant = suivant;
+    }
+}
+
+void Diviser(ListeDouble* liste, int position, ListeDouble* liste2) {
+    if (liste == nullptr || liste2 == nullptr || position < 1 || position >= liste->taille) {
+        return;
+    }
+
+    Nettoyer(liste2);
+
+    bool etaitCirculaire = liste->estCirculaire;
+    RendreLineaire(liste);
+
+    NoeudD* noeudDivision = ObtenirNoeudPosition(liste, position);
+    NoeudD* nouvelleQueue = Precedent(liste, noeudDivision);
+
+    // liste2 reprend les nœuds tels quels, avec le même sens de lecture
+    liste2->tete = noeudDivision;
+    liste2->queue = liste->queue;
+    liste2->taille = liste->taille - position;
+    liste2->estCirculaire = false;
+    liste2->estInversee = liste->estInversee;
+    LierPrecedent(liste2, noeudDivision, nullptr);
+
+    liste->queue = nouvelleQueue;
+    liste->taille = position;
+    LierSuivant(liste, nouvelleQueue, nullptr);
+
+    if (etaitCirculaire) {
+        RendreCirculaire(liste);
+    }
+}
+
+// ============================================================================
+// FONCTIONS UTILITAIRES AVANCÉES
+// ============================================================================
+
+void SupprimerDoublonsTries(ListeDouble* liste) {
+    if (liste == nullptr || EstVide(liste) || liste->tete == liste->queue) {
+        return;
+    }
+
+    NoeudD* courant = liste->tete;
+    while (Apres(liste, courant) != nullptr) {
+        NoeudD* suivant = Apres(liste, courant);
+        if (suivant->donnee == courant->donnee) {
+            Detacher(liste, suivant);
+            free(suivant);
+        } else {
+            courant = suivant;
+        }
+    }
+}
+
+void SupprimerDoublonsNonTries(ListeDouble* liste) {
+    if (liste == nullptr || EstVide(liste) || liste->tete == liste->queue) {
+        return;
+    }
+
+    for (NoeudD* courant = liste->tete; courant != nullptr; courant = Apres(liste, courant)) {
+        NoeudD* runner = Apres(liste, courant);
+        while (runner != nullptr) {
+            NoeudD* suivant = Apres(liste, runner);
+            if (runner->donnee == courant->donnee) {
+                Detacher(liste, runner);
+                free(runner);
+            }
+            runner = suivant;
+        }
+    }
+}
+
+ListeDouble* FusionnerListesTriees(const ListeDouble* liste1, const ListeDouble* liste2) {
+    if (liste1 == nullptr && liste2 == nullptr) {
+        return nullptr;
+    }
+
+    if (liste1 == nullptr || EstVide(liste1)) {
+        return Copier(liste2 != nullptr ? liste2 : liste1);
+    }
+
+    if (liste2 == nullptr || EstVide(liste2)) {
+        return Copier(liste1);
+    }
+
+    ListeDouble* resultat = AllocateDouble();
+    if (resultat == nullptr) {
+        return nullptr;
+    }
+
+    NoeudD* ptr1 = liste1->tete;
+    NoeudD* ptr2 = liste2->tete;
+    int restants1 = liste1->taille;
+    int restants2 = liste2->taille;
+
+    while (restants1 > 0 || restants2 > 0) {
+        if (restants2 == 0 || (restants1 > 0 && ptr1->donnee <= ptr2->donnee)) {
+            InsererFin(resultat, ptr1->donnee);
+            ptr1 = Suivant(liste1, ptr1);
+            restants1--;
+        } else {
+            InsererFin(resultat, ptr2->donnee);
+            ptr2 = Suivant(liste2, ptr2);
+            restants2--;
+        }
+    }
+
+    return resultat;
+}
+
+NoeudD* TrouverMilieu(const ListeDouble* liste) {
+    if (liste == nullptr || EstVide(liste)) {
+        return nullptr;
+    }
+
+    // Deuxième milieu pour une taille paire, comme pour ListeSimple
+    return ObtenirNoeudPosition(liste, liste->taille / 2);
+}
+
+bool EstPalindrome(const ListeDouble* liste) {
+    if (liste == nullptr || EstVide(liste)) {
+        return true;
+    }
+
+    // Deux curseurs qui se rejoignent : aucune modification de la liste
+    NoeudD* gauche = liste->tete;
+    NoeudD* droite = liste->queue;
+    for (int i = 0; i < liste->taille / 2; i++) {
+        if (gauche->donnee != droite->donnee) {
+            return false;
+        }
+        gauche = Suivant(liste, gauche);
+        droite = Precedent(liste, droite);
+    }
+
+    return true;
+}
+
+bool EchangerNoeuds(ListeDouble* liste, NoeudD* noeud1, NoeudD* noeud2) {
+    if (liste == nullptr || noeud1 == nullptr || noeud2 == nullptr || EstVide(liste)) {
+        return false;
+    }
+
+    if (!EstLie(liste, noeud1) || !EstLie(liste, noeud2)) {
+        return false;
+    }
+
+    if (noeud1 == noeud2) {
+        return true;
+    }
+
+    // Nœuds adjacents : il suffit de déplacer le second devant le premier
+    if (Apres(liste, noeud1) == noeud2) {
+        Detacher(liste, noeud2);
+        LierApres(liste, Avant(liste, noeud1), noeud2);
+        return true;
+    }
+    if (Apres(liste, noeud2) == noeud1) {
+        Detacher(liste, noeud1);
+        LierApres(liste, Avant(liste, noeud2), noeud1);
+        return true;
+    }
+
+    NoeudD* avant1 = Avant(liste, noeud1);
+    NoeudD* avant2 = Avant(liste, noeud2);
+    Detacher(liste, noeud1);
+    Detacher(liste, noeud2);
+    LierApres(liste, avant1, noeud2);
+    LierApres(liste, avant2, noeud1);
+    return true;
+}
+
+/**
+ * @brief Ramène un décalage vers la gauche dans [0, taille)
+ */
+static int ReduireDecalage(long long k, int taille) {
+    long long reste = k % taille;
+    return (int)(reste < 0 ? reste + taille : reste);
+}
+
+/**
+ * @brief Fait de nouvelleTete la tête en refermant puis recoupant l'anneau (O(1))
+ */
+static void DeplacerTete(ListeDouble* liste, NoeudD* nouvelleTete) {
+    // Sur une liste circulaire l'anneau est déjà fermé : seuls tete/queue bougent
+    LierSuivant(liste, liste->queue, liste->tete);
+    LierPrecedent(liste, liste->tete, liste->queue);
+
+    liste->tete = nouvelleTete;
+    liste->queue = Precedent(liste, nouvelleTete);
+    RaccorderExtremites(liste);
+}
+
+void RotationGauche(ListeDouble* liste, int k) {
+    if (liste == nullptr || liste->taille < 2) {
+        return;
+    }
+
+    int decalage = ReduireDecalage(k, liste->taille);
+    if (decalage == 0) {
+        return;
+    }
+
+    // ObtenirNoeudPosition part de l'extrémité la plus proche :
+    // min(k, taille - k) pas au plus, aucun nœud n'est relié individuellement.
+    DeplacerTete(liste, ObtenirNoeudPosition(liste, decalage));
+}
+
+void RotationDroite(ListeDouble* liste, int k) {
+    if (liste == nullptr || liste->taille < 2) {
+        return;
+    }
+
+    RotationGauche(liste, ReduireDecalage(-(long long)k, liste->taille));
+}
@@ -20,8 +20,28 @@ typedef struct {
     NoeudD* queue;         /**< Pointeur vers le dernier nœud de la liste */
     int taille;            /**< Nombre d'éléments dans la liste */
     bool estCirculaire;    /**< Indique si la liste est circulaire */
+    bool estInversee;      /**< Sens de lecture des liens inversé (voir InverserLogique) */
 } ListeDouble;
 
+/**
+ * @brief Résultat de l'analyse de cycle d'une chaîne de liens
+ */
+typedef struct {
+    bool present;          /**< Indique si la chaîne boucle */
+    NoeudD* entree;        /**< Premier nœud du cycle (NULL sans cycle) */
+    int longueurCycle;     /**< Nombre de nœuds du cycle (0 sans cycle) */
+    int longueurQueue;     /**< Nœuds avant l'entrée, ou de toute la chaîne sans cycle */
+} CycleChaineD;
+
+/**
+ * @brief Résultat de l'analyse des deux chaînes d'une liste double
+ */
+typedef struct {
+    bool present;              /**< Indique si l'une des deux chaînes boucle */
+    CycleChaineD suivant;      /**< Chaîne parcourue depuis la tête vers l'avant */
+    CycleChaineD precedent;    /**< Chaîne parcourue depuis la queue vers l'arrière */
+} AnalyseCycleD;
+
 // ============================================================================
 // FONCTIONS DE CRÉATION ET DESTRUCTION
 // ============================================================================
@@ -241,6 +261,15 @@ bool EstVide(const ListeDouble* liste);
  */
 bool ContientCycle(const ListeDouble* liste);
 
+/**
+ * @brief Analyse les liens réels des deux chaînes (algorithme de Brent)
+ * @param liste Pointeur vers la liste
+ * @return Présence, nœud d'entrée, longueur du cycle et de la queue pour chaque sens
+ * @note Les sens sont logiques (estInversee respecté). Ignore estCirculaire :
+ *       une liste circulaire saine boucle dans les deux sens sur taille nœuds
+ */
+AnalyseCycleD AnalyserCycle(const ListeDouble* liste);
+
 // ============================================================================
 // FONCTIONS DE CONVERSION ET TRANSFORMATION
 // ============================================================================
@@ -263,6 +292,25 @@ void RendreLineaire(ListeDouble* liste);
  */
 void Inverser(ListeDouble* liste);
 
+/**
+ * @brief Inverse l'ordre des éléments en O(1) en basculant le sens de lecture des liens
+ *
+ * Seuls tete, queue et estInversee changent : tant que estInversee est vrai,
+ * le suivant logique d'un nœud est son champ precedent et réciproquement.
+ * Toutes les fonctions de ce fichier tiennent compte de ce drapeau.
+ * @param liste Pointeur vers la liste
+ */
+void InverserLogique(ListeDouble* liste);
+
+/**
+ * @brief Réécrit les liens pour que suivant/precedent correspondent de nouveau à l'ordre logique
+ *
+ * À appeler avant de parcourir directement les champs des nœuds d'une liste
+ * inversée logiquement. Sans effet si estInversee est faux.
+ * @param liste Pointeur vers la liste
+ */
+void Materialiser(ListeDouble* liste);
+
 /**
  * @brief Trie la liste double en ordre croissant
  * @param liste Pointeur vers la liste
@@ -341,14 +389,15 @@ bool EchangerNoeuds(ListeDouble* liste, NoeudD* noeud1, NoeudD* noeud2);
 /**
  * @brief Fait une rotation de la liste double vers la gauche
  * @param liste Pointeur vers la liste
- * @param k Nombre de positions à rotationner
+ * @param k Nombre de positions à rotationner (réduit modulo taille, négatif = vers la droite)
+ * @note O(min(k, taille - k)) : la marche part de l'extrémité la plus proche
  */
 void RotationGauche(ListeDouble* liste, int k);
 
 /**
  * @brief Fait une rotation de la liste double vers la droite
  * @param liste Pointeur vers la liste
- * @param k Nombre de positions à rotationner
+ * @param k Nombre de positions à rotationner (réduit modulo taille, négatif = vers la gauche)
  */
 void RotationDroite(ListeDouble* liste, int k);
 
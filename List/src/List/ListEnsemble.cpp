@@ -0,0 +1,196 @@
+#include "ListEnsemble.h"
+#include <cstdlib>
+#include <new>
+#include <string>
+
+// ============================================================================
+// PARCOURS (usage interne)
+// ============================================================================
+
+/**
+ * @brief Trouve la fenêtre (precedent, courant) où valeur est ou serait rangée
+ *
+ * Décroche au passage les nœuds marqués rencontrés. courant est le premier
+ * nœud non marqué de valeur >= valeur (NULL en fin de liste) et precedent
+ * son prédécesseur, non marqué au moment de la lecture. L'appelant doit
+ * être en section : les nœuds décrochés ici sont retirés par participant.
+ * @return true si courant porte valeur
+ */
+static bool Chercher(EnsembleConcurrent* ensemble, ParticipantEpoque* participant, int valeur, NoeudS** precedent,
+                     NoeudS** courant) {
+reprendre:
+    NoeudS* avant = &ensemble->tete;
+    NoeudS* noeud = SansRetrait(LireSuivant(avant));
+    while (noeud != nullptr) {
+        NoeudS* suivant = LireSuivant(noeud);
+        if (EstRetire(suivant)) {
+            // Terminer la suppression de noeud ; si avant a changé, repartir de la tête
+            if (!EchangerSuivant(avant, noeud, SansRetrait(suivant))) {
+                goto reprendre;
+            }
+            Retirer(DomaineEpoqueGlobal(), participant, noeud);
+            noeud = SansRetrait(suivant);
+            continue;
+        }
+        if (noeud->donnee >= valeur) {
+            break;
+        }
+        avant = noeud;
+        noeud = suivant;
+    }
+
+    *precedent = avant;
+    *courant = noeud;
+    return noeud != nullptr && noeud->donnee == valeur;
+}
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+EnsembleConcurrent* AllocateEnsembleConcurrent() {
+    EnsembleConcurrent* ensemble = new (std::nothrow) EnsembleConcurrent;
+    if (ensemble == nullptr) {
+        return nullptr;
+    }
+    ensemble->tete.donnee = 0;
+    ensemble->tete.suivant = nullptr;
+    ensemble->taille.store(0, std::memory_order_relaxed);
+    return ensemble;
+}
+
+void Detruire(EnsembleConcurrent* ensemble) {
+    if (ensemble == nullptr) {
+        return;
+    }
+
+    NoeudS* noeud = SansRetrait(ensemble->tete.suivant);
+    while (noeud != nullptr) {
+        NoeudS* suivant = SansRetrait(noeud->suivant);
+        free(noeud);
+        noeud = suivant;
+    }
+    delete ensemble;
+}
+
+// ============================================================================
+// OPÉRATIONS CONCURRENTES
+// ============================================================================
+
+bool InsererTrie(EnsembleConcurrent* ensemble, int valeur) {
+    if (ensemble == nullptr) {
+        return false;
+    }
+    NoeudS* nouveau = (NoeudS*)malloc(sizeof(NoeudS));
+    if (nouveau == nullptr) {
+        return false;
+    }
+    nouveau->donnee = valeur;
+
+    DomaineEpoque* domaine = DomaineEpoqueGlobal();
+    ParticipantEpoque* participant = ParticipantEpoqueDuThread();
+    EntrerSection(domaine, participant);
+    bool insere = false;
+    while (true) {
+        NoeudS* precedent;
+        NoeudS* courant;
+        if (Chercher(ensemble, participant, valeur, &precedent, &courant)) {
+            free(nouveau);
+            break;
+        }
+        EcrireSuivant(nouveau, courant, std::memory_order_relaxed);
+        // Échoue si precedent a été marqué ou si un nœud s'est intercalé
+        if (EchangerSuivant(precedent, courant, nouveau)) {
+            ensemble->taille.fetch_add(1, std::memory_order_relaxed);
+            insere = true;
+            break;
+        }
+    }
+    SortirSection(domaine, participant);
+    return insere;
+}
+
+bool SupprimerValeur(EnsembleConcurrent* ensemble, int valeur) {
+    if (ensemble == nullptr) {
+        return false;
+    }
+
+    DomaineEpoque* domaine = DomaineEpoqueGlobal();
+    ParticipantEpoque* participant = ParticipantEpoqueDuThread();
+    EntrerSection(domaine, participant);
+    bool supprime = false;
+    while (true) {
+        NoeudS* precedent;
+        NoeudS* courant;
+        if (!Chercher(ensemble, participant, valeur, &precedent, &courant)) {
+            break;
+        }
+
+        // Suppression logique : marquer le lien de courant
+        NoeudS* suivant = LireSuivant(courant);
+        if (EstRetire(suivant) || !EchangerSuivant(courant, suivant, AvecRetrait(suivant))) {
+            continue;
+        }
+        ensemble->taille.fetch_sub(1, std::memory_order_relaxed);
+        supprime = true;
+
+        // Suppression physique ; en cas d'échec, un parcours s'en charge
+        if (EchangerSuivant(precedent, courant, suivant)) {
+            Retirer(domaine, participant, courant);
+        } else {
+            Chercher(ensemble, participant, valeur, &precedent, &courant);
+        }
+        break;
+    }
+    SortirSection(domaine, participant);
+    return supprime;
+}
+
+bool RechercherValeur(const EnsembleConcurrent* ensemble, int valeur) {
+    if (ensemble == nullptr) {
+        return false;
+    }
+    DomaineEpoque* domaine = DomaineEpoqueGlobal();
+    ParticipantEpoque* participant = ParticipantEpoqueDuThread();
+    EntrerSection(domaine, participant);
+    NoeudS* noeud = SansRetrait(LireSuivant(const_cast<NoeudS*>(&ensemble->tete)));
+    while (noeud != nullptr && noeud->donnee < valeur) {
+        noeud = SansRetrait(LireSuivant(noeud));
+    }
+    bool present = noeud != nullptr && noeud->donnee == valeur && !EstRetire(LireSuivant(noeud));
+    SortirSection(domaine, participant);
+    return present;
+}
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+int CompterElements(const EnsembleConcurrent* ensemble) {
+    if (ensemble == nullptr) {
+        return 0;
+    }
+    int taille = ensemble->taille.load(std::memory_order_relaxed);
+    return taille < 0 ? 0 : taille;
+}
+
+bool EstVide(const EnsembleConcurrent* ensemble) {
+    return CompterElements(ensemble) == 0;
+}
+
+std::string ToString(const EnsembleConcurrent* ensemble) {
+    if (ensemble == nullptr) {
+        return "Liste[NULL]";
+    }
+    std::string resultat = "Liste[";
+    for (NoeudS* noeud = SansRetrait(ensemble->tete.suivant); noeud != nullptr; noeud = SansRetrait(noeud->suivant)) {
+        if (EstRetire(noeud->suivant)) {
+            continue;
+        }
+        if (resultat.size() > 6) {
+            resultat += " -> ";
+        }
+        resultat += ToString((const NoeudS*)noeud);
+    }
+    return resultat + "]";
+}
@@ -0,0 +1,95 @@
+#ifndef LISTE_ENSEMBLE_H
+#define LISTE_ENSEMBLE_H
+
+#include "ListAtomique.h"
+#include "ListRecuperation.h"
+#include "ListS.h"
+#include <atomic>
+#include <string>
+
+/**
+ * @brief Ensemble trié sans verrou (liste de Harris-Michael) de NoeudS
+ *
+ * Les valeurs sont uniques et rangées par ordre croissant derrière le nœud
+ * sentinelle tete. SupprimerValeur marque d'abord le bit de poids faible du
+ * lien suivant de la cible (suppression logique), puis la décroche par un
+ * compare-and-swap sur le lien de son prédécesseur ; un parcours qui croise
+ * un nœud marqué termine le décrochage à sa place.
+ *
+ * RechercherValeur ne modifie rien et n'aide pas : elle ne recommence
+ * jamais, donc attend au plus le nombre de nœuds de valeur inférieure
+ * (sans attente pour un domaine de clés borné).
+ *
+ * Récupération : chaque opération se déroule dans une section de
+ * DomaineEpoqueGlobal (ListRecuperation.h). Le thread qui décroche un nœud
+ * le retire dans ce domaine ; il n'est libéré qu'une fois sorties toutes
+ * les sections qui ont pu l'atteindre. Les lectures restent sans attente :
+ * une section ne coûte qu'une annonce à l'entrée et une à la sortie.
+ */
+typedef struct {
+    NoeudS tete;                          /**< Sentinelle (sa donnée n'est jamais lue) */
+    alignas(64) std::atomic<int> taille;  /**< Nombre d'éléments (indicatif en concurrence) */
+} EnsembleConcurrent;
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+/**
+ * @brief Crée un ensemble concurrent vide
+ * @return Pointeur vers l'ensemble, ou NULL en cas d'échec
+ */
+EnsembleConcurrent* AllocateEnsembleConcurrent();
+
+/**
+ * @brief Libère l'ensemble et ses éléments (les nœuds déjà retirés suivent le domaine)
+ * @param ensemble Ensemble à détruire (plus aucun thread ne doit l'utiliser)
+ */
+void Detruire(EnsembleConcurrent* ensemble);
+
+// ============================================================================
+// OPÉRATIONS CONCURRENTES
+// ============================================================================
+
+/**
+ * @brief Insère une valeur à sa place (sans verrou)
+ * @param ensemble Ensemble concerné
+ * @param valeur Valeur à insérer
+ * @return false si la valeur était déjà présente ou si l'allocation échoue
+ */
+bool InsererTrie(EnsembleConcurrent* ensemble, int valeur);
+
+/**
+ * @brief Supprime une valeur (sans verrou)
+ * @param ensemble Ensemble concerné
+ * @param valeur Valeur à supprimer
+ * @return true si c'est cet appel qui a retiré la valeur
+ */
+bool SupprimerValeur(EnsembleConcurrent* ensemble, int valeur);
+
+/**
+ * @brief Teste la présence d'une valeur (sans attente, aucune écriture)
+ * @param ensemble Ensemble concerné
+ * @param valeur Valeur recherchée
+ * @return true si la valeur est présente et non marquée
+ */
+bool RechercherValeur(const EnsembleConcurrent* ensemble, int valeur);
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+/**
+ * @brief Nombre d'éléments (exact seulement en l'absence d'opérations en cours)
+ */
+int CompterElements(const EnsembleConcurrent* ensemble);
+
+bool EstVide(const EnsembleConcurrent* ensemble);
+
+/**
+ * @brief Représentation au format de ToString(const ListeSimple*)
+ * @note À n'appeler qu'en l'absence d'opérations concurrentes
+ */
+std::string ToString(const EnsembleConcurrent* ensemble);
+
+#endif
@@ -0,0 +1,219 @@
+#include "ListFile.h"
+#include <cstdlib>
+#include <new>
+#include <string>
+
+// ============================================================================
+// RÉSERVE DE NŒUDS (usage interne)
+// ============================================================================
+
+/*
+ * Un enfilement en retard peut encore tenter un compare-and-swap sur le lien
+ * d'un nœud déjà retiré de la file. Toute écriture de ce lien, y compris
+ * dans la réserve, incrémente donc sa marque : la valeur attendue par le
+ * retardataire ne peut plus se représenter.
+ */
+
+/**
+ * @brief Range un nœud retiré dans la réserve (jamais rendu à free avant Detruire)
+ */
+static void RendreNoeud(FileConcurrente* file, NoeudS* noeud) {
+    ReculExponentiel recul = CreerRecul();
+    PointeurMarque ancien = file->reserve.load(std::memory_order_relaxed);
+    while (true) {
+        PointeurMarque lien = LireLienMarque(noeud, std::memory_order_relaxed);
+        EcrireLienMarque(noeud, Remplacer(lien, AdresseDe<NoeudS>(ancien)), std::memory_order_relaxed);
+        if (file->reserve.compare_exchange_weak(ancien, Remplacer(ancien, noeud),
+                                                std::memory_order_release, std::memory_order_relaxed)) {
+            return;
+        }
+        Reculer(&recul);
+    }
+}
+
+/**
+ * @brief Reprend un nœud de la réserve, ou en alloue un ; son lien vaut NULL
+ */
+static NoeudS* ObtenirNoeud(FileConcurrente* file) {
+    ReculExponentiel recul = CreerRecul();
+    PointeurMarque ancien = file->reserve.load(std::memory_order_acquire);
+    while (true) {
+        NoeudS* premier = AdresseDe<NoeudS>(ancien);
+        if (premier == nullptr) {
+            NoeudS* noeud = (NoeudS*)malloc(sizeof(NoeudS));
+            if (noeud != nullptr) {
+                EcrireLienMarque(noeud, Marquer(nullptr, 0), std::memory_order_relaxed);
+            }
+            return noeud;
+        }
+
+        NoeudS* suivant = AdresseDe<NoeudS>(LireLienMarque(premier, std::memory_order_relaxed));
+        if (file->reserve.compare_exchange_weak(ancien, Remplacer(ancien, suivant),
+                                                std::memory_order_acquire, std::memory_order_acquire)) {
+            PointeurMarque lien = LireLienMarque(premier, std::memory_order_relaxed);
+            EcrireLienMarque(premier, Remplacer(lien, nullptr), std::memory_order_relaxed);
+            return premier;
+        }
+        Reculer(&recul);
+    }
+}
+
+static void LibererChaine(NoeudS* noeud) {
+    while (noeud != nullptr) {
+        NoeudS* suivant = AdresseDe<NoeudS>(LireLienMarque(noeud, std::memory_order_relaxed));
+        free(noeud);
+        noeud = suivant;
+    }
+}
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+FileConcurrente* AllocateFileConcurrente() {
+    FileConcurrente* file = new (std::nothrow) FileConcurrente;
+    if (file == nullptr) {
+        return nullptr;
+    }
+    file->reserve.store(Marquer(nullptr, 0), std::memory_order_relaxed);
+    file->taille.store(0, std::memory_order_relaxed);
+
+    NoeudS* factice = ObtenirNoeud(file);
+    if (factice == nullptr) {
+        delete file;
+        return nullptr;
+    }
+    factice->donnee = 0;
+    file->tete.store(Marquer(factice, 0), std::memory_order_relaxed);
+    file->queue.store(Marquer(factice, 0), std::memory_order_relaxed);
+    return file;
+}
+
+void Detruire(FileConcurrente* file) {
+    if (file == nullptr) {
+        return;
+    }
+    LibererChaine(AdresseDe<NoeudS>(file->tete.load(std::memory_order_acquire)));
+    LibererChaine(AdresseDe<NoeudS>(file->reserve.load(std::memory_order_acquire)));
+    delete file;
+}
+
+// ============================================================================
+// OPÉRATIONS CONCURRENTES
+// ============================================================================
+
+bool InsererFin(FileConcurrente* file, int valeur) {
+    if (file == nullptr) {
+        return false;
+    }
+    NoeudS* noeud = ObtenirNoeud(file);
+    if (noeud == nullptr) {
+        return false;
+    }
+    EcrireDonnee(noeud, valeur);
+
+    ReculExponentiel recul = CreerRecul();
+    PointeurMarque queue;
+    while (true) {
+        queue = file->queue.load(std::memory_order_acquire);
+        NoeudS* dernier = AdresseDe<NoeudS>(queue);
+        PointeurMarque suivant = LireLienMarque(dernier);
+
+        if (queue != file->queue.load(std::memory_order_acquire)) {
+            continue;
+        }
+        if (AdresseDe<NoeudS>(suivant) == nullptr) {
+            // dernier est bien le dernier : y accrocher le nœud
+            if (EchangerLienMarque(dernier, suivant, Remplacer(suivant, noeud))) {
+                break;
+            }
+            Reculer(&recul);
+        } else {
+            // Queue en retard : l'avancer avant de réessayer
+            file->queue.compare_exchange_strong(queue, Remplacer(queue, AdresseDe<NoeudS>(suivant)),
+                                                std::memory_order_release, std::memory_order_relaxed);
+        }
+    }
+
+    // Échec sans gravité : un autre thread a déjà avancé la queue
+    file->queue.compare_exchange_strong(queue, Remplacer(queue, noeud),
+                                        std::memory_order_release, std::memory_order_relaxed);
+    file->taille.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool SupprimerDebut(FileConcurrente* file, int* valeur) {
+    if (file == nullptr) {
+        return false;
+    }
+
+    ReculExponentiel recul = CreerRecul();
+    while (true) {
+        PointeurMarque tete = file->tete.load(std::memory_order_acquire);
+        PointeurMarque queue = file->queue.load(std::memory_order_acquire);
+        NoeudS* factice = AdresseDe<NoeudS>(tete);
+        NoeudS* premier = AdresseDe<NoeudS>(LireLienMarque(factice));
+
+        if (tete != file->tete.load(std::memory_order_acquire)) {
+            continue;
+        }
+        if (factice == AdresseDe<NoeudS>(queue)) {
+            if (premier == nullptr) {
+                return false;
+            }
+            file->queue.compare_exchange_strong(queue, Remplacer(queue, premier),
+                                                std::memory_order_release, std::memory_order_relaxed);
+            continue;
+        }
+
+        // Lire la valeur avant l'échange : ensuite, premier peut être défilé
+        // et recyclé par un autre thread
+        int donnee = LireDonnee(premier);
+        if (file->tete.compare_exchange_strong(tete, Remplacer(tete, premier),
+                                               std::memory_order_acquire, std::memory_order_relaxed)) {
+            file->taille.fetch_sub(1, std::memory_order_relaxed);
+            if (valeur != nullptr) {
+                *valeur = donnee;
+            }
+            RendreNoeud(file, factice);
+            return true;
+        }
+        Reculer(&recul);
+    }
+}
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+int CompterElements(const FileConcurrente* file) {
+    if (file == nullptr) {
+        return 0;
+    }
+    int taille = file->taille.load(std::memory_order_relaxed);
+    return taille < 0 ? 0 : taille;
+}
+
+bool EstVide(const FileConcurrente* file) {
+    if (file == nullptr) {
+        return true;
+    }
+    NoeudS* factice = AdresseDe<NoeudS>(file->tete.load(std::memory_order_acquire));
+    return AdresseDe<NoeudS>(LireLienMarque(factice)) == nullptr;
+}
+
+std::string ToString(const FileConcurrente* file) {
+    if (file == nullptr) {
+        return "Liste[NULL]";
+    }
+    std::string resultat = "Liste[";
+    NoeudS* factice = AdresseDe<NoeudS>(file->tete.load(std::memory_order_acquire));
+    for (NoeudS* noeud = AdresseDe<NoeudS>(LireLienMarque(factice)); noeud != nullptr;
+         noeud = AdresseDe<NoeudS>(LireLienMarque(noeud))) {
+        if (resultat.size() > 6) {
+            resultat += " -> ";
+        }
+        resultat += "Noeud(" + std::to_string(noeud->donnee) + ")";
+    }
+    return resultat + "]";
+}
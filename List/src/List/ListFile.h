@@ -0,0 +1,85 @@
+#ifndef LISTE_FILE_H
+#define LISTE_FILE_H
+
+#include "ListAtomique.h"
+#include "ListS.h"
+#include <atomic>
+#include <string>
+
+/**
+ * @brief File sans verrou multi-producteurs, multi-consommateurs (Michael-Scott)
+ *
+ * Les éléments sont des NoeudS chaînés de tete vers queue, précédés d'un
+ * nœud factice : tete désigne toujours le factice, dont le suivant porte la
+ * première valeur. InsererFin accroche le nœud derrière la queue par un
+ * compare-and-swap du lien suivant, puis avance queue ; un thread qui trouve
+ * une queue en retard l'avance à la place de son auteur. SupprimerDebut fait
+ * du premier nœud de valeur le nouveau factice.
+ *
+ * tete, queue et les liens suivant sont des pointeurs marqués
+ * (ListAtomique.h) : la marque change à chaque écriture, ce qui protège
+ * chaque compare-and-swap de l'ABA. Les nœuds retirés passent dans une
+ * réserve interne et ne sont rendus à free que par Detruire : un thread en
+ * retard peut toujours lire un nœud retiré sans danger.
+ */
+typedef struct {
+    alignas(64) std::atomic<PointeurMarque> tete;     /**< Nœud factice */
+    alignas(64) std::atomic<PointeurMarque> queue;    /**< Dernier nœud (ou son prédécesseur, en retard) */
+    alignas(64) std::atomic<PointeurMarque> reserve;  /**< Nœuds libres réutilisables */
+    alignas(64) std::atomic<int> taille;              /**< Nombre d'éléments (indicatif en concurrence) */
+} FileConcurrente;
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+/**
+ * @brief Crée une file concurrente vide (avec son nœud factice)
+ * @return Pointeur vers la file, ou NULL en cas d'échec
+ */
+FileConcurrente* AllocateFileConcurrente();
+
+/**
+ * @brief Libère la file, ses éléments et sa réserve de nœuds
+ * @param file File à détruire (plus aucun thread ne doit l'utiliser)
+ */
+void Detruire(FileConcurrente* file);
+
+// ============================================================================
+// OPÉRATIONS CONCURRENTES
+// ============================================================================
+
+/**
+ * @brief Enfile une valeur en queue (sans verrou)
+ * @param file File concernée
+ * @param valeur Valeur à enfiler
+ * @return false si aucun nœud n'a pu être obtenu
+ */
+bool InsererFin(FileConcurrente* file, int valeur);
+
+/**
+ * @brief Défile la valeur de tête (sans verrou)
+ * @param file File concernée
+ * @param valeur Reçoit la valeur défilée (peut être NULL)
+ * @return false si la file était vide
+ */
+bool SupprimerDebut(FileConcurrente* file, int* valeur);
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+/**
+ * @brief Nombre d'éléments (exact seulement en l'absence d'opérations en cours)
+ */
+int CompterElements(const FileConcurrente* file);
+
+bool EstVide(const FileConcurrente* file);
+
+/**
+ * @brief Représentation au format de ToString(const ListeSimple*)
+ * @note À n'appeler qu'en l'absence d'opérations concurrentes
+ */
+std::string ToString(const FileConcurrente* file);
+
+#endif
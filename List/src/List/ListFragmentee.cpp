@@ -0,0 +1,247 @@
+#include "ListFragmentee.h"
+#include "ListParcours.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+// ============================================================================
+// CHOIX DU FRAGMENT (usage interne)
+// ============================================================================
+
+/**
+ * @brief Indice stable du thread appelant, attribué à son premier appel
+ */
+static unsigned int IndiceThread() {
+    static std::atomic<unsigned int> prochain(0);
+    thread_local unsigned int indice = prochain.fetch_add(1, std::memory_order_relaxed);
+    return indice;
+}
+
+/**
+ * @brief Hachage multiplicatif : des valeurs consécutives se répartissent sur tous les fragments
+ */
+static unsigned int HacherValeur(int valeur) {
+    unsigned int x = (unsigned int)valeur * 2654435761u;
+    return x ^ (x >> 16);
+}
+
+static int IndiceFragment(const ListeFragmentee* liste, int valeur) {
+    unsigned int cle = liste->selection == FRAGMENTS_PAR_VALEUR ? HacherValeur(valeur) : IndiceThread();
+    return (int)(cle % (unsigned int)liste->nombre);
+}
+
+/**
+ * @brief Raccorde la chaîne tete..queue (compte nœuds, queue->suivant == NULL) à la fin de liste
+ */
+static void Raccorder(ListeSimple* liste, NoeudS* tete, NoeudS* queue, int compte) {
+    if (liste->tete == nullptr) {
+        liste->tete = tete;
+    } else {
+        liste->queue->suivant = tete;
+    }
+    liste->queue = queue;
+    liste->taille += compte;
+    // Les nœuds raccordés n'ont pas encore d'entrée : la table suit seulement la taille
+    AjusterSauts(liste);
+}
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+ListeFragmentee* AllocateFragmentee(int nombreFragments, SelectionFragment selection) {
+    if (nombreFragments <= 0) {
+        return nullptr;
+    }
+    ListeFragmentee* liste = (ListeFragmentee*)malloc(sizeof(ListeFragmentee));
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    liste->fragments = new (std::nothrow) FragmentListe[nombreFragments];
+    if (liste->fragments == nullptr) {
+        free(liste);
+        return nullptr;
+    }
+    for (int i = 0; i < nombreFragments; i++) {
+        liste->fragments[i].liste = CreerSimple();
+    }
+    liste->nombre = nombreFragments;
+    liste->selection = selection;
+    return liste;
+}
+
+void Detruire(ListeFragmentee* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    for (int i = 0; i < liste->nombre; i++) {
+        Nettoyer(&liste->fragments[i].liste);
+    }
+    delete[] liste->fragments;
+    free(liste);
+}
+
+// ============================================================================
+// FONCTIONS D'INSERTION ET DE SUPPRESSION
+// ============================================================================
+
+bool InsererFin(ListeFragmentee* liste, int valeur) {
+    if (liste == nullptr) {
+        return false;
+    }
+    // Allocation hors verrou : la section critique se réduit à deux écritures
+    NoeudS* noeud = CreerNoeudS(valeur);
+    if (noeud == nullptr) {
+        return false;
+    }
+    FragmentListe* fragment = &liste->fragments[IndiceFragment(liste, valeur)];
+    std::lock_guard<std::mutex> garde(fragment->verrou);
+    Raccorder(&fragment->liste, noeud, noeud, 1);
+    return true;
+}
+
+int InsererLot(ListeFragmentee* liste, const int* valeurs, int nombre) {
+    if (liste == nullptr || valeurs == nullptr || nombre <= 0) {
+        return 0;
+    }
+
+    // Une chaîne locale par fragment, construite sans verrou
+    ListeSimple* chaines = (ListeSimple*)malloc((size_t)liste->nombre * sizeof(ListeSimple));
+    if (chaines == nullptr) {
+        return 0;
+    }
+    for (int i = 0; i < liste->nombre; i++) {
+        chaines[i] = CreerSimple();
+    }
+    int inseres = 0;
+    for (; inseres < nombre; inseres++) {
+        NoeudS* noeud = CreerNoeudS(valeurs[inseres]);
+        if (noeud == nullptr) {
+            break;
+        }
+        Raccorder(&chaines[IndiceFragment(liste, valeurs[inseres])], noeud, noeud, 1);
+    }
+
+    for (int i = 0; i < liste->nombre; i++) {
+        if (chaines[i].tete == nullptr) {
+            continue;
+        }
+        FragmentListe* fragment = &liste->fragments[i];
+        std::lock_guard<std::mutex> garde(fragment->verrou);
+        Raccorder(&fragment->liste, chaines[i].tete, chaines[i].queue, chaines[i].taille);
+    }
+    free(chaines);
+    return inseres;
+}
+
+bool SupprimerValeur(ListeFragmentee* liste, int valeur) {
+    if (liste == nullptr) {
+        return false;
+    }
+    if (liste->selection == FRAGMENTS_PAR_VALEUR) {
+        FragmentListe* fragment = &liste->fragments[IndiceFragment(liste, valeur)];
+        std::lock_guard<std::mutex> garde(fragment->verrou);
+        return SupprimerValeur(&fragment->liste, valeur);
+    }
+    for (int i = 0; i < liste->nombre; i++) {
+        std::lock_guard<std::mutex> garde(liste->fragments[i].verrou);
+        if (SupprimerValeur(&liste->fragments[i].liste, valeur)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int ConcatenerTout(ListeFragmentee* liste, ListeSimple* destination) {
+    if (liste == nullptr || destination == nullptr) {
+        return 0;
+    }
+
+    bool etaitCirculaire = destination->estCirculaire;
+    if (etaitCirculaire) {
+        RendreLineaire(destination);
+    }
+
+    int deplaces = 0;
+    for (int i = 0; i < liste->nombre; i++) {
+        FragmentListe* fragment = &liste->fragments[i];
+        std::lock_guard<std::mutex> garde(fragment->verrou);
+        if (fragment->liste.tete == nullptr) {
+            continue;
+        }
+        // Les nœuds changent de propriétaire : le fragment est simplement remis à vide
+        Raccorder(destination, fragment->liste.tete, fragment->liste.queue, fragment->liste.taille);
+        deplaces += fragment->liste.taille;
+        fragment->liste.tete = nullptr;
+        fragment->liste.queue = nullptr;
+        fragment->liste.taille = 0;
+    }
+
+    if (etaitCirculaire) {
+        RendreCirculaire(destination);
+    }
+    return deplaces;
+}
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+bool RechercherValeur(ListeFragmentee* liste, int valeur) {
+    if (liste == nullptr) {
+        return false;
+    }
+    if (liste->selection == FRAGMENTS_PAR_VALEUR) {
+        FragmentListe* fragment = &liste->fragments[IndiceFragment(liste, valeur)];
+        std::lock_guard<std::mutex> garde(fragment->verrou);
+        return RechercherValeur(&fragment->liste, valeur) != nullptr;
+    }
+    for (int i = 0; i < liste->nombre; i++) {
+        std::lock_guard<std::mutex> garde(liste->fragments[i].verrou);
+        if (RechercherValeur(&liste->fragments[i].liste, valeur) != nullptr) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int CompterElements(ListeFragmentee* liste) {
+    if (liste == nullptr) {
+        return 0;
+    }
+    int total = 0;
+    for (int i = 0; i < liste->nombre; i++) {
+        std::lock_guard<std::mutex> garde(liste->fragments[i].verrou);
+        total += liste->fragments[i].liste.taille;
+    }
+    return total;
+}
+
+bool EstVide(ListeFragmentee* liste) {
+    if (liste == nullptr) {
+        return true;
+    }
+    for (int i = 0; i < liste->nombre; i++) {
+        std::lock_guard<std::mutex> garde(liste->fragments[i].verrou);
+        if (liste->fragments[i].liste.taille != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string ToString(ListeFragmentee* liste) {
+    if (liste == nullptr) {
+        return "Fragments[NULL]";
+    }
+    std::string resultat = "Fragments[";
+    for (int i = 0; i < liste->nombre; i++) {
+        if (i > 0) {
+            resultat += " | ";
+        }
+        std::lock_guard<std::mutex> garde(liste->fragments[i].verrou);
+        resultat += ToString((const ListeSimple*)&liste->fragments[i].liste);
+    }
+    return resultat + "]";
+}
@@ -0,0 +1,114 @@
+#ifndef LISTE_FRAGMENTEE_H
+#define LISTE_FRAGMENTEE_H
+
+#include "ListS.h"
+#include <mutex>
+#include <string>
+
+/**
+ * @brief Choix du fragment qui reçoit une insertion
+ */
+typedef enum {
+    FRAGMENTS_PAR_VALEUR = 0,   /**< Hachage de la valeur : une valeur donnée vit dans un seul fragment */
+    FRAGMENTS_PAR_THREAD = 1    /**< Indice du thread : chaque chargeur remplit son propre fragment */
+} SelectionFragment;
+
+/**
+ * @brief Fragment d'une liste fragmentée : une ListeSimple et son verrou, sur sa propre ligne de cache
+ */
+typedef struct {
+    alignas(64) std::mutex verrou;  /**< Protège liste */
+    ListeSimple liste;              /**< Éléments du fragment, dans leur ordre d'insertion */
+} FragmentListe;
+
+/**
+ * @brief Conteneur de N ListeSimple pour l'ingestion parallèle
+ *
+ * Des chargeurs qui appellent tous InsererFin sur une même ListeSimple se
+ * sérialisent sur un seul verrou. Ici chaque insertion ne verrouille que
+ * son fragment : avec assez de fragments, les chargeurs ne se croisent
+ * presque plus. Les opérations d'ensemble (CompterElements,
+ * RechercherValeur, ToString) visitent les fragments l'un après l'autre ;
+ * pendant des insertions concurrentes, leur résultat n'est pas un
+ * instantané de tout le conteneur.
+ *
+ * ConcatenerTout vide les fragments dans une ListeSimple en raccordant
+ * leurs chaînes de nœuds : O(N) pour N fragments, sans copie ni parcours.
+ * L'ordre d'insertion est conservé à l'intérieur de chaque fragment.
+ */
+typedef struct {
+    FragmentListe* fragments;       /**< Tableau de nombre fragments */
+    int nombre;                     /**< Nombre de fragments */
+    SelectionFragment selection;    /**< Règle de choix du fragment */
+} ListeFragmentee;
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+/**
+ * @brief Crée un conteneur vide
+ * @param nombreFragments Nombre de fragments (strictement positif)
+ * @param selection Règle de choix du fragment à l'insertion
+ * @return Pointeur vers le conteneur, ou NULL en cas d'échec
+ */
+ListeFragmentee* AllocateFragmentee(int nombreFragments, SelectionFragment selection = FRAGMENTS_PAR_VALEUR);
+
+/**
+ * @brief Libère le conteneur et tous ses nœuds (plus aucun thread ne doit l'utiliser)
+ */
+void Detruire(ListeFragmentee* liste);
+
+// ============================================================================
+// FONCTIONS D'INSERTION ET DE SUPPRESSION
+// ============================================================================
+
+/**
+ * @brief Ajoute une valeur à la fin de son fragment
+ * @return false si l'allocation échoue
+ */
+bool InsererFin(ListeFragmentee* liste, int valeur);
+
+/**
+ * @brief Ajoute un lot de valeurs, chaque fragment n'étant verrouillé qu'une fois
+ *
+ * Les nœuds sont alloués et chaînés hors verrou, puis chaque chaîne est
+ * raccordée à la fin de son fragment.
+ * @return Nombre de valeurs insérées (moins que nombre si une allocation échoue)
+ */
+int InsererLot(ListeFragmentee* liste, const int* valeurs, int nombre);
+
+/**
+ * @brief Supprime la première occurrence d'une valeur
+ *
+ * Par valeur, seul le fragment de la valeur est visité ; par thread, les
+ * fragments le sont tous, dans l'ordre.
+ * @return true si une occurrence a été supprimée
+ */
+bool SupprimerValeur(ListeFragmentee* liste, int valeur);
+
+/**
+ * @brief Vide tous les fragments dans destination, à la suite de ses éléments
+ *
+ * Les chaînes des fragments sont raccordées dans l'ordre des fragments ;
+ * aucun nœud n'est copié ni parcouru.
+ * @return Nombre d'éléments déplacés
+ */
+int ConcatenerTout(ListeFragmentee* liste, ListeSimple* destination);
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+bool RechercherValeur(ListeFragmentee* liste, int valeur);
+
+int CompterElements(ListeFragmentee* liste);
+
+bool EstVide(ListeFragmentee* liste);
+
+/**
+ * @brief Représentation fragment par fragment : "Fragments[Liste[...] | Liste[...]]"
+ */
+std::string ToString(ListeFragmentee* liste);
+
+#endif
@@ -0,0 +1,1198 @@
+#ifndef LISTE_GENERIQUE_H
+#define LISTE_GENERIQUE_H
+
+#include "ListIterateurs.h"
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Listes chaînées génériques : mêmes algorithmes que ListeSimple et
+ * ListeDouble, mais la donnée est stockée directement dans le nœud au lieu
+ * de passer par un entier servant d'index dans une table annexe.
+ *
+ * Chaque liste porte une std::pmr::memory_resource qui fournit tous ses
+ * nœuds (NULL = malloc) : monotonic_buffer_resource convient aux listes
+ * d'une requête, unsynchronized_pool_resource aux listes longues. Copier,
+ * Diviser et les fusions propagent la ressource.
+ *
+ * La donnée est construite sur place : T peut n'être que déplaçable (les
+ * fonctions qui copient exigent alors un T copiable). Quand T est
+ * trivialement copiable, les copies passent par memcpy et la libération
+ * n'appelle aucun destructeur ; NoeudST<int> a la même disposition mémoire
+ * que NoeudS. L'API int existante reste inchangée.
+ *
+ * Les listes génériques sont toujours linéaires.
+ */
+
+/**
+ * @brief Nœud de liste simplement chaînée générique
+ */
+template <typename T>
+struct NoeudST {
+    T donnee;             /**< Donnée stockée dans le nœud */
+    NoeudST* suivant;     /**< Pointeur vers le nœud suivant */
+};
+
+/**
+ * @brief Liste simplement chaînée générique
+ */
+template <typename T>
+struct ListeSimpleT {
+    NoeudST<T>* tete;     /**< Premier nœud */
+    NoeudST<T>* queue;    /**< Dernier nœud */
+    int taille;           /**< Nombre d'éléments */
+    bool estAllouee;      /**< Structure allouée par AllocateSimpleT (libérée par Detruire) */
+    std::pmr::memory_resource* ressource; /**< Provenance des nœuds (NULL = malloc) */
+};
+
+/**
+ * @brief Nœud de liste doublement chaînée générique
+ */
+template <typename T>
+struct NoeudDT {
+    T donnee;             /**< Donnée stockée dans le nœud */
+    NoeudDT* precedent;   /**< Pointeur vers le nœud précédent */
+    NoeudDT* suivant;     /**< Pointeur vers le nœud suivant */
+};
+
+/**
+ * @brief Liste doublement chaînée générique
+ */
+template <typename T>
+struct ListeDoubleT {
+    NoeudDT<T>* tete;     /**< Premier nœud */
+    NoeudDT<T>* queue;    /**< Dernier nœud */
+    int taille;           /**< Nombre d'éléments */
+    bool estAllouee;      /**< Structure allouée par AllocateDoubleT (libérée par Detruire) */
+    std::pmr::memory_resource* ressource; /**< Provenance des nœuds (NULL = malloc) */
+};
+
+static_assert(sizeof(NoeudST<int>) == sizeof(NoeudS), "NoeudST<int> doit avoir la disposition de NoeudS");
+static_assert(sizeof(NoeudDT<int>) == sizeof(NoeudD), "NoeudDT<int> doit avoir la disposition de NoeudD");
+
+// ============================================================================
+// GESTION DES NŒUDS (usage interne)
+// ============================================================================
+
+/**
+ * @brief Réserve un bloc auprès d'une ressource (malloc si ressource est NULL)
+ * @return Bloc, ou NULL si l'allocation échoue
+ */
+inline void* AllouerBlocT(std::pmr::memory_resource* ressource, size_t taille, size_t alignement) {
+    if (ressource == nullptr) {
+        return malloc(taille);
+    }
+    try {
+        return ressource->allocate(taille, alignement);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+/**
+ * @brief Rend un bloc obtenu par AllouerBlocT
+ */
+inline void RendreBlocT(std::pmr::memory_resource* ressource, void* bloc, size_t taille, size_t alignement) {
+    if (ressource == nullptr) {
+        free(bloc);
+    } else {
+        ressource->deallocate(bloc, taille, alignement);
+    }
+}
+
+/**
+ * @brief Indique si les blocs d'une ressource peuvent être rendus à l'autre
+ */
+inline bool MemesRessourcesT(std::pmr::memory_resource* a, std::pmr::memory_resource* b) {
+    return a == b || (a != nullptr && b != nullptr && a->is_equal(*b));
+}
+
+/**
+ * @brief Alloue un nœud et construit sa donnée sur place
+ * @param ressource Provenance du nœud (NULL = malloc)
+ * @param arguments Arguments transmis au constructeur de T
+ * @return Nœud aux liens nuls, ou NULL si l'allocation échoue
+ */
+template <typename Noeud, typename... Arguments>
+Noeud* ConstruireNoeudT(std::pmr::memory_resource* ressource, Arguments&&... arguments) {
+    Noeud* noeud = (Noeud*)AllouerBlocT(ressource, sizeof(Noeud), alignof(Noeud));
+    if (noeud == nullptr) {
+        return nullptr;
+    }
+    using T = decltype(Noeud::donnee);
+    if constexpr (std::is_nothrow_constructible_v<T, Arguments&&...>) {
+        ::new ((void*)&noeud->donnee) T(std::forward<Arguments>(arguments)...);
+    } else {
+        try {
+            ::new ((void*)&noeud->donnee) T(std::forward<Arguments>(arguments)...);
+        } catch (...) {
+            RendreBlocT(ressource, noeud, sizeof(Noeud), alignof(Noeud));
+            throw;
+        }
+    }
+    noeud->suivant = nullptr;
+    if constexpr (requires { noeud->precedent; }) {
+        noeud->precedent = nullptr;
+    }
+    return noeud;
+}
+
+/**
+ * @brief Alloue un nœud portant une copie de la donnée d'un autre
+ * @note Copie octet par octet quand T est trivialement copiable
+ */
+template <typename Noeud>
+Noeud* CopierNoeudT(std::pmr::memory_resource* ressource, const Noeud* source) {
+    using T = decltype(Noeud::donnee);
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        Noeud* noeud = (Noeud*)AllouerBlocT(ressource, sizeof(Noeud), alignof(Noeud));
+        if (noeud == nullptr) {
+            return nullptr;
+        }
+        memcpy((void*)&noeud->donnee, (const void*)&source->donnee, sizeof(T));
+        noeud->suivant = nullptr;
+        if constexpr (requires { noeud->precedent; }) {
+            noeud->precedent = nullptr;
+        }
+        return noeud;
+    } else {
+        return ConstruireNoeudT<Noeud>(ressource, source->donnee);
+    }
+}
+
+/**
+ * @brief Détruit la donnée d'un nœud puis le rend à sa ressource
+ */
+template <typename Noeud>
+void LibererNoeudT(std::pmr::memory_resource* ressource, Noeud* noeud) {
+    using T = decltype(Noeud::donnee);
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        noeud->donnee.~T();
+    }
+    RendreBlocT(ressource, noeud, sizeof(Noeud), alignof(Noeud));
+}
+
+/**
+ * @brief Déplace les données d'une liste dans des nœuds pris à une autre ressource
+ *
+ * Tous les nouveaux nœuds sont réservés avant le premier déplacement : en cas
+ * d'échec la liste est laissée intacte. En cas de succès la chaîne appartient
+ * à ressource : l'appelant doit la transférer à une liste de cette ressource.
+ * @return true si les nœuds de la liste viennent désormais de ressource
+ */
+template <typename Liste>
+bool RelogerT(Liste* liste, std::pmr::memory_resource* ressource) {
+    using Noeud = std::remove_pointer_t<decltype(liste->tete)>;
+    using T = decltype(Noeud::donnee);
+    if (MemesRessourcesT(liste->ressource, ressource)) {
+        return true;
+    }
+
+    // Réservation : les blocs bruts sont chaînés par leur champ suivant
+    Noeud* blocs = nullptr;
+    for (int i = 0; i < liste->taille; i++) {
+        Noeud* bloc = (Noeud*)AllouerBlocT(ressource, sizeof(Noeud), alignof(Noeud));
+        if (bloc == nullptr) {
+            while (blocs != nullptr) {
+                Noeud* suivant = blocs->suivant;
+                RendreBlocT(ressource, blocs, sizeof(Noeud), alignof(Noeud));
+                blocs = suivant;
+            }
+            return false;
+        }
+        bloc->suivant = blocs;
+        blocs = bloc;
+    }
+
+    Noeud* precedent = nullptr;
+    Noeud* ancien = liste->tete;
+    liste->tete = nullptr;
+    while (ancien != nullptr) {
+        Noeud* nouveau = blocs;
+        blocs = blocs->suivant;
+        ::new ((void*)&nouveau->donnee) T(std::move(ancien->donnee));
+        nouveau->suivant = nullptr;
+        if constexpr (requires { nouveau->precedent; }) {
+            nouveau->precedent = precedent;
+        }
+        if (precedent != nullptr) {
+            precedent->suivant = nouveau;
+        } else {
+            liste->tete = nouveau;
+        }
+        precedent = nouveau;
+
+        Noeud* suivant = ancien->suivant;
+        LibererNoeudT(liste->ressource, ancien);
+        ancien = suivant;
+    }
+    liste->queue = precedent;
+    return true;
+}
+
+// ============================================================================
+// LISTE SIMPLE GÉNÉRIQUE : CRÉATION ET DESTRUCTION
+// ============================================================================
+
+/**
+ * @brief Crée une liste vide sur le tas
+ * @param ressource Provenance des nœuds (NULL = malloc) ; la structure vient de malloc
+ * @return Liste allouée (à rendre par Detruire), ou NULL
+ */
+template <typename T>
+ListeSimpleT<T>* AllocateSimpleT(std::pmr::memory_resource* ressource = nullptr) {
+    ListeSimpleT<T>* liste = (ListeSimpleT<T>*)malloc(sizeof(ListeSimpleT<T>));
+    if (liste != nullptr) {
+        liste->tete = nullptr;
+        liste->queue = nullptr;
+        liste->taille = 0;
+        liste->estAllouee = true;
+        liste->ressource = ressource;
+    }
+    return liste;
+}
+
+/**
+ * @brief Crée une liste vide par valeur
+ * @param ressource Provenance des nœuds (NULL = malloc)
+ */
+template <typename T>
+ListeSimpleT<T> CreerSimpleT(std::pmr::memory_resource* ressource = nullptr) {
+    ListeSimpleT<T> liste;
+    liste.tete = nullptr;
+    liste.queue = nullptr;
+    liste.taille = 0;
+    liste.estAllouee = false;
+    liste.ressource = ressource;
+    return liste;
+}
+
+/**
+ * @brief Libère tous les nœuds ; la liste reste utilisable
+ */
+template <typename T>
+void Nettoyer(ListeSimpleT<T>* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    NoeudST<T>* courant = liste->tete;
+    while (courant != nullptr) {
+        NoeudST<T>* suivant = courant->suivant;
+        LibererNoeudT(liste->ressource, courant);
+        courant = suivant;
+    }
+    liste->tete = nullptr;
+    liste->queue = nullptr;
+    liste->taille = 0;
+}
+
+/**
+ * @brief Libère les nœuds puis la structure si elle vient d'AllocateSimpleT
+ */
+template <typename T>
+void Detruire(ListeSimpleT<T>* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    Nettoyer(liste);
+    if (liste->estAllouee) {
+        free(liste);
+    }
+}
+
+// ============================================================================
+// LISTE SIMPLE GÉNÉRIQUE : INSERTION
+// ============================================================================
+
+/**
+ * @brief Construit un élément sur place en tête de liste
+ * @param arguments Arguments transmis au constructeur de T
+ * @return Nœud créé, ou NULL en cas d'échec
+ */
+template <typename T, typename... Arguments>
+NoeudST<T>* EmplacerDebut(ListeSimpleT<T>* liste, Arguments&&... arguments) {
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    NoeudST<T>* nouveau = ConstruireNoeudT<NoeudST<T>>(liste->ressource, std::forward<Arguments>(arguments)...);
+    if (nouveau == nullptr) {
+        return nullptr;
+    }
+    nouveau->suivant = liste->tete;
+    liste->tete = nouveau;
+    if (liste->queue == nullptr) {
+        liste->queue = nouveau;
+    }
+    liste->taille++;
+    return nouveau;
+}
+
+/**
+ * @brief Construit un élément sur place en fin de liste
+ * @param arguments Arguments transmis au constructeur de T
+ * @return Nœud créé, ou NULL en cas d'échec
+ */
+template <typename T, typename... Arguments>
+NoeudST<T>* EmplacerFin(ListeSimpleT<T>* liste, Arguments&&... arguments) {
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    NoeudST<T>* nouveau = ConstruireNoeudT<NoeudST<T>>(liste->ressource, std::forward<Arguments>(arguments)...);
+    if (nouveau == nullptr) {
+        return nullptr;
+    }
+    if (liste->queue == nullptr) {
+        liste->tete = nouveau;
+    } else {
+        liste->queue->suivant = nouveau;
+    }
+    liste->queue = nouveau;
+    liste->taille++;
+    return nouveau;
+}
+
+/**
+ * @brief Construit un élément sur place après un nœud
+ * @param precedent Nœud de la liste après lequel insérer
+ * @param arguments Arguments transmis au constructeur de T
+ * @return Nœud créé, ou NULL en cas d'échec
+ */
+template <typename T, typename... Arguments>
+NoeudST<T>* EmplacerApres(ListeSimpleT<T>* liste, NoeudST<T>* precedent, Arguments&&... arguments) {
+    if (liste == nullptr || precedent == nullptr) {
+        return nullptr;
+    }
+    NoeudST<T>* nouveau = ConstruireNoeudT<NoeudST<T>>(liste->ressource, std::forward<Arguments>(arguments)...);
+    if (nouveau == nullptr) {
+        return nullptr;
+    }
+    nouveau->suivant = precedent->suivant;
+    precedent->suivant = nouveau;
+    if (liste->queue == precedent) {
+        liste->queue = nouveau;
+    }
+    liste->taille++;
+    return nouveau;
+}
+
+/**
+ * @brief Insère une valeur en tête (copiée ou déplacée selon l'argument)
+ * @return true si l'insertion a réussi
+ */
+template <typename T, typename U>
+bool InsererDebut(ListeSimpleT<T>* liste, U&& valeur) {
+    return EmplacerDebut(liste, std::forward<U>(valeur)) != nullptr;
+}
+
+/**
+ * @brief Insère une valeur en fin (copiée ou déplacée selon l'argument)
+ * @return true si l'insertion a réussi
+ */
+template <typename T, typename U>
+bool InsererFin(ListeSimpleT<T>* liste, U&& valeur) {
+    return EmplacerFin(liste, std::forward<U>(valeur)) != nullptr;
+}
+
+// ============================================================================
+// LISTE SIMPLE GÉNÉRIQUE : SUPPRESSION
+// ============================================================================
+
+/**
+ * @brief Retire la tête en déplaçant sa donnée vers sortie
+ * @param sortie Destination de la donnée (NULL pour la détruire)
+ * @return true si un élément a été retiré
+ */
+template <typename T>
+bool ExtraireDebut(ListeSimpleT<T>* liste, T* sortie) {
+    if (liste == nullptr || liste->tete == nullptr) {
+        return false;
+    }
+    NoeudST<T>* ancien = liste->tete;
+    liste->tete = ancien->suivant;
+    if (liste->tete == nullptr) {
+        liste->queue = nullptr;
+    }
+    liste->taille--;
+    if (sortie != nullptr) {
+        *sortie = std::move(ancien->donnee);
+    }
+    LibererNoeudT(liste->ressource, ancien);
+    return true;
+}
+
+/**
+ * @brief Supprime la tête
+ * @return true si un élément a été supprimé
+ */
+template <typename T>
+bool SupprimerDebut(ListeSimpleT<T>* liste) {
+    return ExtraireDebut(liste, (T*)nullptr);
+}
+
+/**
+ * @brief Supprime le nœud qui suit precedent (la tête si precedent est NULL)
+ * @return true si un élément a été supprimé
+ */
+template <typename T>
+bool SupprimerApres(ListeSimpleT<T>* liste, NoeudST<T>* precedent) {
+    if (liste == nullptr) {
+        return false;
+    }
+    if (precedent == nullptr) {
+        return SupprimerDebut(liste);
+    }
+    NoeudST<T>* cible = precedent->suivant;
+    if (cible == nullptr) {
+        return false;
+    }
+    precedent->suivant = cible->suivant;
+    if (liste->queue == cible) {
+        liste->queue = precedent;
+    }
+    liste->taille--;
+    LibererNoeudT(liste->ressource, cible);
+    return true;
+}
+
+// ============================================================================
+// LISTE SIMPLE GÉNÉRIQUE : RECHERCHE ET ACCÈS
+// ============================================================================
+
+/**
+ * @brief Recherche la première valeur égale (operator==)
+ * @return Nœud trouvé, ou NULL
+ */
+template <typename T, typename U>
+NoeudST<T>* RechercherValeur(const ListeSimpleT<T>* liste, const U& valeur) {
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    for (NoeudST<T>* courant = liste->tete; courant != nullptr; courant = courant->suivant) {
+        if (courant->donnee == valeur) {
+            return courant;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Nœud à une position donnée (0 = tête)
+ * @return Nœud, ou NULL si la position est hors limites
+ */
+template <typename T>
+NoeudST<T>* ObtenirNoeudPosition(const ListeSimpleT<T>* liste, int position) {
+    if (liste == nullptr || position < 0 || position >= liste->taille) {
+        return nullptr;
+    }
+    if (position == liste->taille - 1) {
+        return liste->queue;
+    }
+    NoeudST<T>* courant = liste->tete;
+    for (int i = 0; i < position; i++) {
+        courant = courant->suivant;
+    }
+    return courant;
+}
+
+template <typename T>
+bool EstVide(const ListeSimpleT<T>* liste) {
+    return liste == nullptr || liste->taille == 0;
+}
+
+// ============================================================================
+// LISTE SIMPLE GÉNÉRIQUE : OPÉRATIONS SUR LA LISTE
+// ============================================================================
+
+/**
+ * @brief Inverse l'ordre des nœuds (aucune donnée déplacée)
+ */
+template <typename T>
+void Inverser(ListeSimpleT<T>* liste) {
+    if (liste == nullptr || liste->taille < 2) {
+        return;
+    }
+    NoeudST<T>* precedent = nullptr;
+    NoeudST<T>* courant = liste->tete;
+    liste->queue = courant;
+    while (courant != nullptr) {
+        NoeudST<T>* suivant = courant->suivant;
+        courant->suivant = precedent;
+        precedent = courant;
+        courant = suivant;
+    }
+    liste->tete = precedent;
+}
+
+/**
+ * @brief Copie profonde d'une liste (T copiable) dans une ressource donnée
+ * @param ressource Provenance de la copie (NULL = malloc)
+ * @return Nouvelle liste allouée, ou NULL en cas d'échec
+ */
+template <typename T>
+ListeSimpleT<T>* Copier(const ListeSimpleT<T>* liste, std::pmr::memory_resource* ressource) {
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    ListeSimpleT<T>* copie = AllocateSimpleT<T>(ressource);
+    if (copie == nullptr) {
+        return nullptr;
+    }
+    for (const NoeudST<T>* courant = liste->tete; courant != nullptr; courant = courant->suivant) {
+        NoeudST<T>* nouveau = CopierNoeudT(ressource, courant);
+        if (nouveau == nullptr) {
+            Detruire(copie);
+            return nullptr;
+        }
+        if (copie->queue == nullptr) {
+            copie->tete = nouveau;
+        } else {
+            copie->queue->suivant = nouveau;
+        }
+        copie->queue = nouveau;
+        copie->taille++;
+    }
+    return copie;
+}
+
+/**
+ * @brief Copie profonde d'une liste, dans la même ressource que l'original
+ * @return Nouvelle liste allouée, ou NULL en cas d'échec
+ */
+template <typename T>
+ListeSimpleT<T>* Copier(const ListeSimpleT<T>* liste) {
+    return liste != nullptr ? Copier(liste, liste->ressource) : nullptr;
+}
+
+/**
+ * @brief Déplace tous les nœuds de source à la fin de destination
+ * @return true si source a été vidée dans destination
+ * @note O(1) si les deux listes partagent leur ressource ; sinon les données
+ *       sont d'abord déplacées dans des nœuds de la ressource de destination
+ */
+template <typename T>
+bool Concatener(ListeSimpleT<T>* destination, ListeSimpleT<T>* source) {
+    if (destination == nullptr || source == nullptr || destination == source) {
+        return false;
+    }
+    if (source->tete == nullptr) {
+        return true;
+    }
+    if (!RelogerT(source, destination->ressource)) {
+        return false;
+    }
+    if (destination->queue == nullptr) {
+        destination->tete = source->tete;
+    } else {
+        destination->queue->suivant = source->tete;
+    }
+    destination->queue = source->queue;
+    destination->taille += source->taille;
+    source->tete = nullptr;
+    source->queue = nullptr;
+    source->taille = 0;
+    return true;
+}
+
+/**
+ * @brief Coupe la liste : les nœuds à partir de position passent dans liste2
+ * @param position Premier nœud de liste2 (entre 1 et taille - 1)
+ * @param liste2 Liste vide qui reçoit la seconde partie et la ressource de liste
+ */
+template <typename T>
+void Diviser(ListeSimpleT<T>* liste, int position, ListeSimpleT<T>* liste2) {
+    if (liste == nullptr || liste2 == nullptr || liste2->tete != nullptr ||
+        position < 1 || position >= liste->taille) {
+        return;
+    }
+    NoeudST<T>* nouvelleQueue = ObtenirNoeudPosition(liste, position - 1);
+    liste2->tete = nouvelleQueue->suivant;
+    liste2->queue = liste->queue;
+    liste2->taille = liste->taille - position;
+    liste2->ressource = liste->ressource;
+    nouvelleQueue->suivant = nullptr;
+    liste->queue = nouvelleQueue;
+    liste->taille = position;
+}
+
+/**
+ * @brief Fusionne deux listes triées en reliant leurs nœuds (stable)
+ * @param destination Liste triée qui reçoit le résultat
+ * @param source Liste triée vidée par l'opération
+ * @param inferieur Comparateur strict (a < b par défaut)
+ * @return true si la fusion a eu lieu
+ * @note Sans allocation si les deux listes partagent leur ressource
+ */
+template <typename T, typename Comparateur = std::less<T>>
+bool Fusionner(ListeSimpleT<T>* destination, ListeSimpleT<T>* source, Comparateur inferieur = Comparateur()) {
+    if (destination == nullptr || source == nullptr || destination == source) {
+        return false;
+    }
+    if (source->tete == nullptr) {
+        return true;
+    }
+    if (!RelogerT(source, destination->ressource)) {
+        return false;
+    }
+    NoeudST<T>** lien = &destination->tete;
+    NoeudST<T>* a = destination->tete;
+    NoeudST<T>* b = source->tete;
+    while (a != nullptr && b != nullptr) {
+        if (inferieur(b->donnee, a->donnee)) {
+            *lien = b;
+            b = b->suivant;
+        } else {
+            *lien = a;
+            a = a->suivant;
+        }
+        lien = &(*lien)->suivant;
+    }
+    *lien = (a != nullptr) ? a : b;
+    if (b != nullptr) {
+        destination->queue = source->queue;
+    }
+    destination->taille += source->taille;
+    source->tete = nullptr;
+    source->queue = nullptr;
+    source->taille = 0;
+    return true;
+}
+
+/**
+ * @brief Fusionne deux listes triées dans une nouvelle liste (T copiable)
+ * @param inferieur Comparateur strict (a < b par défaut)
+ * @return Nouvelle liste allouée dans la ressource de liste1, ou NULL
+ */
+template <typename T, typename Comparateur = std::less<T>>
+ListeSimpleT<T>* FusionnerListesTriees(const ListeSimpleT<T>* liste1, const ListeSimpleT<T>* liste2,
+                                       Comparateur inferieur = Comparateur()) {
+    if (liste1 == nullptr || liste2 == nullptr) {
+        return nullptr;
+    }
+    ListeSimpleT<T>* resultat = Copier(liste1);
+    ListeSimpleT<T>* second = Copier(liste2, liste1->ressource);
+    bool fusionnee = resultat != nullptr && second != nullptr && Fusionner(resultat, second, inferieur);
+    Detruire(second);
+    if (!fusionnee) {
+        Detruire(resultat);
+        return nullptr;
+    }
+    return resultat;
+}
+
+// ============================================================================
+// LISTE DOUBLE GÉNÉRIQUE : CRÉATION ET DESTRUCTION
+// ============================================================================
+
+/**
+ * @brief Crée une liste double vide sur le tas
+ * @param ressource Provenance des nœuds (NULL = malloc) ; la structure vient de malloc
+ * @return Liste allouée (à rendre par Detruire), ou NULL
+ */
+template <typename T>
+ListeDoubleT<T>* AllocateDoubleT(std::pmr::memory_resource* ressource = nullptr) {
+    ListeDoubleT<T>* liste = (ListeDoubleT<T>*)malloc(sizeof(ListeDoubleT<T>));
+    if (liste != nullptr) {
+        liste->tete = nullptr;
+        liste->queue = nullptr;
+        liste->taille = 0;
+        liste->estAllouee = true;
+        liste->ressource = ressource;
+    }
+    return liste;
+}
+
+/**
+ * @brief Crée une liste double vide par valeur
+ * @param ressource Provenance des nœuds (NULL = malloc)
+ */
+template <typename T>
+ListeDoubleT<T> CreerDoubleT(std::pmr::memory_resource* ressource = nullptr) {
+    ListeDoubleT<T> liste;
+    liste.tete = nullptr;
+    liste.queue = nullptr;
+    liste.taille = 0;
+    liste.estAllouee = false;
+    liste.ressource = ressource;
+    return liste;
+}
+
+/**
+ * @brief Libère tous les nœuds ; la liste reste utilisable
+ */
+template <typename T>
+void Nettoyer(ListeDoubleT<T>* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    NoeudDT<T>* courant = liste->tete;
+    while (courant != nullptr) {
+        NoeudDT<T>* suivant = courant->suivant;
+        LibererNoeudT(liste->ressource, courant);
+        courant = suivant;
+    }
+    liste->tete = nullptr;
+    liste->queue = nullptr;
+    liste->taille = 0;
+}
+
+/**
+ * @brief Libère les nœuds puis la structure si elle vient d'AllocateDoubleT
+ */
+template <typename T>
+void Detruire(ListeDoubleT<T>* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    Nettoyer(liste);
+    if (liste->estAllouee) {
+        free(liste);
+    }
+}
+
+// ============================================================================
+// LISTE DOUBLE GÉNÉRIQUE : INSERTION
+// ============================================================================
+
+/**
+ * @brief Relie un nœud isolé après precedent (en tête si precedent est NULL)
+ */
+template <typename T>
+void LierApresT(ListeDoubleT<T>* liste, NoeudDT<T>* precedent, NoeudDT<T>* nouveau) {
+    NoeudDT<T>* suivant = (precedent != nullptr) ? precedent->suivant : liste->tete;
+    nouveau->precedent = precedent;
+    nouveau->suivant = suivant;
+    if (precedent != nullptr) {
+        precedent->suivant = nouveau;
+    } else {
+        liste->tete = nouveau;
+    }
+    if (suivant != nullptr) {
+        suivant->precedent = nouveau;
+    } else {
+        liste->queue = nouveau;
+    }
+    liste->taille++;
+}
+
+/**
+ * @brief Construit un élément sur place en tête de liste
+ * @return Nœud créé, ou NULL en cas d'échec
+ */
+template <typename T, typename... Arguments>
+NoeudDT<T>* EmplacerDebut(ListeDoubleT<T>* liste, Arguments&&... arguments) {
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    NoeudDT<T>* nouveau = ConstruireNoeudT<NoeudDT<T>>(liste->ressource, std::forward<Arguments>(arguments)...);
+    if (nouveau != nullptr) {
+        LierApresT(liste, (NoeudDT<T>*)nullptr, nouveau);
+    }
+    return nouveau;
+}
+
+/**
+ * @brief Construit un élément sur place en fin de liste
+ * @return Nœud créé, ou NULL en cas d'échec
+ */
+template <typename T, typename... Arguments>
+NoeudDT<T>* EmplacerFin(ListeDoubleT<T>* liste, Arguments&&... arguments) {
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    NoeudDT<T>* nouveau = ConstruireNoeudT<NoeudDT<T>>(liste->ressource, std::forward<Arguments>(arguments)...);
+    if (nouveau != nullptr) {
+        LierApresT(liste, liste->queue, nouveau);
+    }
+    return nouveau;
+}
+
+/**
+ * @brief Construit un élément sur place après un nœud
+ * @return Nœud créé, ou NULL en cas d'échec
+ */
+template <typename T, typename... Arguments>
+NoeudDT<T>* EmplacerApres(ListeDoubleT<T>* liste, NoeudDT<T>* precedent, Arguments&&... arguments) {
+    if (liste == nullptr || precedent == nullptr) {
+        return nullptr;
+    }
+    NoeudDT<T>* nouveau = ConstruireNoeudT<NoeudDT<T>>(liste->ressource, std::forward<Arguments>(arguments)...);
+    if (nouveau != nullptr) {
+        LierApresT(liste, precedent, nouveau);
+    }
+    return nouveau;
+}
+
+/**
+ * @brief Construit un élément sur place avant un nœud
+ * @return Nœud créé, ou NULL en cas d'échec
+ */
+template <typename T, typename... Arguments>
+NoeudDT<T>* EmplacerAvant(ListeDoubleT<T>* liste, NoeudDT<T>* suivant, Arguments&&... arguments) {
+    if (liste == nullptr || suivant == nullptr) {
+        return nullptr;
+    }
+    NoeudDT<T>* nouveau = ConstruireNoeudT<NoeudDT<T>>(liste->ressource, std::forward<Arguments>(arguments)...);
+    if (nouveau != nullptr) {
+        LierApresT(liste, suivant->precedent, nouveau);
+    }
+    return nouveau;
+}
+
+/**
+ * @brief Insère une valeur en tête (copiée ou déplacée selon l'argument)
+ * @return true si l'insertion a réussi
+ */
+template <typename T, typename U>
+bool InsererDebut(ListeDoubleT<T>* liste, U&& valeur) {
+    return EmplacerDebut(liste, std::forward<U>(valeur)) != nullptr;
+}
+
+/**
+ * @brief Insère une valeur en fin (copiée ou déplacée selon l'argument)
+ * @return true si l'insertion a réussi
+ */
+template <typename T, typename U>
+bool InsererFin(ListeDoubleT<T>* liste, U&& valeur) {
+    return EmplacerFin(liste, std::forward<U>(valeur)) != nullptr;
+}
+
+// ============================================================================
+// LISTE DOUBLE GÉNÉRIQUE : SUPPRESSION
+// ============================================================================
+
+/**
+ * @brief Retire un nœud en déplaçant sa donnée vers sortie, en O(1)
+ * @param cible Nœud appartenant à la liste
+ * @param sortie Destination de la donnée (NULL pour la détruire)
+ * @return true si le nœud a été retiré
+ */
+template <typename T>
+bool ExtraireNoeud(ListeDoubleT<T>* liste, NoeudDT<T>* cible, T* sortie) {
+    if (liste == nullptr || cible == nullptr || liste->taille == 0) {
+        return false;
+    }
+    if (cible->precedent != nullptr) {
+        cible->precedent->suivant = cible->suivant;
+    } else {
+        liste->tete = cible->suivant;
+    }
+    if (cible->suivant != nullptr) {
+        cible->suivant->precedent = cible->precedent;
+    } else {
+        liste->queue = cible->precedent;
+    }
+    liste->taille--;
+    if (sortie != nullptr) {
+        *sortie = std::move(cible->donnee);
+    }
+    LibererNoeudT(liste->ressource, cible);
+    return true;
+}
+
+template <typename T>
+bool SupprimerNoeud(ListeDoubleT<T>* liste, NoeudDT<T>* cible) {
+    return ExtraireNoeud(liste, cible, (T*)nullptr);
+}
+
+template <typename T>
+bool ExtraireDebut(ListeDoubleT<T>* liste, T* sortie) {
+    return liste != nullptr && ExtraireNoeud(liste, liste->tete, sortie);
+}
+
+template <typename T>
+bool ExtraireFin(ListeDoubleT<T>* liste, T* sortie) {
+    return liste != nullptr && ExtraireNoeud(liste, liste->queue, sortie);
+}
+
+template <typename T>
+bool SupprimerDebut(ListeDoubleT<T>* liste) {
+    return ExtraireDebut(liste, (T*)nullptr);
+}
+
+template <typename T>
+bool SupprimerFin(ListeDoubleT<T>* liste) {
+    return ExtraireFin(liste, (T*)nullptr);
+}
+
+// ============================================================================
+// LISTE DOUBLE GÉNÉRIQUE : RECHERCHE ET ACCÈS
+// ============================================================================
+
+/**
+ * @brief Recherche la première valeur égale (operator==)
+ * @return Nœud trouvé, ou NULL
+ */
+template <typename T, typename U>
+NoeudDT<T>* RechercherValeur(const ListeDoubleT<T>* liste, const U& valeur) {
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    for (NoeudDT<T>* courant = liste->tete; courant != nullptr; courant = courant->suivant) {
+        if (courant->donnee == valeur) {
+            return courant;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Nœud à une position donnée, atteint depuis l'extrémité la plus proche
+ * @return Nœud, ou NULL si la position est hors limites
+ */
+template <typename T>
+NoeudDT<T>* ObtenirNoeudPosition(const ListeDoubleT<T>* liste, int position) {
+    if (liste == nullptr || position < 0 || position >= liste->taille) {
+        return nullptr;
+    }
+    NoeudDT<T>* courant;
+    if (position < liste->taille / 2) {
+        courant = liste->tete;
+        for (int i = 0; i < position; i++) {
+            courant = courant->suivant;
+        }
+    } else {
+        courant = liste->queue;
+        for (int i = liste->taille - 1; i > position; i--) {
+            courant = courant->precedent;
+        }
+    }
+    return courant;
+}
+
+template <typename T>
+bool EstVide(const ListeDoubleT<T>* liste) {
+    return liste == nullptr || liste->taille == 0;
+}
+
+// ============================================================================
+// LISTE DOUBLE GÉNÉRIQUE : OPÉRATIONS SUR LA LISTE
+// ============================================================================
+
+/**
+ * @brief Inverse l'ordre des nœuds (aucune donnée déplacée)
+ */
+template <typename T>
+void Inverser(ListeDoubleT<T>* liste) {
+    if (liste == nullptr || liste->taille < 2) {
+        return;
+    }
+    NoeudDT<T>* courant = liste->tete;
+    while (courant != nullptr) {
+        NoeudDT<T>* suivant = courant->suivant;
+        courant->suivant = courant->precedent;
+        courant->precedent = suivant;
+        courant = suivant;
+    }
+    NoeudDT<T>* ancienneTete = liste->tete;
+    liste->tete = liste->queue;
+    liste->queue = ancienneTete;
+}
+
+/**
+ * @brief Copie profonde d'une liste double (T copiable) dans une ressource donnée
+ * @param ressource Provenance de la copie (NULL = malloc)
+ * @return Nouvelle liste allouée, ou NULL en cas d'échec
+ */
+template <typename T>
+ListeDoubleT<T>* Copier(const ListeDoubleT<T>* liste, std::pmr::memory_resource* ressource) {
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    ListeDoubleT<T>* copie = AllocateDoubleT<T>(ressource);
+    if (copie == nullptr) {
+        return nullptr;
+    }
+    for (const NoeudDT<T>* courant = liste->tete; courant != nullptr; courant = courant->suivant) {
+        NoeudDT<T>* nouveau = CopierNoeudT(ressource, courant);
+        if (nouveau == nullptr) {
+            Detruire(copie);
+            return nullptr;
+        }
+        LierApresT(copie, copie->queue, nouveau);
+    }
+    return copie;
+}
+
+/**
+ * @brief Copie profonde d'une liste double, dans la même ressource que l'original
+ * @return Nouvelle liste allouée, ou NULL en cas d'échec
+ */
+template <typename T>
+ListeDoubleT<T>* Copier(const ListeDoubleT<T>* liste) {
+    return liste != nullptr ? Copier(liste, liste->ressource) : nullptr;
+}
+
+/**
+ * @brief Déplace tous les nœuds de source à la fin de destination
+ * @return true si source a été vidée dans destination
+ * @note O(1) si les deux listes partagent leur ressource ; sinon les données
+ *       sont d'abord déplacées dans des nœuds de la ressource de destination
+ */
+template <typename T>
+bool Concatener(ListeDoubleT<T>* destination, ListeDoubleT<T>* source) {
+    if (destination == nullptr || source == nullptr || destination == source) {
+        return false;
+    }
+    if (source->tete == nullptr) {
+        return true;
+    }
+    if (!RelogerT(source, destination->ressource)) {
+        return false;
+    }
+    if (destination->queue == nullptr) {
+        destination->tete = source->tete;
+    } else {
+        destination->queue->suivant = source->tete;
+        source->tete->precedent = destination->queue;
+    }
+    destination->queue = source->queue;
+    destination->taille += source->taille;
+    source->tete = nullptr;
+    source->queue = nullptr;
+    source->taille = 0;
+    return true;
+}
+
+/**
+ * @brief Coupe la liste : les nœuds à partir de position passent dans liste2
+ * @param position Premier nœud de liste2 (entre 1 et taille - 1)
+ * @param liste2 Liste vide qui reçoit la seconde partie et la ressource de liste
+ */
+template <typename T>
+void Diviser(ListeDoubleT<T>* liste, int position, ListeDoubleT<T>* liste2) {
+    if (liste == nullptr || liste2 == nullptr || liste2->tete != nullptr ||
+        position < 1 || position >= liste->taille) {
+        return;
+    }
+    NoeudDT<T>* coupure = ObtenirNoeudPosition(liste, position);
+    liste2->tete = coupure;
+    liste2->queue = liste->queue;
+    liste2->taille = liste->taille - position;
+    liste2->ressource = liste->ressource;
+    liste->queue = coupure->precedent;
+    liste->queue->suivant = nullptr;
+    coupure->precedent = nullptr;
+    liste->taille = position;
+}
+
+/**
+ * @brief Fusionne deux listes triées en reliant leurs nœuds (stable)
+ * @param destination Liste triée qui reçoit le résultat
+ * @param source Liste triée vidée par l'opération
+ * @param inferieur Comparateur strict (a < b par défaut)
+ * @return true si la fusion a eu lieu
+ * @note Sans allocation si les deux listes partagent leur ressource
+ */
+template <typename T, typename Comparateur = std::less<T>>
+bool Fusionner(ListeDoubleT<T>* destination, ListeDoubleT<T>* source, Comparateur inferieur = Comparateur()) {
+    if (destination == nullptr || source == nullptr || destination == source) {
+        return false;
+    }
+    if (source->tete == nullptr) {
+        return true;
+    }
+    if (!RelogerT(source, destination->ressource)) {
+        return false;
+    }
+    NoeudDT<T>* a = destination->tete;
+    NoeudDT<T>* b = source->tete;
+    NoeudDT<T>* dernier = nullptr;
+    destination->tete = nullptr;
+    while (a != nullptr || b != nullptr) {
+        NoeudDT<T>* pris;
+        if (a == nullptr || (b != nullptr && inferieur(b->donnee, a->donnee))) {
+            pris = b;
+            b = b->suivant;
+        } else {
+            pris = a;
+            a = a->suivant;
+        }
+        pris->precedent = dernier;
+        if (dernier != nullptr) {
+            dernier->suivant = pris;
+        } else {
+            destination->tete = pris;
+        }
+        dernier = pris;
+    }
+    dernier->suivant = nullptr;
+    destination->queue = dernier;
+    destination->taille += source->taille;
+    source->tete = nullptr;
+    source->queue = nullptr;
+    source->taille = 0;
+    return true;
+}
+
+/**
+ * @brief Fusionne deux listes doubles triées dans une nouvelle liste (T copiable)
+ * @param inferieur Comparateur strict (a < b par défaut)
+ * @return Nouvelle liste allouée dans la ressource de liste1, ou NULL
+ */
+template <typename T, typename Comparateur = std::less<T>>
+ListeDoubleT<T>* FusionnerListesTriees(const ListeDoubleT<T>* liste1, const ListeDoubleT<T>* liste2,
+                                       Comparateur inferieur = Comparateur()) {
+    if (liste1 == nullptr || liste2 == nullptr) {
+        return nullptr;
+    }
+    ListeDoubleT<T>* resultat = Copier(liste1);
+    ListeDoubleT<T>* second = Copier(liste2, liste1->ressource);
+    bool fusionnee = resultat != nullptr && second != nullptr && Fusionner(resultat, second, inferieur);
+    Detruire(second);
+    if (!fusionnee) {
+        Detruire(resultat);
+        return nullptr;
+    }
+    return resultat;
+}
+
+// ============================================================================
+// BORNES DE PARCOURS (range-for, std::ranges)
+// ============================================================================
+
+template <typename T>
+IterateurChaineS<NoeudST<T>, false> begin(ListeSimpleT<T>& liste) {
+    return IterateurChaineS<NoeudST<T>, false>(liste.tete, 0, liste.taille);
+}
+
+template <typename T>
+IterateurChaineS<NoeudST<T>, false> end(ListeSimpleT<T>& liste) {
+    return IterateurChaineS<NoeudST<T>, false>(nullptr, liste.taille, liste.taille);
+}
+
+template <typename T>
+IterateurChaineS<NoeudST<T>, true> begin(const ListeSimpleT<T>& liste) {
+    return IterateurChaineS<NoeudST<T>, true>(liste.tete, 0, liste.taille);
+}
+
+template <typename T>
+IterateurChaineS<NoeudST<T>, true> end(const ListeSimpleT<T>& liste) {
+    return IterateurChaineS<NoeudST<T>, true>(nullptr, liste.taille, liste.taille);
+}
+
+template <typename T>
+IterateurChaineD<ListeDoubleT<T>, NoeudDT<T>, false> begin(ListeDoubleT<T>& liste) {
+    return IterateurChaineD<ListeDoubleT<T>, NoeudDT<T>, false>(&liste, liste.tete, 0);
+}
+
+template <typename T>
+IterateurChaineD<ListeDoubleT<T>, NoeudDT<T>, false> end(ListeDoubleT<T>& liste) {
+    return IterateurChaineD<ListeDoubleT<T>, NoeudDT<T>, false>(&liste, nullptr, liste.taille);
+}
+
+template <typename T>
+IterateurChaineD<ListeDoubleT<T>, NoeudDT<T>, true> begin(const ListeDoubleT<T>& liste) {
+    return IterateurChaineD<ListeDoubleT<T>, NoeudDT<T>, true>(&liste, liste.tete, 0);
+}
+
+template <typename T>
+IterateurChaineD<ListeDoubleT<T>, NoeudDT<T>, true> end(const ListeDoubleT<T>& liste) {
+    return IterateurChaineD<ListeDoubleT<T>, NoeudDT<T>, true>(&liste, nullptr, liste.taille);
+}
+
+#endif
@@ -0,0 +1,319 @@
+#include "ListImmuable.h"
+#include <cstdlib>
+#include <new>
+#include <string>
+
+// ============================================================================
+// GESTION DES RÉFÉRENCES
+// ============================================================================
+
+/**
+ * @brief Crée un nœud avec une référence ; le lien vers suivant est repris tel quel
+ */
+static NoeudI* CreerNoeudI(int valeur, const NoeudI* suivant) {
+    void* memoire = malloc(sizeof(NoeudI));
+    if (memoire == nullptr) {
+        return nullptr;
+    }
+    NoeudI* nouveau = new (memoire) NoeudI;
+    nouveau->donnee = valeur;
+    nouveau->references.store(1, std::memory_order_relaxed);
+    nouveau->suivant = suivant;
+    return nouveau;
+}
+
+static void Acquerir(const NoeudI* noeud) {
+    if (noeud != nullptr) {
+        const_cast<NoeudI*>(noeud)->references.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Abandonne une référence ; boucle plutôt que récursion sur les chaînes longues
+ */
+static void Relacher(const NoeudI* noeud) {
+    while (noeud != nullptr
+           && const_cast<NoeudI*>(noeud)->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        const NoeudI* suivant = noeud->suivant;
+        free(const_cast<NoeudI*>(noeud));
+        noeud = suivant;
+    }
+}
+
+static void Affecter(const ListeImmuable* source, ListeImmuable* resultat, ListeImmuable nouvelle) {
+    if (resultat == source) {
+        Liberer(resultat);
+    }
+    *resultat = nouvelle;
+}
+
+/**
+ * @brief Recopie les nœuds 0..longueur-1 de source ; dernier reçoit la fin de la copie
+ * @return Tête de la copie (NULL si longueur vaut 0 ou en cas d'échec)
+ */
+static NoeudI* CopierPrefixe(const NoeudI* source, int longueur, NoeudI** dernier, bool* echec) {
+    NoeudI* tete = nullptr;
+    *dernier = nullptr;
+    *echec = false;
+
+    for (int i = 0; i < longueur; i++) {
+        NoeudI* copie = CreerNoeudI(source->donnee, nullptr);
+        if (copie == nullptr) {
+            Relacher(tete);
+            *echec = true;
+            return nullptr;
+        }
+        if (*dernier == nullptr) {
+            tete = copie;
+        } else {
+            (*dernier)->suivant = copie;
+        }
+        *dernier = copie;
+        source = source->suivant;
+    }
+
+    return tete;
+}
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+ListeImmuable CreerImmuable() {
+    ListeImmuable liste;
+    liste.tete = nullptr;
+    liste.taille = 0;
+    return liste;
+}
+
+ListeImmuable Instantane(const ListeImmuable* liste) {
+    if (liste == nullptr) {
+        return CreerImmuable();
+    }
+
+    Acquerir(liste->tete);
+    return *liste;
+}
+
+void Liberer(ListeImmuable* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+
+    Relacher(liste->tete);
+    liste->tete = nullptr;
+    liste->taille = 0;
+}
+
+bool ConvertirEnImmuable(const ListeSimple* source, ListeImmuable* resultat) {
+    if (source == nullptr || resultat == nullptr) {
+        return false;
+    }
+
+    ListeImmuable nouvelle = CreerImmuable();
+    NoeudI* dernier = nullptr;
+    NoeudS* courant = source->tete;
+
+    for (int i = 0; i < source->taille && courant != nullptr; i++) {
+        NoeudI* copie = CreerNoeudI(courant->donnee, nullptr);
+        if (copie == nullptr) {
+            Liberer(&nouvelle);
+            return false;
+        }
+        if (dernier == nullptr) {
+            nouvelle.tete = copie;
+        } else {
+            dernier->suivant = copie;
+        }
+        dernier = copie;
+        nouvelle.taille++;
+        courant = courant->suivant;
+    }
+
+    *resultat = nouvelle;
+    return true;
+}
+
+ListeSimple* ConvertirEnSimple(const ListeImmuable* source) {
+    if (source == nullptr) {
+        return nullptr;
+    }
+
+    ListeSimple* resultat = AllocateSimple();
+    if (resultat == nullptr) {
+        return nullptr;
+    }
+
+    for (const NoeudI* courant = source->tete; courant != nullptr; courant = courant->suivant) {
+        // InsererFin ne signale pas l'échec d'allocation : si la taille n'a pas
+        // augmenté, le nœud n'a pas pu être créé et la copie est abandonnée
+        int taille = resultat->taille;
+        InsererFin(resultat, courant->donnee);
+        if (resultat->taille == taille) {
+            Detruire(resultat);
+            return nullptr;
+        }
+    }
+
+    return resultat;
+}
+
+// ============================================================================
+// FONCTIONS DE CONSTRUCTION DE VERSIONS
+// ============================================================================
+
+bool Prefixer(const ListeImmuable* source, int valeur, ListeImmuable* resultat) {
+    if (source == nullptr || resultat == nullptr) {
+        return false;
+    }
+
+    NoeudI* nouveau = CreerNoeudI(valeur, source->tete);
+    if (nouveau == nullptr) {
+        return false;
+    }
+    Acquerir(source->tete);
+
+    ListeImmuable nouvelle;
+    nouvelle.tete = nouveau;
+    nouvelle.taille = source->taille + 1;
+    Affecter(source, resultat, nouvelle);
+    return true;
+}
+
+bool Reste(const ListeImmuable* source, ListeImmuable* resultat) {
+    if (source == nullptr || resultat == nullptr || EstVide(source)) {
+        return false;
+    }
+
+    ListeImmuable nouvelle;
+    nouvelle.tete = source->tete->suivant;
+    nouvelle.taille = source->taille - 1;
+    Acquerir(nouvelle.tete);
+    Affecter(source, resultat, nouvelle);
+    return true;
+}
+
+bool InsererPosition(const ListeImmuable* source, int position, int valeur, ListeImmuable* resultat) {
+    if (source == nullptr || resultat == nullptr || position < 0 || position > source->taille) {
+        return false;
+    }
+
+    // Le suffixe à partir de position est partagé, seul le préfixe est recopié
+    const NoeudI* suffixe = source->tete;
+    for (int i = 0; i < position; i++) {
+        suffixe = suffixe->suivant;
+    }
+
+    NoeudI* dernier = nullptr;
+    bool echec = false;
+    NoeudI* prefixe = CopierPrefixe(source->tete, position, &dernier, &echec);
+    if (echec) {
+        return false;
+    }
+
+    NoeudI* nouveau = CreerNoeudI(valeur, suffixe);
+    if (nouveau == nullptr) {
+        Relacher(prefixe);
+        return false;
+    }
+    Acquerir(suffixe);
+
+    ListeImmuable nouvelle;
+    if (dernier == nullptr) {
+        nouvelle.tete = nouveau;
+    } else {
+        dernier->suivant = nouveau;
+        nouvelle.tete = prefixe;
+    }
+    nouvelle.taille = source->taille + 1;
+    Affecter(source, resultat, nouvelle);
+    return true;
+}
+
+bool SupprimerPosition(const ListeImmuable* source, int position, ListeImmuable* resultat) {
+    if (source == nullptr || resultat == nullptr || position < 0 || position >= source->taille) {
+        return false;
+    }
+
+    const NoeudI* cible = source->tete;
+    for (int i = 0; i < position; i++) {
+        cible = cible->suivant;
+    }
+    const NoeudI* suffixe = cible->suivant;
+
+    NoeudI* dernier = nullptr;
+    bool echec = false;
+    NoeudI* prefixe = CopierPrefixe(source->tete, position, &dernier, &echec);
+    if (echec) {
+        return false;
+    }
+    Acquerir(suffixe);
+
+    ListeImmuable nouvelle;
+    if (dernier == nullptr) {
+        nouvelle.tete = suffixe;
+    } else {
+        dernier->suivant = suffixe;
+        nouvelle.tete = prefixe;
+    }
+    nouvelle.taille = source->taille - 1;
+    Affecter(source, resultat, nouvelle);
+    return true;
+}
+
+// ============================================================================
+// FONCTIONS DE RECHERCHE ET D'INFORMATION
+// ============================================================================
+
+bool Premier(const ListeImmuable* liste, int* valeur) {
+    if (liste == nullptr || valeur == nullptr || EstVide(liste)) {
+        return false;
+    }
+
+    *valeur = liste->tete->donnee;
+    return true;
+}
+
+int RechercherValeur(const ListeImmuable* liste, int valeur) {
+    if (liste == nullptr) {
+        return -1;
+    }
+
+    int position = 0;
+    for (const NoeudI* courant = liste->tete; courant != nullptr; courant = courant->suivant) {
+        if (courant->donnee == valeur) {
+            return position;
+        }
+        position++;
+    }
+
+    return -1;
+}
+
+std::string ToString(const ListeImmuable* liste) {
+    if (liste == nullptr) {
+        return "ListeImmuable[NULL]";
+    }
+
+    std::string resultat = "ListeImmuable[";
+    for (const NoeudI* courant = liste->tete; courant != nullptr; courant = courant->suivant) {
+        if (courant != liste->tete) {
+            resultat += " -> ";
+        }
+        resultat += "Noeud(" + std::to_string(courant->donnee) + ")";
+    }
+    resultat += "]";
+
+    return resultat;
+}
+
+int CompterElements(const ListeImmuable* liste) {
+    if (liste == nullptr) {
+        return 0;
+    }
+    return liste->taille;
+}
+
+bool EstVide(const ListeImmuable* liste) {
+    return liste == nullptr || liste->tete == nullptr || liste->taille == 0;
+}
@@ -0,0 +1,151 @@
+#ifndef LISTE_IMMUABLE_H
+#define LISTE_IMMUABLE_H
+
+#include "ListS.h"
+#include <atomic>
+#include <string>
+
+/**
+ * @brief Structure représentant un nœud immuable partagé entre versions
+ *
+ * Un nœud n'est plus jamais modifié après sa création : plusieurs versions
+ * (et plusieurs threads) peuvent donc partager le même suffixe sans verrou.
+ */
+typedef struct NoeudI {
+    int donnee;                         /**< Donnée stockée dans le nœud */
+    std::atomic<int> references;        /**< Nombre de liens entrants (versions ou nœuds) */
+    const struct NoeudI* suivant;       /**< Pointeur vers le nœud suivant */
+} NoeudI;
+
+/**
+ * @brief Poignée vers une version d'une liste immuable
+ *
+ * Chaque poignée possède une référence sur sa tête : elle doit être rendue
+ * avec Liberer. Les fonctions qui produisent une version écrivent dans
+ * resultat ; si resultat est la source, l'ancienne version est relâchée.
+ */
+typedef struct {
+    const NoeudI* tete;     /**< Premier nœud de cette version */
+    int taille;             /**< Nombre d'éléments de cette version */
+} ListeImmuable;
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+/**
+ * @brief Crée une liste immuable vide
+ * @return Version vide (aucune allocation)
+ */
+ListeImmuable CreerImmuable();
+
+/**
+ * @brief Prend un instantané d'une version en O(1)
+ * @param liste Version source
+ * @return Nouvelle poignée partageant tous les nœuds de la source
+ */
+ListeImmuable Instantane(const ListeImmuable* liste);
+
+/**
+ * @brief Rend la référence d'une version ; les chaînes orphelines sont libérées sans récursion
+ * @param liste Poignée à libérer (remise à vide)
+ */
+void Liberer(ListeImmuable* liste);
+
+/**
+ * @brief Construit une version immuable à partir d'une liste simple (O(n))
+ * @param source Liste simple à convertir
+ * @param resultat Poignée qui reçoit la nouvelle version
+ * @return true si la conversion a réussi, false sinon
+ */
+bool ConvertirEnImmuable(const ListeSimple* source, ListeImmuable* resultat);
+
+/**
+ * @brief Construit une liste simple indépendante à partir d'une version
+ * @param source Version à convertir
+ * @return Nouvelle liste simple, ou NULL en cas d'échec
+ */
+ListeSimple* ConvertirEnSimple(const ListeImmuable* source);
+
+// ============================================================================
+// FONCTIONS DE CONSTRUCTION DE VERSIONS
+// ============================================================================
+
+/**
+ * @brief Produit la version source précédée de valeur (cons, O(1))
+ * @param source Version de départ
+ * @param valeur Valeur à ajouter en tête
+ * @param resultat Poignée qui reçoit la nouvelle version
+ * @return true si la création a réussi, false sinon
+ */
+bool Prefixer(const ListeImmuable* source, int valeur, ListeImmuable* resultat);
+
+/**
+ * @brief Produit la version source privée de son premier élément (O(1))
+ * @param source Version de départ (non vide)
+ * @param resultat Poignée qui reçoit la nouvelle version
+ * @return true si la création a réussi, false si la source est vide
+ */
+bool Reste(const ListeImmuable* source, ListeImmuable* resultat);
+
+/**
+ * @brief Produit une version avec valeur insérée à une position (copie du préfixe)
+ * @param source Version de départ
+ * @param position Position d'insertion (0-based)
+ * @param valeur Valeur à insérer
+ * @param resultat Poignée qui reçoit la nouvelle version
+ * @return true si la création a réussi, false si position invalide
+ */
+bool InsererPosition(const ListeImmuable* source, int position, int valeur, ListeImmuable* resultat);
+
+/**
+ * @brief Produit une version sans l'élément d'une position (copie du préfixe)
+ * @param source Version de départ
+ * @param position Position à retirer (0-based)
+ * @param resultat Poignée qui reçoit la nouvelle version
+ * @return true si la création a réussi, false si position invalide
+ */
+bool SupprimerPosition(const ListeImmuable* source, int position, ListeImmuable* resultat);
+
+// ============================================================================
+// FONCTIONS DE RECHERCHE ET D'INFORMATION
+// ============================================================================
+
+/**
+ * @brief Lit le premier élément d'une version
+ * @param liste Version à lire
+ * @param valeur Pointeur pour stocker la valeur
+ * @return true si la version n'est pas vide, false sinon
+ */
+bool Premier(const ListeImmuable* liste, int* valeur);
+
+/**
+ * @brief Recherche la première occurrence d'une valeur
+ * @param liste Version à parcourir
+ * @param valeur Valeur à rechercher
+ * @return Position de la valeur (0-based), ou -1 si non trouvée
+ */
+int RechercherValeur(const ListeImmuable* liste, int valeur);
+
+/**
+ * @brief Convertit une version en représentation string
+ * @param liste Version à convertir
+ * @return Représentation string de la version
+ */
+std::string ToString(const ListeImmuable* liste);
+
+/**
+ * @brief Compte le nombre d'éléments d'une version
+ * @param liste Version à compter
+ * @return Nombre d'éléments
+ */
+int CompterElements(const ListeImmuable* liste);
+
+/**
+ * @brief Vérifie si une version est vide
+ * @param liste Version à tester
+ * @return true si la version est vide, false sinon
+ */
+bool EstVide(const ListeImmuable* liste);
+
+#endif
@@ -0,0 +1,740 @@
+#ifndef LISTE_INTRUSIVE_H
+#define LISTE_INTRUSIVE_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+/**
+ * Listes intrusives : l'objet de l'utilisateur embarque lui-même ses liens
+ * (un CrochetS ou un CrochetD par liste à laquelle il peut appartenir). Les
+ * opérations relient directement les objets : aucune allocation, aucun
+ * entier intermédiaire. La liste ne possède pas les objets et ne les libère
+ * jamais ; un objet ne doit pas être détruit tant qu'il est lié.
+ *
+ *     struct Tache {
+ *         int priorite;
+ *         CrochetD<Tache> lien;
+ *     };
+ *     ListeIntrusiveD<Tache, &Tache::lien> file;
+ *     Initialiser(&file);
+ *     InsererFin(&file, &tache);
+ */
+
+/**
+ * @brief Crochet de liste simple à embarquer dans un objet
+ */
+template <typename T>
+struct CrochetS {
+    T* suivant = nullptr;     /**< Objet suivant dans la liste */
+};
+
+/**
+ * @brief Crochet de liste double à embarquer dans un objet
+ */
+template <typename T>
+struct CrochetD {
+    T* precedent = nullptr;   /**< Objet précédent dans la liste */
+    T* suivant = nullptr;     /**< Objet suivant dans la liste */
+};
+
+/**
+ * @brief Liste simplement chaînée intrusive
+ * @tparam T Type des objets
+ * @tparam Crochet Membre de T portant les liens de cette liste
+ */
+template <typename T, CrochetS<T> T::*Crochet>
+struct ListeIntrusiveS {
+    T* tete;                  /**< Premier objet */
+    T* queue;                 /**< Dernier objet */
+    int taille;               /**< Nombre d'objets liés */
+};
+
+/**
+ * @brief Liste doublement chaînée intrusive
+ * @tparam T Type des objets
+ * @tparam Crochet Membre de T portant les liens de cette liste
+ */
+template <typename T, CrochetD<T> T::*Crochet>
+struct ListeIntrusiveD {
+    T* tete;                  /**< Premier objet */
+    T* queue;                 /**< Dernier objet */
+    int taille;               /**< Nombre d'objets liés */
+};
+
+// ============================================================================
+// ITÉRATEURS
+// ============================================================================
+
+/**
+ * @brief Itérateur avant sur les objets d'une liste intrusive simple
+ * @note Retirer l'objet courant invalide l'itérateur : lire le suivant avant
+ */
+template <typename T, CrochetS<T> T::*Crochet>
+class IterateurIntrusifS {
+public:
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    IterateurIntrusifS() = default;
+    explicit IterateurIntrusifS(T* objet) : objet_(objet) {}
+
+    T& operator*() const { return *objet_; }
+    T* operator->() const { return objet_; }
+
+    IterateurIntrusifS& operator++() {
+        objet_ = (objet_->*Crochet).suivant;
+        return *this;
+    }
+
+    IterateurIntrusifS operator++(int) {
+        IterateurIntrusifS copie = *this;
+        ++*this;
+        return copie;
+    }
+
+    friend bool operator==(const IterateurIntrusifS& a, const IterateurIntrusifS& b) {
+        return a.objet_ == b.objet_;
+    }
+
+private:
+    T* objet_ = nullptr;
+};
+
+/**
+ * @brief Itérateur bidirectionnel sur les objets d'une liste intrusive double
+ */
+template <typename T, CrochetD<T> T::*Crochet>
+class IterateurIntrusifD {
+public:
+    using iterator_concept = std::bidirectional_iterator_tag;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    IterateurIntrusifD() = default;
+    IterateurIntrusifD(const ListeIntrusiveD<T, Crochet>* liste, T* objet) : liste_(liste), objet_(objet) {}
+
+    T& operator*() const { return *objet_; }
+    T* operator->() const { return objet_; }
+
+    IterateurIntrusifD& operator++() {
+        objet_ = (objet_->*Crochet).suivant;
+        return *this;
+    }
+
+    IterateurIntrusifD operator++(int) {
+        IterateurIntrusifD copie = *this;
+        ++*this;
+        return copie;
+    }
+
+    IterateurIntrusifD& operator--() {
+        objet_ = (objet_ == nullptr) ? liste_->queue : (objet_->*Crochet).precedent;
+        return *this;
+    }
+
+    IterateurIntrusifD operator--(int) {
+        IterateurIntrusifD copie = *this;
+        --*this;
+        return copie;
+    }
+
+    friend bool operator==(const IterateurIntrusifD& a, const IterateurIntrusifD& b) {
+        return a.objet_ == b.objet_;
+    }
+
+private:
+    const ListeIntrusiveD<T, Crochet>* liste_ = nullptr;
+    T* objet_ = nullptr;
+};
+
+// Les objets restent modifiables à travers une liste constante : seule la
+// chaîne est protégée. Les deux surcharges sont nécessaires pour std::ranges.
+
+template <typename T, CrochetS<T> T::*Crochet>
+IterateurIntrusifS<T, Crochet> begin(const ListeIntrusiveS<T, Crochet>& liste) {
+    return IterateurIntrusifS<T, Crochet>(liste.tete);
+}
+
+template <typename T, CrochetS<T> T::*Crochet>
+IterateurIntrusifS<T, Crochet> end(const ListeIntrusiveS<T, Crochet>&) {
+    return IterateurIntrusifS<T, Crochet>(nullptr);
+}
+
+template <typename T, CrochetS<T> T::*Crochet>
+IterateurIntrusifS<T, Crochet> begin(ListeIntrusiveS<T, Crochet>& liste) {
+    return IterateurIntrusifS<T, Crochet>(liste.tete);
+}
+
+template <typename T, CrochetS<T> T::*Crochet>
+IterateurIntrusifS<T, Crochet> end(ListeIntrusiveS<T, Crochet>&) {
+    return IterateurIntrusifS<T, Crochet>(nullptr);
+}
+
+template <typename T, CrochetD<T> T::*Crochet>
+IterateurIntrusifD<T, Crochet> begin(const ListeIntrusiveD<T, Crochet>& liste) {
+    return IterateurIntrusifD<T, Crochet>(&liste, liste.tete);
+}
+
+template <typename T, CrochetD<T> T::*Crochet>
+IterateurIntrusifD<T, Crochet> end(const ListeIntrusiveD<T, Crochet>& liste) {
+    return IterateurIntrusifD<T, Crochet>(&liste, nullptr);
+}
+
+template <typename T, CrochetD<T> T::*Crochet>
+IterateurIntrusifD<T, Crochet> begin(ListeIntrusiveD<T, Crochet>& liste) {
+    return IterateurIntrusifD<T, Crochet>(&liste, liste.tete);
+}
+
+template <typename T, CrochetD<T> T::*Crochet>
+IterateurIntrusifD<T, Crochet> end(ListeIntrusiveD<T, Crochet>& liste) {
+    return IterateurIntrusifD<T, Crochet>(&liste, nullptr);
+}
+
+// ============================================================================
+// LISTE INTRUSIVE SIMPLE
+// ============================================================================
+
+/**
+ * @brief Initialise une liste vide (les objets précédemment liés sont ignorés)
+ */
+template <typename T, CrochetS<T> T::*Crochet>
+void Initialiser(ListeIntrusiveS<T, Crochet>* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    liste->tete = nullptr;
+    liste->queue = nullptr;
+    liste->taille = 0;
+}
+
+template <typename T, CrochetS<T> T::*Crochet>
+bool EstVide(const ListeIntrusiveS<T, Crochet>* liste) {
+    return liste == nullptr || liste->taille == 0;
+}
+
+/**
+ * @brief Lie un objet en tête
+ * @param objet Objet non lié à cette liste
+ */
+template <typename T, CrochetS<T> T::*Crochet>
+void InsererDebut(ListeIntrusiveS<T, Crochet>* liste, T* objet) {
+    if (liste == nullptr || objet == nullptr) {
+        return;
+    }
+    (objet->*Crochet).suivant = liste->tete;
+    liste->tete = objet;
+    if (liste->queue == nullptr) {
+        liste->queue = objet;
+    }
+    liste->taille++;
+}
+
+/**
+ * @brief Lie un objet en fin
+ * @param objet Objet non lié à cette liste
+ */
+template <typename T, CrochetS<T> T::*Crochet>
+void InsererFin(ListeIntrusiveS<T, Crochet>* liste, T* objet) {
+    if (liste == nullptr || objet == nullptr) {
+        return;
+    }
+    (objet->*Crochet).suivant = nullptr;
+    if (liste->queue == nullptr) {
+        liste->tete = objet;
+    } else {
+        (liste->queue->*Crochet).suivant = objet;
+    }
+    liste->queue = objet;
+    liste->taille++;
+}
+
+/**
+ * @brief Lie un objet juste après un autre
+ * @param precedent Objet lié à la liste (NULL = en tête)
+ * @param objet Objet non lié à cette liste
+ */
+template <typename T, CrochetS<T> T::*Crochet>
+bool InsererApres(ListeIntrusiveS<T, Crochet>* liste, T* precedent, T* objet) {
+    if (liste == nullptr || objet == nullptr) {
+        return false;
+    }
+    if (precedent == nullptr) {
+        InsererDebut(liste, objet);
+        return true;
+    }
+    (objet->*Crochet).suivant = (precedent->*Crochet).suivant;
+    (precedent->*Crochet).suivant = objet;
+    if (liste->queue == precedent) {
+        liste->queue = objet;
+    }
+    liste->taille++;
+    return true;
+}
+
+/**
+ * @brief Objet qui précède cible (recherche linéaire)
+ * @return Objet précédent, ou NULL si cible est la tête ou absente
+ */
+template <typename T, CrochetS<T> T::*Crochet>
+T* TrouverPrecedent(const ListeIntrusiveS<T, Crochet>* liste, const T* cible) {
+    if (liste == nullptr || cible == nullptr) {
+        return nullptr;
+    }
+    for (T* courant = liste->tete; courant != nullptr; courant = (courant->*Crochet).suivant) {
+        if ((courant->*Crochet).suivant == cible) {
+            return courant;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Lie un objet juste avant un autre (O(n) : recherche du précédent)
+ * @param suivant Objet lié à la liste
+ * @param objet Objet non lié à cette liste
+ * @return false si suivant n'appartient pas à la liste
+ */
+template <typename T, CrochetS<T> T::*Crochet>
+bool InsererAvant(ListeIntrusiveS<T, Crochet>* liste, T* suivant, T* objet) {
+    if (liste == nullptr || suivant == nullptr || objet == nullptr) {
+        return false;
+    }
+    if (suivant == liste->tete) {
+        InsererDebut(liste, objet);
+        return true;
+    }
+    T* precedent = TrouverPrecedent(liste, suivant);
+    return precedent != nullptr && InsererApres(liste, precedent, objet);
+}
+
+/**
+ * @brief Délie l'objet qui suit precedent, en O(1)
+ * @param precedent Objet lié (NULL = délier la tête)
+ * @return Objet délié, ou NULL
+ */
+template <typename T, CrochetS<T> T::*Crochet>
+T* RetirerApres(ListeIntrusiveS<T, Crochet>* liste, T* precedent) {
+    if (liste == nullptr || liste->tete == nullptr) {
+        return nullptr;
+    }
+    T* cible = (precedent == nullptr) ? liste->tete : (precedent->*Crochet).suivant;
+    if (cible == nullptr) {
+        return nullptr;
+    }
+    if (precedent == nullptr) {
+        liste->tete = (cible->*Crochet).suivant;
+    } else {
+        (precedent->*Crochet).suivant = (cible->*Crochet).suivant;
+    }
+    if (liste->queue == cible) {
+        liste->queue = precedent;
+    }
+    (cible->*Crochet).suivant = nullptr;
+    liste->taille--;
+    return cible;
+}
+
+/**
+ * @brief Délie la tête
+ * @return Objet délié, ou NULL si la liste est vide
+ */
+template <typename T, CrochetS<T> T::*Crochet>
+T* RetirerDebut(ListeIntrusiveS<T, Crochet>* liste) {
+    return RetirerApres(liste, (T*)nullptr);
+}
+
+/**
+ * @brief Délie un objet désigné par pointeur (O(n) : recherche du précédent)
+ * @return true si l'objet était lié à la liste
+ */
+template <typename T, CrochetS<T> T::*Crochet>
+bool Retirer(ListeIntrusiveS<T, Crochet>* liste, T* objet) {
+    if (liste == nullptr || objet == nullptr || liste->tete == nullptr) {
+        return false;
+    }
+    if (objet == liste->tete) {
+        return RetirerDebut(liste) != nullptr;
+    }
+    T* precedent = TrouverPrecedent(liste, objet);
+    return precedent != nullptr && RetirerApres(liste, precedent) != nullptr;
+}
+
+/**
+ * @brief Objet à une position (0 = tête)
+ * @return Objet, ou NULL si la position est hors limites
+ */
+template <typename T, CrochetS<T> T::*Crochet>
+T* ObtenirPosition(const ListeIntrusiveS<T, Crochet>* liste, int position) {
+    if (liste == nullptr || position < 0 || position >= liste->taille) {
+        return nullptr;
+    }
+    T* courant = liste->tete;
+    for (int i = 0; i < position; i++) {
+        courant = (courant->*Crochet).suivant;
+    }
+    return courant;
+}
+
+/**
+ * @brief Inverse l'ordre des objets
+ */
+template <typename T, CrochetS<T> T::*Crochet>
+void Inverser(ListeIntrusiveS<T, Crochet>* liste) {
+    if (liste == nullptr || liste->taille < 2) {
+        return;
+    }
+    T* precedent = nullptr;
+    T* courant = liste->tete;
+    liste->queue = courant;
+    while (courant != nullptr) {
+        T* suivant = (courant->*Crochet).suivant;
+        (courant->*Crochet).suivant = precedent;
+        precedent = courant;
+        courant = suivant;
+    }
+    liste->tete = precedent;
+}
+
+/**
+ * @brief Trie une chaîne d'objets sur ses seuls liens suivant (usage interne)
+ *
+ * Fusion ascendante : à chaque passe, les séries de largeur objets sont
+ * fusionnées deux à deux en reliant les objets, sans allocation.
+ * @param tete Premier objet, mis à jour
+ * @param queue Dernier objet, mis à jour
+ * @param taille Nombre d'objets de la chaîne
+ */
+template <typename T, auto Crochet, typename Comparateur>
+void TrierChaineIntrusive(T** tete, T** queue, int taille, Comparateur& inferieur) {
+    for (int largeur = 1; largeur < taille; largeur *= 2) {
+        T* reste = *tete;
+        T* nouvelleTete = nullptr;
+        T* nouvelleQueue = nullptr;
+        while (reste != nullptr) {
+            // Détacher deux séries consécutives de largeur objets
+            T* gauche = reste;
+            T* fin = gauche;
+            for (int i = 1; i < largeur && (fin->*Crochet).suivant != nullptr; i++) {
+                fin = (fin->*Crochet).suivant;
+            }
+            T* droite = (fin->*Crochet).suivant;
+            (fin->*Crochet).suivant = nullptr;
+            reste = nullptr;
+            if (droite != nullptr) {
+                fin = droite;
+                for (int i = 1; i < largeur && (fin->*Crochet).suivant != nullptr; i++) {
+                    fin = (fin->*Crochet).suivant;
+                }
+                reste = (fin->*Crochet).suivant;
+                (fin->*Crochet).suivant = nullptr;
+            }
+
+            T* fusion = nullptr;
+            T** lien = &fusion;
+            while (gauche != nullptr && droite != nullptr) {
+                if (inferieur(*droite, *gauche)) {
+                    *lien = droite;
+                    droite = (droite->*Crochet).suivant;
+                } else {
+                    *lien = gauche;
+                    gauche = (gauche->*Crochet).suivant;
+                }
+                lien = &((*lien)->*Crochet).suivant;
+            }
+            *lien = (gauche != nullptr) ? gauche : droite;
+            T* dernier = fusion;
+            while ((dernier->*Crochet).suivant != nullptr) {
+                dernier = (dernier->*Crochet).suivant;
+            }
+
+            if (nouvelleQueue == nullptr) {
+                nouvelleTete = fusion;
+            } else {
+                (nouvelleQueue->*Crochet).suivant = fusion;
+            }
+            nouvelleQueue = dernier;
+        }
+        *tete = nouvelleTete;
+        *queue = nouvelleQueue;
+    }
+}
+
+/**
+ * @brief Trie les objets (fusion ascendante, stable, sans allocation)
+ * @param inferieur Comparateur strict : inferieur(a, b) vrai si a doit précéder b
+ */
+template <typename T, CrochetS<T> T::*Crochet, typename Comparateur>
+void Trier(ListeIntrusiveS<T, Crochet>* liste, Comparateur inferieur) {
+    if (liste == nullptr || liste->taille < 2) {
+        return;
+    }
+    TrierChaineIntrusive<T, Crochet>(&liste->tete, &liste->queue, liste->taille, inferieur);
+}
+
+/**
+ * @brief Déplace tous les objets de source à la fin de destination, en O(1)
+ */
+template <typename T, CrochetS<T> T::*Crochet>
+void Concatener(ListeIntrusiveS<T, Crochet>* destination, ListeIntrusiveS<T, Crochet>* source) {
+    if (destination == nullptr || source == nullptr || destination == source || source->tete == nullptr) {
+        return;
+    }
+    if (destination->queue == nullptr) {
+        destination->tete = source->tete;
+    } else {
+        (destination->queue->*Crochet).suivant = source->tete;
+    }
+    destination->queue = source->queue;
+    destination->taille += source->taille;
+    Initialiser(source);
+}
+
+/**
+ * @brief Coupe la liste : les objets à partir de position passent dans liste2
+ * @param position Premier objet de liste2 (entre 1 et taille - 1)
+ * @param liste2 Liste vide qui reçoit la seconde partie
+ */
+template <typename T, CrochetS<T> T::*Crochet>
+void Diviser(ListeIntrusiveS<T, Crochet>* liste, int position, ListeIntrusiveS<T, Crochet>* liste2) {
+    if (liste == nullptr || liste2 == nullptr || liste2->tete != nullptr ||
+        position < 1 || position >= liste->taille) {
+        return;
+    }
+    T* nouvelleQueue = ObtenirPosition(liste, position - 1);
+    liste2->tete = (nouvelleQueue->*Crochet).suivant;
+    liste2->queue = liste->queue;
+    liste2->taille = liste->taille - position;
+    (nouvelleQueue->*Crochet).suivant = nullptr;
+    liste->queue = nouvelleQueue;
+    liste->taille = position;
+}
+
+// ============================================================================
+// LISTE INTRUSIVE DOUBLE
+// ============================================================================
+
+/**
+ * @brief Initialise une liste vide (les objets précédemment liés sont ignorés)
+ */
+template <typename T, CrochetD<T> T::*Crochet>
+void Initialiser(ListeIntrusiveD<T, Crochet>* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    liste->tete = nullptr;
+    liste->queue = nullptr;
+    liste->taille = 0;
+}
+
+template <typename T, CrochetD<T> T::*Crochet>
+bool EstVide(const ListeIntrusiveD<T, Crochet>* liste) {
+    return liste == nullptr || liste->taille == 0;
+}
+
+/**
+ * @brief Lie un objet juste après un autre
+ * @param precedent Objet lié à la liste (NULL = en tête)
+ * @param objet Objet non lié à cette liste
+ */
+template <typename T, CrochetD<T> T::*Crochet>
+bool InsererApres(ListeIntrusiveD<T, Crochet>* liste, T* precedent, T* objet) {
+    if (liste == nullptr || objet == nullptr) {
+        return false;
+    }
+    T* suivant = (precedent != nullptr) ? (precedent->*Crochet).suivant : liste->tete;
+    (objet->*Crochet).precedent = precedent;
+    (objet->*Crochet).suivant = suivant;
+    if (precedent != nullptr) {
+        (precedent->*Crochet).suivant = objet;
+    } else {
+        liste->tete = objet;
+    }
+    if (suivant != nullptr) {
+        (suivant->*Crochet).precedent = objet;
+    } else {
+        liste->queue = objet;
+    }
+    liste->taille++;
+    return true;
+}
+
+/**
+ * @brief Lie un objet juste avant un autre, en O(1)
+ * @param suivant Objet lié à la liste (NULL = en fin)
+ * @param objet Objet non lié à cette liste
+ */
+template <typename T, CrochetD<T> T::*Crochet>
+bool InsererAvant(ListeIntrusiveD<T, Crochet>* liste, T* suivant, T* objet) {
+    if (liste == nullptr) {
+        return false;
+    }
+    T* precedent = (suivant != nullptr) ? (suivant->*Crochet).precedent : liste->queue;
+    return InsererApres(liste, precedent, objet);
+}
+
+template <typename T, CrochetD<T> T::*Crochet>
+void InsererDebut(ListeIntrusiveD<T, Crochet>* liste, T* objet) {
+    InsererApres(liste, (T*)nullptr, objet);
+}
+
+template <typename T, CrochetD<T> T::*Crochet>
+void InsererFin(ListeIntrusiveD<T, Crochet>* liste, T* objet) {
+    if (liste != nullptr) {
+        InsererApres(liste, liste->queue, objet);
+    }
+}
+
+/**
+ * @brief Délie un objet désigné par pointeur, en O(1)
+ * @param objet Objet lié à cette liste
+ * @return true si l'objet a été délié
+ */
+template <typename T, CrochetD<T> T::*Crochet>
+bool Retirer(ListeIntrusiveD<T, Crochet>* liste, T* objet) {
+    if (liste == nullptr || objet == nullptr || liste->taille == 0) {
+        return false;
+    }
+    CrochetD<T>& crochet = objet->*Crochet;
+    if (crochet.precedent != nullptr) {
+        (crochet.precedent->*Crochet).suivant = crochet.suivant;
+    } else {
+        liste->tete = crochet.suivant;
+    }
+    if (crochet.suivant != nullptr) {
+        (crochet.suivant->*Crochet).precedent = crochet.precedent;
+    } else {
+        liste->queue = crochet.precedent;
+    }
+    crochet.precedent = nullptr;
+    crochet.suivant = nullptr;
+    liste->taille--;
+    return true;
+}
+
+template <typename T, CrochetD<T> T::*Crochet>
+T* RetirerDebut(ListeIntrusiveD<T, Crochet>* liste) {
+    T* objet = (liste != nullptr) ? liste->tete : nullptr;
+    return Retirer(liste, objet) ? objet : nullptr;
+}
+
+template <typename T, CrochetD<T> T::*Crochet>
+T* RetirerFin(ListeIntrusiveD<T, Crochet>* liste) {
+    T* objet = (liste != nullptr) ? liste->queue : nullptr;
+    return Retirer(liste, objet) ? objet : nullptr;
+}
+
+/**
+ * @brief Objet à une position, atteint depuis l'extrémité la plus proche
+ * @return Objet, ou NULL si la position est hors limites
+ */
+template <typename T, CrochetD<T> T::*Crochet>
+T* ObtenirPosition(const ListeIntrusiveD<T, Crochet>* liste, int position) {
+    if (liste == nullptr || position < 0 || position >= liste->taille) {
+        return nullptr;
+    }
+    T* courant;
+    if (position < liste->taille / 2) {
+        courant = liste->tete;
+        for (int i = 0; i < position; i++) {
+            courant = (courant->*Crochet).suivant;
+        }
+    } else {
+        courant = liste->queue;
+        for (int i = liste->taille - 1; i > position; i--) {
+            courant = (courant->*Crochet).precedent;
+        }
+    }
+    return courant;
+}
+
+/**
+ * @brief Inverse l'ordre des objets
+ */
+template <typename T, CrochetD<T> T::*Crochet>
+void Inverser(ListeIntrusiveD<T, Crochet>* liste) {
+    if (liste == nullptr || liste->taille < 2) {
+        return;
+    }
+    T* courant = liste->tete;
+    while (courant != nullptr) {
+        CrochetD<T>& crochet = courant->*Crochet;
+        T* suivant = crochet.suivant;
+        crochet.suivant = crochet.precedent;
+        crochet.precedent = suivant;
+        courant = suivant;
+    }
+    T* ancienneTete = liste->tete;
+    liste->tete = liste->queue;
+    liste->queue = ancienneTete;
+}
+
+/**
+ * @brief Trie les objets (fusion ascendante, stable, sans allocation)
+ *
+ * Les liens suivant sont triés comme dans une liste simple, puis les liens
+ * precedent sont reconstruits en un passage.
+ * @param inferieur Comparateur strict : inferieur(a, b) vrai si a doit précéder b
+ */
+template <typename T, CrochetD<T> T::*Crochet, typename Comparateur>
+void Trier(ListeIntrusiveD<T, Crochet>* liste, Comparateur inferieur) {
+    if (liste == nullptr || liste->taille < 2) {
+        return;
+    }
+    TrierChaineIntrusive<T, Crochet>(&liste->tete, &liste->queue, liste->taille, inferieur);
+
+    T* precedent = nullptr;
+    for (T* courant = liste->tete; courant != nullptr; courant = (courant->*Crochet).suivant) {
+        (courant->*Crochet).precedent = precedent;
+        precedent = courant;
+    }
+}
+
+/**
+ * @brief Déplace tous les objets de source à la fin de destination, en O(1)
+ */
+template <typename T, CrochetD<T> T::*Crochet>
+void Concatener(ListeIntrusiveD<T, Crochet>* destination, ListeIntrusiveD<T, Crochet>* source) {
+    if (destination == nullptr || source == nullptr || destination == source || source->tete == nullptr) {
+        return;
+    }
+    if (destination->queue == nullptr) {
+        destination->tete = source->tete;
+    } else {
+        (destination->queue->*Crochet).suivant = source->tete;
+        (source->tete->*Crochet).precedent = destination->queue;
+    }
+    destination->queue = source->queue;
+    destination->taille += source->taille;
+    Initialiser(source);
+}
+
+/**
+ * @brief Coupe la liste : les objets à partir de position passent dans liste2
+ * @param position Premier objet de liste2 (entre 1 et taille - 1)
+ * @param liste2 Liste vide qui reçoit la seconde partie
+ */
+template <typename T, CrochetD<T> T::*Crochet>
+void Diviser(ListeIntrusiveD<T, Crochet>* liste, int position, ListeIntrusiveD<T, Crochet>* liste2) {
+    if (liste == nullptr || liste2 == nullptr || liste2->tete != nullptr ||
+        position < 1 || position >= liste->taille) {
+        return;
+    }
+    T* coupure = ObtenirPosition(liste, position);
+    liste2->tete = coupure;
+    liste2->queue = liste->queue;
+    liste2->taille = liste->taille - position;
+    liste->queue = (coupure->*Crochet).precedent;
+    (liste->queue->*Crochet).suivant = nullptr;
+    (coupure->*Crochet).precedent = nullptr;
+    liste->taille = position;
+}
+
+#endif
@@ -0,0 +1,198 @@
+#ifndef LISTE_ITERATEURS_H
+#define LISTE_ITERATEURS_H
+
+#include "ListD.h"
+#include "ListS.h"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+/**
+ * @brief Itérateur avant sur les valeurs d'une liste simple
+ *
+ * L'itérateur compte les positions : il s'arrête après taille éléments, donc
+ * après un seul tour sur une liste circulaire. Toute insertion ou suppression
+ * dans la liste invalide les itérateurs en cours ; modifier les valeurs non.
+ * @tparam TypeNoeud Type de nœud (champs donnee et suivant)
+ * @tparam Constant true pour un accès en lecture seule
+ */
+template <typename TypeNoeud, bool Constant>
+class IterateurChaineS {
+public:
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = decltype(TypeNoeud::donnee);
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Constant, const value_type*, value_type*>;
+    using reference = std::conditional_t<Constant, const value_type&, value_type&>;
+
+    IterateurChaineS() = default;
+
+    IterateurChaineS(TypeNoeud* noeud, int index, int taille)
+        : noeud_(noeud), index_(index), taille_(taille) {}
+
+    // Conversion d'un itérateur modifiable en itérateur constant
+    template <bool AutreConstant, typename = std::enable_if_t<Constant && !AutreConstant>>
+    IterateurChaineS(const IterateurChaineS<TypeNoeud, AutreConstant>& autre)
+        : noeud_(autre.Noeud()), index_(autre.Index()), taille_(autre.Taille()) {}
+
+    reference operator*() const { return noeud_->donnee; }
+    pointer operator->() const { return &noeud_->donnee; }
+
+    IterateurChaineS& operator++() {
+        index_++;
+        noeud_ = (index_ < taille_) ? noeud_->suivant : nullptr;
+        return *this;
+    }
+
+    IterateurChaineS operator++(int) {
+        IterateurChaineS copie = *this;
+        ++*this;
+        return copie;
+    }
+
+    // Deux itérateurs d'une même liste sont égaux s'ils sont à la même position
+    friend bool operator==(const IterateurChaineS& a, const IterateurChaineS& b) {
+        return a.index_ == b.index_;
+    }
+
+    /** @brief Nœud courant (NULL en fin de parcours) */
+    TypeNoeud* Noeud() const { return noeud_; }
+    /** @brief Position courante (taille en fin de parcours) */
+    int Index() const { return index_; }
+    int Taille() const { return taille_; }
+
+private:
+    TypeNoeud* noeud_ = nullptr;
+    int index_ = 0;
+    int taille_ = 0;
+};
+
+/**
+ * @brief Itérateur bidirectionnel sur les valeurs d'une liste double
+ *
+ * Suit le sens logique de la liste (estInversee respecté quand la liste en
+ * possède un) et s'arrête après un tour sur une liste circulaire.
+ * Décrémenter end() donne la queue.
+ * @tparam TypeListe Type de liste (champs tete, queue, taille)
+ * @tparam TypeNoeud Type de nœud (champs donnee, precedent et suivant)
+ * @tparam Constant true pour un accès en lecture seule
+ */
+template <typename TypeListe, typename TypeNoeud, bool Constant>
+class IterateurChaineD {
+public:
+    using iterator_concept = std::bidirectional_iterator_tag;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = decltype(TypeNoeud::donnee);
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Constant, const value_type*, value_type*>;
+    using reference = std::conditional_t<Constant, const value_type&, value_type&>;
+
+    IterateurChaineD() = default;
+
+    IterateurChaineD(const TypeListe* liste, TypeNoeud* noeud, int index)
+        : liste_(liste), noeud_(noeud), index_(index) {}
+
+    template <bool AutreConstant, typename = std::enable_if_t<Constant && !AutreConstant>>
+    IterateurChaineD(const IterateurChaineD<TypeListe, TypeNoeud, AutreConstant>& autre)
+        : liste_(autre.Liste()), noeud_(autre.Noeud()), index_(autre.Index()) {}
+
+    reference operator*() const { return noeud_->donnee; }
+    pointer operator->() const { return &noeud_->donnee; }
+
+    IterateurChaineD& operator++() {
+        index_++;
+        noeud_ = (index_ < liste_->taille) ? (EstInversee() ? noeud_->precedent : noeud_->suivant) : nullptr;
+        return *this;
+    }
+
+    IterateurChaineD operator++(int) {
+        IterateurChaineD copie = *this;
+        ++*this;
+        return copie;
+    }
+
+    IterateurChaineD& operator--() {
+        if (index_ == liste_->taille) {
+            noeud_ = liste_->queue;
+        } else {
+            noeud_ = EstInversee() ? noeud_->suivant : noeud_->precedent;
+        }
+        index_--;
+        return *this;
+    }
+
+    IterateurChaineD operator--(int) {
+        IterateurChaineD copie = *this;
+        --*this;
+        return copie;
+    }
+
+    friend bool operator==(const IterateurChaineD& a, const IterateurChaineD& b) {
+        return a.index_ == b.index_;
+    }
+
+    /** @brief Nœud courant (NULL en fin de parcours) */
+    TypeNoeud* Noeud() const { return noeud_; }
+    /** @brief Position courante dans le sens logique (taille en fin de parcours) */
+    int Index() const { return index_; }
+    const TypeListe* Liste() const { return liste_; }
+
+private:
+    bool EstInversee() const {
+        if constexpr (requires { liste_->estInversee; }) {
+            return liste_->estInversee;
+        } else {
+            return false;
+        }
+    }
+
+    const TypeListe* liste_ = nullptr;
+    TypeNoeud* noeud_ = nullptr;
+    int index_ = 0;
+};
+
+typedef IterateurChaineS<NoeudS, false> IterateurS;
+typedef IterateurChaineS<NoeudS, true> IterateurConstS;
+typedef IterateurChaineD<ListeDouble, NoeudD, false> IterateurD;
+typedef IterateurChaineD<ListeDouble, NoeudD, true> IterateurConstD;
+
+// ============================================================================
+// BORNES DE PARCOURS (trouvées par ADL : range-for, std::ranges)
+// ============================================================================
+
+inline IterateurS begin(ListeSimple& liste) {
+    return IterateurS(liste.tete, 0, liste.tete != nullptr ? liste.taille : 0);
+}
+
+inline IterateurS end(ListeSimple& liste) {
+    int taille = liste.tete != nullptr ? liste.taille : 0;
+    return IterateurS(nullptr, taille, taille);
+}
+
+inline IterateurConstS begin(const ListeSimple& liste) {
+    return IterateurConstS(liste.tete, 0, liste.tete != nullptr ? liste.taille : 0);
+}
+
+inline IterateurConstS end(const ListeSimple& liste) {
+    int taille = liste.tete != nullptr ? liste.taille : 0;
+    return IterateurConstS(nullptr, taille, taille);
+}
+
+inline IterateurD begin(ListeDouble& liste) {
+    return IterateurD(&liste, liste.taille > 0 ? liste.tete : nullptr, 0);
+}
+
+inline IterateurD end(ListeDouble& liste) {
+    return IterateurD(&liste, nullptr, liste.tete != nullptr ? liste.taille : 0);
+}
+
+inline IterateurConstD begin(const ListeDouble& liste) {
+    return IterateurConstD(&liste, liste.taille > 0 ? liste.tete : nullptr, 0);
+}
+
+inline IterateurConstD end(const ListeDouble& liste) {
+    return IterateurConstD(&liste, nullptr, liste.tete != nullptr ? liste.taille : 0);
+}
+
+#endif
@@ -0,0 +1,110 @@
+#include "ListParcours.h"
+#include <atomic>
+#include <cstdlib>
+
+static std::atomic<int> distancePrefetch(DISTANCE_PREFETCH_DEFAUT);
+
+// ============================================================================
+// TABLE DE SAUTS (chemin d'écriture du propriétaire)
+// ============================================================================
+
+/**
+ * @brief Porte la table à au moins taille entrées (nouvelles entrées à NULL)
+ *
+ * Le bloc peut changer d'adresse : n'est appelé que par les fonctions qui
+ * modifient la liste, donc jamais pendant qu'un parcours tient la table.
+ */
+static bool Reserver(ListeSimple* liste, int taille) {
+    if (taille <= liste->capaciteSauts) {
+        return true;
+    }
+
+    int capacite = liste->capaciteSauts > 0 ? liste->capaciteSauts : 16;
+    while (capacite < taille) {
+        capacite = (capacite > (1 << 29)) ? taille : capacite * 2;
+    }
+
+    NoeudS** sauts = (NoeudS**)realloc(liste->sauts, (size_t)capacite * sizeof(NoeudS*));
+    if (sauts == nullptr) {
+        return false;
+    }
+    for (int i = liste->capaciteSauts; i < capacite; i++) {
+        sauts[i] = nullptr;
+    }
+
+    liste->sauts = sauts;
+    liste->capaciteSauts = capacite;
+    return true;
+}
+
+bool AgrandirSauts(ListeSimple* liste) {
+    if (liste == nullptr || liste->sauts == nullptr) {
+        return false;
+    }
+    return Reserver(liste, liste->taille);
+}
+
+void InvaliderSauts(ListeSimple* liste, int debut) {
+    if (liste == nullptr || liste->sauts == nullptr) {
+        return;
+    }
+    for (int i = debut < 0 ? 0 : debut; i < liste->capaciteSauts; i++) {
+        liste->sauts[i] = nullptr;
+    }
+}
+
+// ============================================================================
+// CONFIGURATION
+// ============================================================================
+
+void DefinirDistancePrefetch(int distance) {
+    distancePrefetch.store(distance < 0 ? 0 : distance, std::memory_order_relaxed);
+}
+
+int ObtenirDistancePrefetch() {
+    return distancePrefetch.load(std::memory_order_relaxed);
+}
+
+bool ActiverSauts(ListeSimple* liste) {
+    if (liste == nullptr) {
+        return false;
+    }
+    return Reserver(liste, liste->taille > 0 ? liste->taille : 1);
+}
+
+void DesactiverSauts(ListeSimple* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+
+    free(liste->sauts);
+    liste->sauts = nullptr;
+    liste->capaciteSauts = 0;
+}
+
+bool SautsActifs(const ListeSimple* liste) {
+    return liste != nullptr && liste->sauts != nullptr;
+}
+
+// ============================================================================
+// PARCOURS
+// ============================================================================
+
+ParcoursS DebuterParcours(const ListeSimple* liste) {
+    ParcoursS parcours;
+    parcours.courant = (liste != nullptr) ? liste->tete : nullptr;
+    parcours.precedent = nullptr;
+    parcours.index = 0;
+    parcours.restants = (liste != nullptr && liste->tete != nullptr) ? liste->taille : 0;
+    parcours.sauts = nullptr;
+    parcours.nombreSauts = 0;
+    parcours.distance = distancePrefetch.load(std::memory_order_relaxed);
+
+    // Lecture seule : une position au-delà de la capacité n'est simplement pas indexée
+    if (parcours.restants > 0 && liste->sauts != nullptr) {
+        parcours.sauts = liste->sauts;
+        parcours.nombreSauts = liste->taille < liste->capaciteSauts ? liste->taille : liste->capaciteSauts;
+    }
+
+    return parcours;
+}
@@ -0,0 +1,169 @@
+#ifndef LISTE_PARCOURS_H
+#define LISTE_PARCOURS_H
+
+#include "ListS.h"
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @brief Distance de préchargement par défaut (en nœuds)
+ */
+#define DISTANCE_PREFETCH_DEFAUT 16
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PRECHARGER_NOEUD(adresse) __builtin_prefetch((adresse), 0, 3)
+#else
+#define PRECHARGER_NOEUD(adresse) ((void)(adresse))
+#endif
+
+/**
+ * @brief État d'un parcours de liste simple avec préchargement
+ *
+ * Sur une liste dont les sauts sont activés, une table annexe (portée par
+ * la liste elle-même, champs sauts et capaciteSauts) garde l'adresse du
+ * nœud de chaque position. Pendant le parcours, le nœud situé distance
+ * positions plus loin est préchargé depuis cette table, ce qui casse la
+ * chaîne de lectures dépendantes. La table n'est qu'un indice : elle n'est
+ * jamais déréférencée (un préchargement ne peut pas fauter) et chaque
+ * parcours corrige les entrées des nœuds qu'il visite. Les entrées sont
+ * lues et écrites en relaxé : des lecteurs concurrents d'une même liste
+ * peuvent se partager la table. Elle n'est agrandie ou libérée que par les
+ * fonctions qui modifient la liste, jamais pendant un parcours.
+ */
+typedef struct {
+    NoeudS* courant;      /**< Prochain nœud à visiter (NULL en fin de parcours) */
+    NoeudS* precedent;    /**< Dernier nœud visité (NULL au départ) */
+    int index;            /**< Position de courant dans la liste */
+    int restants;         /**< Nœuds restant à visiter, courant compris */
+    NoeudS** sauts;       /**< Table des adresses par position (NULL si inactive) */
+    int nombreSauts;      /**< Nombre d'entrées utilisables dans sauts */
+    int distance;         /**< Distance de préchargement (0 = aucun) */
+} ParcoursS;
+
+// ============================================================================
+// CONFIGURATION
+// ============================================================================
+
+/**
+ * @brief Règle la distance de préchargement de tous les parcours
+ * @param distance Nombre de nœuds d'avance (0 désactive le préchargement)
+ */
+void DefinirDistancePrefetch(int distance);
+
+/**
+ * @brief Distance de préchargement courante
+ * @return Nombre de nœuds d'avance
+ */
+int ObtenirDistancePrefetch();
+
+/**
+ * @brief Active la table de sauts d'une liste (remplie au premier parcours)
+ * @param liste Liste concernée
+ * @return true si la table a pu être créée ou existait déjà
+ * @note La table est rendue par Nettoyer, Detruire ou DesactiverSauts
+ */
+bool ActiverSauts(ListeSimple* liste);
+
+/**
+ * @brief Libère la table de sauts d'une liste (sans effet si absente)
+ * @param liste Liste concernée
+ */
+void DesactiverSauts(ListeSimple* liste);
+
+/**
+ * @brief Agrandit la table pour couvrir une taille dépassant sa capacité
+ * @return false si l'allocation échoue (la table reste utilisable, en partie)
+ */
+bool AgrandirSauts(ListeSimple* liste);
+
+/**
+ * @brief Efface les entrées à partir d'une position (nœuds partis dans une autre liste)
+ * @param liste Liste modifiée
+ * @param debut Première position effacée
+ */
+void InvaliderSauts(ListeSimple* liste, int debut);
+
+/**
+ * @brief Suit la taille de la liste après une insertion (appelé par les fonctions d'insertion)
+ * @param liste Liste modifiée
+ */
+static inline void AjusterSauts(ListeSimple* liste) {
+    if (liste->sauts != nullptr && liste->taille > liste->capaciteSauts) {
+        AgrandirSauts(liste);
+    }
+}
+
+/**
+ * @brief Indique si une liste possède une table de sauts
+ * @param liste Liste concernée
+ * @return true si la table est active
+ */
+bool SautsActifs(const ListeSimple* liste);
+
+// ============================================================================
+// PARCOURS
+// ============================================================================
+
+/**
+ * @brief Prépare un parcours de la tête jusqu'à taille nœuds
+ * @param liste Liste à parcourir
+ * @return État initial (courant == tete)
+ */
+ParcoursS DebuterParcours(const ListeSimple* liste);
+
+/**
+ * @brief Passe au nœud suivant en préchargeant distance nœuds plus loin
+ * @param parcours État du parcours
+ * @return Nœud quitté (l'ancien courant), ou NULL si le parcours est terminé
+ * @note Le lien suivant est lu avant le retour : le nœud rendu peut être libéré
+ */
+static inline NoeudS* AvancerParcours(ParcoursS* parcours) {
+    NoeudS* noeud = parcours->courant;
+    if (noeud == nullptr || parcours->restants <= 0) {
+        return nullptr;
+    }
+
+    if (parcours->sauts != nullptr) {
+        int cible = parcours->index + parcours->distance;
+        if (parcours->distance > 0 && cible < parcours->nombreSauts) {
+            NoeudS* indice = std::atomic_ref<NoeudS*>(parcours->sauts[cible]).load(std::memory_order_relaxed);
+            if (indice != nullptr) {
+                PRECHARGER_NOEUD(indice);
+            }
+        }
+        if (parcours->index < parcours->nombreSauts) {
+            std::atomic_ref<NoeudS*>(parcours->sauts[parcours->index]).store(noeud, std::memory_order_relaxed);
+        }
+    }
+
+    parcours->precedent = noeud;
+    parcours->courant = noeud->suivant;
+    parcours->index++;
+    parcours->restants--;
+    return noeud;
+}
+
+/**
+ * @brief Saute nombre nœuds placés à pas constant à partir de courant
+ * @param parcours État du parcours
+ * @param nombre Nombre de nœuds de la série à passer (au moins 1)
+ * @param pas Écart en octets entre deux nœuds de la série
+ */
+static inline void AvancerSerie(ParcoursS* parcours, int nombre, ptrdiff_t pas) {
+    char* premier = (char*)parcours->courant;
+    NoeudS* dernier = (NoeudS*)(premier + (nombre - 1) * pas);
+
+    if (parcours->sauts != nullptr) {
+        for (int i = 0; i < nombre && parcours->index + i < parcours->nombreSauts; i++) {
+            std::atomic_ref<NoeudS*>(parcours->sauts[parcours->index + i])
+                .store((NoeudS*)(premier + i * pas), std::memory_order_relaxed);
+        }
+    }
+
+    parcours->precedent = dernier;
+    parcours->courant = dernier->suivant;
+    parcours->index += nombre;
+    parcours->restants -= nombre;
+}
+
+#endif
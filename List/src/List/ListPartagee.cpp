@@ -0,0 +1,429 @@
+#include "ListPartagee.h"
+#include <cstdlib>
+#include <new>
+#include <string>
+
+// ============================================================================
+// GESTION DES RÉFÉRENCES
+// ============================================================================
+
+/**
+ * @brief Crée un nœud avec une référence ; le lien vers suivant est repris tel quel
+ */
+static NoeudPartage* CreerNoeudPartage(int valeur, NoeudPartage* suivant) {
+    void* memoire = malloc(sizeof(NoeudPartage));
+    if (memoire == nullptr) {
+        return nullptr;
+    }
+    NoeudPartage* nouveau = new (memoire) NoeudPartage;
+    nouveau->donnee = valeur;
+    nouveau->references.store(1, std::memory_order_relaxed);
+    nouveau->suivant = suivant;
+    return nouveau;
+}
+
+static void Acquerir(NoeudPartage* noeud) {
+    if (noeud != nullptr) {
+        noeud->references.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Abandonne une référence ; libère itérativement les nœuds devenus orphelins
+ */
+static void Relacher(NoeudPartage* noeud) {
+    while (noeud != nullptr && noeud->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        NoeudPartage* suivant = noeud->suivant;
+        free(noeud);
+        noeud = suivant;
+    }
+}
+
+static inline int Exclusifs(const ListePartagee* liste) {
+    return liste->exclusifs.load(std::memory_order_relaxed);
+}
+
+static inline void FixerExclusifs(ListePartagee* liste, int exclusifs) {
+    liste->exclusifs.store(exclusifs, std::memory_order_relaxed);
+}
+
+static bool EstExclusif(const NoeudPartage* noeud) {
+    return noeud->references.load(std::memory_order_acquire) == 1;
+}
+
+/**
+ * @brief Garantit que les nœuds 0..position n'appartiennent qu'à cette liste
+ *
+ * Les nœuds partagés rencontrés sur le chemin sont recopiés ; le premier nœud
+ * après position reste partagé (sa référence est simplement incrémentée).
+ * @return Le nœud à la position demandée, ou NULL en cas d'échec d'allocation
+ */
+static NoeudPartage* RendreExclusif(ListePartagee* liste, int position) {
+    NoeudPartage** lien = &liste->tete;
+    NoeudPartage* noeud = nullptr;
+
+    for (int i = 0; i <= position; i++) {
+        noeud = *lien;
+        if (i >= Exclusifs(liste) && !EstExclusif(noeud)) {
+            NoeudPartage* copie = CreerNoeudPartage(noeud->donnee, noeud->suivant);
+            if (copie == nullptr) {
+                return nullptr;
+            }
+            Acquerir(noeud->suivant);
+            *lien = copie;
+            if (liste->queue == noeud) {
+                liste->queue = copie;
+            }
+            Relacher(noeud);
+            noeud = copie;
+        }
+        lien = &noeud->suivant;
+    }
+
+    if (Exclusifs(liste) <= position) {
+        FixerExclusifs(liste, position + 1);
+    }
+    return noeud;
+}
+
+/**
+ * @brief Accroche un nouveau nœud exclusif après dernier (NULL : liste vide)
+ */
+static bool AjouterApres(ListePartagee* liste, NoeudPartage* dernier, int valeur) {
+    NoeudPartage* nouveau = CreerNoeudPartage(valeur, nullptr);
+    if (nouveau == nullptr) {
+        return false;
+    }
+
+    if (dernier == nullptr) {
+        liste->tete = nouveau;
+    } else {
+        dernier->suivant = nouveau;
+    }
+    liste->queue = nouveau;
+    if (Exclusifs(liste) == liste->taille) {
+        FixerExclusifs(liste, liste->taille + 1);
+    }
+    liste->taille++;
+    return true;
+}
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+ListePartagee* AllocatePartagee() {
+    void* memoire = malloc(sizeof(ListePartagee));
+    if (memoire == nullptr) {
+        return nullptr;
+    }
+    ListePartagee* nouvelleListe = new (memoire) ListePartagee;
+    nouvelleListe->tete = nullptr;
+    nouvelleListe->queue = nullptr;
+    nouvelleListe->taille = 0;
+    nouvelleListe->exclusifs.store(0, std::memory_order_relaxed);
+    return nouvelleListe;
+}
+
+ListePartagee* ConvertirEnPartagee(const ListeSimple* source) {
+    if (source == nullptr) {
+        return nullptr;
+    }
+
+    ListePartagee* resultat = AllocatePartagee();
+    if (resultat == nullptr) {
+        return nullptr;
+    }
+
+    // Chaînage direct par la queue : chaque ajout est en O(1)
+    NoeudS* courant = source->tete;
+    for (int i = 0; i < source->taille && courant != nullptr; i++) {
+        if (!AjouterApres(resultat, resultat->queue, courant->donnee)) {
+            Detruire(resultat);
+            return nullptr;
+        }
+        courant = courant->suivant;
+    }
+
+    return resultat;
+}
+
+ListeSimple* ConvertirEnSimple(const ListePartagee* source) {
+    if (source == nullptr) {
+        return nullptr;
+    }
+
+    ListeSimple* resultat = AllocateSimple();
+    if (resultat == nullptr) {
+        return nullptr;
+    }
+
+    NoeudS* dernier = nullptr;
+    for (NoeudPartage* courant = source->tete; courant != nullptr; courant = courant->suivant) {
+        NoeudS* copie = CreerNoeudS(courant->donnee);
+        if (copie == nullptr) {
+            Detruire(resultat);
+            return nullptr;
+        }
+        if (dernier == nullptr) {
+            resultat->tete = copie;
+        } else {
+            dernier->suivant = copie;
+        }
+        dernier = copie;
+        resultat->taille++;
+    }
+    resultat->queue = dernier;
+
+    return resultat;
+}
+
+ListePartagee* Copier(const ListePartagee* liste) {
+    if (liste == nullptr) {
+        return nullptr;
+    }
+
+    ListePartagee* copie = AllocatePartagee();
+    if (copie == nullptr) {
+        return nullptr;
+    }
+
+    Acquerir(liste->tete);
+    copie->tete = liste->tete;
+    copie->queue = liste->queue;
+    copie->taille = liste->taille;
+    // Tous les nœuds de la source sont désormais atteignables depuis la copie ;
+    // plusieurs copies simultanées écrivent la même valeur
+    liste->exclusifs.store(0, std::memory_order_relaxed);
+    return copie;
+}
+
+void Nettoyer(ListePartagee* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+
+    Relacher(liste->tete);
+    liste->tete = nullptr;
+    liste->queue = nullptr;
+    liste->taille = 0;
+    FixerExclusifs(liste, 0);
+}
+
+void Detruire(ListePartagee* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+
+    Nettoyer(liste);
+    free(liste);
+}
+
+// ============================================================================
+// FONCTIONS D'INSERTION ET DE MODIFICATION
+// ============================================================================
+
+bool InsererDebut(ListePartagee* liste, int valeur) {
+    if (liste == nullptr) {
+        return false;
+    }
+
+    // La référence de la liste vers l'ancienne tête passe au nouveau nœud
+    NoeudPartage* nouveau = CreerNoeudPartage(valeur, liste->tete);
+    if (nouveau == nullptr) {
+        return false;
+    }
+
+    liste->tete = nouveau;
+    if (liste->queue == nullptr) {
+        liste->queue = nouveau;
+    }
+    liste->taille++;
+    FixerExclusifs(liste, Exclusifs(liste) + 1);
+    return true;
+}
+
+bool InsererFin(ListePartagee* liste, int valeur) {
+    if (liste == nullptr) {
+        return false;
+    }
+
+    if (EstVide(liste)) {
+        return InsererDebut(liste, valeur);
+    }
+
+    // Liste entièrement exclusive : la queue se modifie sur place, sans parcours
+    NoeudPartage* dernier = liste->queue;
+    if (Exclusifs(liste) < liste->taille) {
+        dernier = RendreExclusif(liste, liste->taille - 1);
+        if (dernier == nullptr) {
+            return false;
+        }
+    }
+
+    return AjouterApres(liste, dernier, valeur);
+}
+
+bool InsererPosition(ListePartagee* liste, int position, int valeur) {
+    if (liste == nullptr || position < 0 || position > liste->taille) {
+        return false;
+    }
+
+    if (position == 0) {
+        return InsererDebut(liste, valeur);
+    }
+
+    if (position == liste->taille) {
+        return InsererFin(liste, valeur);
+    }
+
+    NoeudPartage* precedent = RendreExclusif(liste, position - 1);
+    if (precedent == nullptr) {
+        return false;
+    }
+
+    NoeudPartage* nouveau = CreerNoeudPartage(valeur, precedent->suivant);
+    if (nouveau == nullptr) {
+        return false;
+    }
+
+    precedent->suivant = nouveau;
+    liste->taille++;
+    FixerExclusifs(liste, Exclusifs(liste) + 1);
+    return true;
+}
+
+bool ModifierPosition(ListePartagee* liste, int position, int valeur) {
+    if (liste == nullptr || position < 0 || position >= liste->taille) {
+        return false;
+    }
+
+    NoeudPartage* cible = RendreExclusif(liste, position);
+    if (cible == nullptr) {
+        return false;
+    }
+
+    cible->donnee = valeur;
+    return true;
+}
+
+// ============================================================================
+// FONCTIONS DE SUPPRESSION
+// ============================================================================
+
+bool SupprimerDebut(ListePartagee* liste) {
+    if (liste == nullptr || EstVide(liste)) {
+        return false;
+    }
+
+    // Une ancienne tête partagée survit et partage désormais la nouvelle
+    NoeudPartage* ancienneTete = liste->tete;
+    liste->tete = ancienneTete->suivant;
+    Acquerir(liste->tete);
+    Relacher(ancienneTete);
+    FixerExclusifs(liste, Exclusifs(liste) > 0 ? Exclusifs(liste) - 1 : 0);
+
+    liste->taille--;
+    if (liste->taille == 0) {
+        liste->queue = nullptr;
+    }
+    return true;
+}
+
+bool SupprimerPosition(ListePartagee* liste, int position) {
+    if (liste == nullptr || position < 0 || position >= liste->taille) {
+        return false;
+    }
+
+    if (position == 0) {
+        return SupprimerDebut(liste);
+    }
+
+    NoeudPartage* precedent = RendreExclusif(liste, position - 1);
+    if (precedent == nullptr) {
+        return false;
+    }
+
+    NoeudPartage* cible = precedent->suivant;
+    precedent->suivant = cible->suivant;
+    Acquerir(cible->suivant);
+    if (cible == liste->queue) {
+        liste->queue = precedent;
+    }
+    Relacher(cible);
+    // Une cible partagée survit et partage désormais son suivant
+    if (Exclusifs(liste) > position) {
+        FixerExclusifs(liste, Exclusifs(liste) - 1);
+    }
+
+    liste->taille--;
+    return true;
+}
+
+bool SupprimerValeur(ListePartagee* liste, int valeur) {
+    int position = RechercherValeur(liste, valeur);
+    if (position < 0) {
+        return false;
+    }
+    return SupprimerPosition(liste, position);
+}
+
+// ============================================================================
+// FONCTIONS DE RECHERCHE ET D'INFORMATION
+// ============================================================================
+
+int RechercherValeur(const ListePartagee* liste, int valeur) {
+    if (liste == nullptr) {
+        return -1;
+    }
+
+    int position = 0;
+    for (const NoeudPartage* courant = liste->tete; courant != nullptr; courant = courant->suivant) {
+        if (courant->donnee == valeur) {
+            return position;
+        }
+        position++;
+    }
+
+    return -1;
+}
+
+const NoeudPartage* ObtenirNoeudPosition(const ListePartagee* liste, int position) {
+    if (liste == nullptr || position < 0 || position >= liste->taille) {
+        return nullptr;
+    }
+
+    const NoeudPartage* courant = liste->tete;
+    for (int i = 0; i < position; i++) {
+        courant = courant->suivant;
+    }
+    return courant;
+}
+
+std::string ToString(const ListePartagee* liste) {
+    if (liste == nullptr) {
+        return "ListePartagee[NULL]";
+    }
+
+    std::string resultat = "ListePartagee[";
+    for (const NoeudPartage* courant = liste->tete; courant != nullptr; courant = courant->suivant) {
+        if (courant != liste->tete) {
+            resultat += " -> ";
+        }
+        resultat += "Noeud(" + std::to_string(courant->donnee) + ")";
+    }
+    resultat += "]";
+
+    return resultat;
+}
+
+int CompterElements(const ListePartagee* liste) {
+    if (liste == nullptr) {
+        return 0;
+    }
+    return liste->taille;
+}
+
+bool EstVide(const ListePartagee* liste) {
+    return liste == nullptr || liste->tete == nullptr || liste->taille == 0;
+}
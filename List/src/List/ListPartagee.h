@@ -0,0 +1,198 @@
+#ifndef LISTE_PARTAGEE_H
+#define LISTE_PARTAGEE_H
+
+#include "ListS.h"
+#include <atomic>
+#include <string>
+
+/**
+ * @brief Structure représentant un nœud partageable entre plusieurs listes
+ *
+ * references compte les liens entrants (tête d'une liste ou suivant d'un autre
+ * nœud). Un nœud n'est modifié sur place que si tout le chemin qui y mène
+ * depuis la tête n'a qu'une seule référence ; sinon ce chemin est d'abord recopié.
+ */
+typedef struct NoeudPartage {
+    int donnee;                         /**< Donnée stockée dans le nœud */
+    std::atomic<int> references;        /**< Nombre de liens entrants */
+    struct NoeudPartage* suivant;       /**< Pointeur vers le nœud suivant */
+} NoeudPartage;
+
+/**
+ * @brief Structure représentant une liste à copie sur écriture
+ *
+ * Copier est en O(1) : la copie partage tous les nœuds de la source. Une
+ * modification à la position k ne recopie que les nœuds partagés situés
+ * avant k (inclus). Les listes partagées ne sont jamais circulaires.
+ * Deux listes qui partagent des nœuds peuvent être utilisées depuis des
+ * threads différents. Une même liste peut être copiée (Copier) et lue par
+ * plusieurs threads à la fois ; elle ne doit être modifiée que par un seul
+ * thread, et pas pendant ces copies.
+ *
+ * Un nœud à une seule référence peut rester partagé (un seul nœud pointe
+ * vers lui, mais ce nœud est lui-même partagé) : exclusifs retient donc
+ * combien de nœuds de tête sont connus pour n'appartenir qu'à cette liste.
+ * Seul Copier crée un nouveau partage, toujours par la tête, et remet ce
+ * compte à zéro ; quand il couvre toute la liste, InsererFin est en O(1).
+ * Les accès à exclusifs sont relâchés : des copies simultanées n'y écrivent
+ * que zéro, et une modification de la source est de toute façon ordonnée
+ * après les copies (elle entrerait sinon en concurrence avec leur lecture
+ * de tete).
+ */
+typedef struct {
+    NoeudPartage* tete;             /**< Pointeur vers le premier nœud de la liste */
+    NoeudPartage* queue;            /**< Pointeur vers le dernier nœud de la liste */
+    int taille;                     /**< Nombre d'éléments dans la liste */
+    mutable std::atomic<int> exclusifs; /**< Nœuds de tête non partagés (minorant, remis à zéro par Copier) */
+} ListePartagee;
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+/**
+ * @brief Crée une nouvelle liste partagée vide
+ * @return Pointeur vers la liste créée
+ */
+ListePartagee* AllocatePartagee();
+
+/**
+ * @brief Construit une liste partagée à partir d'une liste simple (copie profonde)
+ * @param source Liste simple à convertir
+ * @return Nouvelle liste partagée, ou NULL en cas d'échec
+ */
+ListePartagee* ConvertirEnPartagee(const ListeSimple* source);
+
+/**
+ * @brief Construit une liste simple indépendante à partir d'une liste partagée
+ * @param source Liste partagée à convertir
+ * @return Nouvelle liste simple, ou NULL en cas d'échec
+ */
+ListeSimple* ConvertirEnSimple(const ListePartagee* source);
+
+/**
+ * @brief Copie une liste partagée en O(1) (tous les nœuds sont partagés)
+ * @param liste Pointeur vers la liste source
+ * @return Nouvelle liste partageant les nœuds de la source
+ */
+ListePartagee* Copier(const ListePartagee* liste);
+
+/**
+ * @brief Vide la liste ; seuls les nœuds qui ne sont plus référencés sont libérés
+ * @param liste Pointeur vers la liste à vider
+ */
+void Nettoyer(ListePartagee* liste);
+
+/**
+ * @brief Libère la liste partagée (structure + nœuds non partagés)
+ * @param liste Pointeur vers la liste à détruire
+ */
+void Detruire(ListePartagee* liste);
+
+// ============================================================================
+// FONCTIONS D'INSERTION ET DE MODIFICATION
+// ============================================================================
+
+/**
+ * @brief Insère un élément au début de la liste (O(1), aucune recopie)
+ * @param liste Pointeur vers la liste
+ * @param valeur Valeur à insérer
+ * @return true si l'insertion a réussi, false sinon
+ */
+bool InsererDebut(ListePartagee* liste, int valeur);
+
+/**
+ * @brief Insère un élément à la fin de la liste (recopie les nœuds encore partagés)
+ * @param liste Pointeur vers la liste
+ * @param valeur Valeur à insérer
+ * @return true si l'insertion a réussi, false sinon
+ */
+bool InsererFin(ListePartagee* liste, int valeur);
+
+/**
+ * @brief Insère un élément à une position spécifique
+ * @param liste Pointeur vers la liste
+ * @param position Position où insérer (0-based)
+ * @param valeur Valeur à insérer
+ * @return true si l'insertion a réussi, false si position invalide
+ */
+bool InsererPosition(ListePartagee* liste, int position, int valeur);
+
+/**
+ * @brief Remplace la valeur stockée à une position
+ * @param liste Pointeur vers la liste
+ * @param position Position à modifier (0-based)
+ * @param valeur Nouvelle valeur
+ * @return true si la modification a réussi, false si position invalide
+ */
+bool ModifierPosition(ListePartagee* liste, int position, int valeur);
+
+// ============================================================================
+// FONCTIONS DE SUPPRESSION
+// ============================================================================
+
+/**
+ * @brief Supprime le premier élément de la liste (O(1), aucune recopie)
+ * @param liste Pointeur vers la liste
+ * @return true si la suppression a réussi, false si liste vide
+ */
+bool SupprimerDebut(ListePartagee* liste);
+
+/**
+ * @brief Supprime l'élément à une position spécifique
+ * @param liste Pointeur vers la liste
+ * @param position Position à supprimer (0-based)
+ * @return true si la suppression a réussi, false si position invalide
+ */
+bool SupprimerPosition(ListePartagee* liste, int position);
+
+/**
+ * @brief Supprime la première occurrence d'une valeur
+ * @param liste Pointeur vers la liste
+ * @param valeur Valeur à supprimer
+ * @return true si la suppression a réussi, false si valeur non trouvée
+ */
+bool SupprimerValeur(ListePartagee* liste, int valeur);
+
+// ============================================================================
+// FONCTIONS DE RECHERCHE ET D'INFORMATION
+// ============================================================================
+
+/**
+ * @brief Recherche la première occurrence d'une valeur
+ * @param liste Pointeur vers la liste
+ * @param valeur Valeur à rechercher
+ * @return Position de la valeur (0-based), ou -1 si non trouvée
+ */
+int RechercherValeur(const ListePartagee* liste, int valeur);
+
+/**
+ * @brief Récupère le nœud à une position spécifique (lecture seule)
+ * @param liste Pointeur vers la liste
+ * @param position Position souhaitée (0-based)
+ * @return Pointeur vers le nœud, ou NULL si position invalide
+ */
+const NoeudPartage* ObtenirNoeudPosition(const ListePartagee* liste, int position);
+
+/**
+ * @brief Convertit une liste partagée en représentation string
+ * @param liste Pointeur vers la liste à convertir
+ * @return Représentation string de la liste
+ */
+std::string ToString(const ListePartagee* liste);
+
+/**
+ * @brief Compte le nombre d'éléments dans la liste partagée
+ * @param liste Pointeur vers la liste
+ * @return Nombre d'éléments
+ */
+int CompterElements(const ListePartagee* liste);
+
+/**
+ * @brief Vérifie si la liste partagée est vide
+ * @param liste Pointeur vers la liste
+ * @return true si la liste est vide, false sinon
+ */
+bool EstVide(const ListePartagee* liste);
+
+#endif
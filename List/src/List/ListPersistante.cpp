@@ -0,0 +1,890 @@
+#include "ListPersistante.h"
+#include "ListSIMD.h"
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ============================================================================
+// FORMAT DU FICHIER
+// ============================================================================
+
+static const uint64_t MAGIE_PERSISTANTE = 0x31505453494C4E4BULL; // "KNLISTP1"
+static const uint32_t VERSION_PERSISTANTE = 1;
+static const uint64_t TAILLE_PAGE = 4096;
+
+static uint64_t ArrondirPage(uint64_t taille) {
+    return (taille + TAILLE_PAGE - 1) & ~(TAILLE_PAGE - 1);
+}
+
+static EnteteP* Entete(const ListePersistante* liste) {
+    return (EnteteP*)liste->base;
+}
+
+static NoeudP* Noeud(const ListePersistante* liste, DecalageP decalage) {
+    return (NoeudP*)(liste->base + decalage);
+}
+
+/**
+ * @brief Faux si la liste est NULL ou a perdu sa projection (reprojection refusée)
+ */
+static bool EstUtilisable(const ListePersistante* liste) {
+    return liste != nullptr && liste->base != nullptr;
+}
+
+// ============================================================================
+// COUCHE PLATEFORME (projection, redimensionnement, synchronisation)
+// ============================================================================
+
+#ifdef _WIN32
+
+static bool OuvrirFichier(ListePersistante* liste, const char* chemin, uint64_t* tailleExistante) {
+    HANDLE fichier = CreateFileA(chemin, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                                 OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fichier == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER taille;
+    if (!GetFileSizeEx(fichier, &taille)) {
+        CloseHandle(fichier);
+        return false;
+    }
+    liste->fichier = (intptr_t)fichier;
+    *tailleExistante = (uint64_t)taille.QuadPart;
+    return true;
+}
+
+static void FermerFichier(ListePersistante* liste) {
+    CloseHandle((HANDLE)liste->fichier);
+}
+
+static bool RedimensionnerFichier(ListePersistante* liste, uint64_t taille) {
+    LARGE_INTEGER position;
+    position.QuadPart = (LONGLONG)taille;
+    return SetFilePointerEx((HANDLE)liste->fichier, position, nullptr, FILE_BEGIN)
+        && SetEndOfFile((HANDLE)liste->fichier);
+}
+
+static bool Projeter(ListePersistante* liste, uint64_t taille) {
+    HANDLE projection = CreateFileMappingA((HANDLE)liste->fichier, nullptr, PAGE_READWRITE,
+                                           (DWORD)(taille >> 32), (DWORD)(taille & 0xFFFFFFFFu), nullptr);
+    if (projection == nullptr) {
+        return false;
+    }
+    void* base = MapViewOfFile(projection, FILE_MAP_ALL_ACCESS, 0, 0, (SIZE_T)taille);
+    if (base == nullptr) {
+        CloseHandle(projection);
+        return false;
+    }
+    liste->projection = (intptr_t)projection;
+    liste->base = (unsigned char*)base;
+    liste->tailleProjetee = taille;
+    return true;
+}
+
+static void Deprojeter(ListePersistante* liste) {
+    UnmapViewOfFile(liste->base);
+    CloseHandle((HANDLE)liste->projection);
+    liste->base = nullptr;
+    liste->tailleProjetee = 0;
+}
+
+static bool Vider(ListePersistante* liste, bool bloquant) {
+    if (!FlushViewOfFile(liste->base, (SIZE_T)liste->tailleProjetee)) {
+        return false;
+    }
+    return !bloquant || FlushFileBuffers((HANDLE)liste->fichier);
+}
+
+#else
+
+static bool OuvrirFichier(ListePersistante* liste, const char* chemin, uint64_t* tailleExistante) {
+    int fd = open(chemin, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat infos;
+    if (fstat(fd, &infos) != 0) {
+        close(fd);
+        return false;
+    }
+    liste->fichier = fd;
+    *tailleExistante = (uint64_t)infos.st_size;
+    return true;
+}
+
+static void FermerFichier(ListePersistante* liste) {
+    close((int)liste->fichier);
+}
+
+static bool RedimensionnerFichier(ListePersistante* liste, uint64_t taille) {
+    return ftruncate((int)liste->fichier, (off_t)taille) == 0;
+}
+
+static bool Projeter(ListePersistante* liste, uint64_t taille) {
+    void* base = mmap(nullptr, (size_t)taille, PROT_READ | PROT_WRITE, MAP_SHARED, (int)liste->fichier, 0);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+    liste->base = (unsigned char*)base;
+    liste->tailleProjetee = taille;
+    return true;
+}
+
+static void Deprojeter(ListePersistante* liste) {
+    munmap(liste->base, (size_t)liste->tailleProjetee);
+    liste->base = nullptr;
+    liste->tailleProjetee = 0;
+}
+
+static bool Vider(ListePersistante* liste, bool bloquant) {
+    return msync(liste->base, (size_t)liste->tailleProjetee, bloquant ? MS_SYNC : MS_ASYNC) == 0;
+}
+
+#endif
+
+// ============================================================================
+// GESTION DES EMPLACEMENTS
+// ============================================================================
+
+static bool Agrandir(ListePersistante* liste, uint64_t tailleMinimale) {
+    uint64_t nouvelleTaille = Entete(liste)->capacite * 2;
+    if (nouvelleTaille < tailleMinimale) {
+        nouvelleTaille = tailleMinimale;
+    }
+    nouvelleTaille = ArrondirPage(nouvelleTaille);
+
+    // Les pages déjà écrites restent dans le cache du système : la reprojection
+    // ne recopie rien, elle change seulement l'adresse de base.
+    // En cas d'échec, l'ancienne projection est rétablie ; si même elle est
+    // refusée, base reste NULL et la liste devient inutilisable.
+    uint64_t ancienneTaille = liste->tailleProjetee;
+    Deprojeter(liste);
+    if (!RedimensionnerFichier(liste, nouvelleTaille)) {
+        Projeter(liste, ancienneTaille);
+        return false;
+    }
+    if (!Projeter(liste, nouvelleTaille)) {
+        // Le fichier agrandi garde les octets existants : l'ancienne taille reste valide
+        Projeter(liste, ancienneTaille);
+        return false;
+    }
+    Entete(liste)->capacite = nouvelleTaille;
+    return true;
+}
+
+static DecalageP AllouerNoeudP(ListePersistante* liste, int valeur) {
+    EnteteP* entete = Entete(liste);
+    DecalageP decalage = entete->libre;
+
+    if (decalage != 0) {
+        entete->libre = Noeud(liste, decalage)->suivant;
+    } else {
+        if (entete->fin + sizeof(NoeudP) > entete->capacite) {
+            if (!Agrandir(liste, entete->fin + sizeof(NoeudP))) {
+                return 0;
+            }
+            entete = Entete(liste);
+        }
+        decalage = entete->fin;
+        entete->fin += sizeof(NoeudP);
+    }
+
+    NoeudP* noeud = Noeud(liste, decalage);
+    noeud->donnee = valeur;
+    noeud->reserve = 0;
+    noeud->suivant = 0;
+    return decalage;
+}
+
+static void LibererNoeudP(ListePersistante* liste, DecalageP decalage) {
+    EnteteP* entete = Entete(liste);
+    Noeud(liste, decalage)->suivant = entete->libre;
+    entete->libre = decalage;
+}
+
+/**
+ * @brief Mesure une série de nœuds dont chaque lien vaut le décalage courant + pas
+ */
+static int MesurerSerieP(const ListePersistante* liste, DecalageP premier, int64_t pas, int maximum) {
+    DecalageP courant = premier;
+    int longueur = 1;
+    while (longueur < maximum && Noeud(liste, courant)->suivant == courant + (DecalageP)pas) {
+        courant += (DecalageP)pas;
+        longueur++;
+    }
+    return longueur;
+}
+
+/**
+ * @brief Cherche valeur parmi au plus *restants nœuds à partir de courant
+ *
+ * Les nœuds alloués à la suite dans le fichier forment des séries à pas
+ * constant, comparées tronçon par tronçon par le moteur vectoriel ; le
+ * reste nœud par nœud.
+ * @param precedent Reçoit le dernier nœud passé (inchangé si aucun)
+ * @return Décalage du nœud trouvé (non décompté de restants), ou 0
+ */
+static DecalageP ChercherDepuisP(const ListePersistante* liste, DecalageP courant, int64_t* restants,
+                                 int valeur, DecalageP* precedent) {
+    while (*restants > 0 && courant != 0) {
+        DecalageP suivant = Noeud(liste, courant)->suivant;
+        int64_t pas = (int64_t)(suivant - courant);
+        int maximum = (int)(*restants < LISTE_SIMD_TRONCON ? *restants : LISTE_SIMD_TRONCON);
+
+        int serie = 1;
+        if (maximum >= LISTE_SIMD_SERIE_MIN && suivant != 0 && PasSerieValide((ptrdiff_t)pas, sizeof(NoeudP))) {
+            serie = MesurerSerieP(liste, courant, pas, maximum);
+        }
+
+        if (serie >= LISTE_SIMD_SERIE_MIN) {
+            int index = ChercherEntierPas(&Noeud(liste, courant)->donnee, (ptrdiff_t)pas, serie, valeur);
+            int passes = (index < 0) ? serie : index;
+            if (passes > 0) {
+                *precedent = courant + (DecalageP)((passes - 1) * pas);
+            }
+            *restants -= passes;
+            if (index >= 0) {
+                return courant + (DecalageP)(index * pas);
+            }
+            courant = Noeud(liste, *precedent)->suivant;
+            continue;
+        }
+
+        for (int i = 0; i < serie; i++) {
+            if (Noeud(liste, courant)->donnee == valeur) {
+                return courant;
+            }
+            *precedent = courant;
+            courant = Noeud(liste, courant)->suivant;
+            (*restants)--;
+        }
+    }
+
+    return 0;
+}
+
+static bool EnteteValide(const EnteteP* entete, uint64_t tailleFichier) {
+    return entete->magie == MAGIE_PERSISTANTE
+        && entete->version == VERSION_PERSISTANTE
+        && entete->tailleNoeud == sizeof(NoeudP)
+        && entete->capacite == tailleFichier
+        && entete->fin <= entete->capacite;
+}
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+ListePersistante* OuvrirPersistante(const char* chemin) {
+    if (chemin == nullptr) {
+        return nullptr;
+    }
+
+    ListePersistante* liste = (ListePersistante*)malloc(sizeof(ListePersistante));
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    liste->base = nullptr;
+    liste->tailleProjetee = 0;
+    liste->projection = 0;
+
+    uint64_t tailleExistante = 0;
+    if (!OuvrirFichier(liste, chemin, &tailleExistante)) {
+        free(liste);
+        return nullptr;
+    }
+
+    bool nouveauFichier = (tailleExistante == 0);
+    if (nouveauFichier) {
+        tailleExistante = ArrondirPage(sizeof(EnteteP) + 64 * sizeof(NoeudP));
+        if (!RedimensionnerFichier(liste, tailleExistante)) {
+            FermerFichier(liste);
+            free(liste);
+            return nullptr;
+        }
+    } else if (tailleExistante < sizeof(EnteteP)) {
+        FermerFichier(liste);
+        free(liste);
+        return nullptr;
+    }
+
+    if (!Projeter(liste, tailleExistante)) {
+        FermerFichier(liste);
+        free(liste);
+        return nullptr;
+    }
+
+    EnteteP* entete = Entete(liste);
+    if (nouveauFichier) {
+        memset(entete, 0, sizeof(EnteteP));
+        entete->magie = MAGIE_PERSISTANTE;
+        entete->version = VERSION_PERSISTANTE;
+        entete->tailleNoeud = sizeof(NoeudP);
+        entete->capacite = tailleExistante;
+        entete->fin = sizeof(EnteteP);
+    } else if (!EnteteValide(entete, tailleExistante)) {
+        Deprojeter(liste);
+        FermerFichier(liste);
+        free(liste);
+        return nullptr;
+    }
+
+    return liste;
+}
+
+bool Synchroniser(ListePersistante* liste, bool bloquant) {
+    if (!EstUtilisable(liste)) {
+        return false;
+    }
+    return Vider(liste, bloquant);
+}
+
+void FermerPersistante(ListePersistante* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    if (liste->base != nullptr) {
+        Vider(liste, true);
+        Deprojeter(liste);
+    }
+    FermerFichier(liste);
+    free(liste);
+}
+
+NoeudP* ResoudreNoeud(const ListePersistante* liste, DecalageP decalage) {
+    if (!EstUtilisable(liste) || decalage < sizeof(EnteteP) || decalage + sizeof(NoeudP) > Entete(liste)->fin) {
+        return nullptr;
+    }
+    return Noeud(liste, decalage);
+}
+
+void Nettoyer(ListePersistante* liste) {
+    if (!EstUtilisable(liste) || EstVide(liste)) {
+        return;
+    }
+
+    // Toute la chaîne rejoint la liste libre d'un seul coup : O(1)
+    EnteteP* entete = Entete(liste);
+    Noeud(liste, entete->queue)->suivant = entete->libre;
+    entete->libre = entete->tete;
+
+    entete->tete = 0;
+    entete->queue = 0;
+    entete->taille = 0;
+    entete->estCirculaire = 0;
+}
+
+// ============================================================================
+// FONCTIONS D'INSERTION
+// ============================================================================
+
+bool InsererDebut(ListePersistante* liste, int valeur) {
+    if (!EstUtilisable(liste)) {
+        return false;
+    }
+
+    DecalageP nouveau = AllouerNoeudP(liste, valeur);
+    if (nouveau == 0) {
+        return false;
+    }
+
+    EnteteP* entete = Entete(liste);
+    if (EstVide(liste)) {
+        entete->tete = nouveau;
+        entete->queue = nouveau;
+        if (entete->estCirculaire) {
+            Noeud(liste, nouveau)->suivant = nouveau;
+        }
+    } else {
+        Noeud(liste, nouveau)->suivant = entete->tete;
+        entete->tete = nouveau;
+        if (entete->estCirculaire) {
+            Noeud(liste, entete->queue)->suivant = nouveau;
+        }
+    }
+
+    entete->taille++;
+    return true;
+}
+
+bool InsererFin(ListePersistante* liste, int valeur) {
+    if (!EstUtilisable(liste)) {
+        return false;
+    }
+
+    DecalageP nouveau = AllouerNoeudP(liste, valeur);
+    if (nouveau == 0) {
+        return false;
+    }
+
+    EnteteP* entete = Entete(liste);
+    if (EstVide(liste)) {
+        entete->tete = nouveau;
+    } else {
+        Noeud(liste, entete->queue)->suivant = nouveau;
+    }
+    entete->queue = nouveau;
+
+    if (entete->estCirculaire) {
+        Noeud(liste, nouveau)->suivant = entete->tete;
+    }
+
+    entete->taille++;
+    return true;
+}
+
+bool InsererApres(ListePersistante* liste, DecalageP precedent, int valeur) {
+    if (!EstUtilisable(liste) || ResoudreNoeud(liste, precedent) == nullptr || EstVide(liste)) {
+        return false;
+    }
+
+    DecalageP nouveau = AllouerNoeudP(liste, valeur);
+    if (nouveau == 0) {
+        return false;
+    }
+
+    // Résolution après l'allocation : la projection a pu changer d'adresse
+    EnteteP* entete = Entete(liste);
+    NoeudP* noeudPrecedent = Noeud(liste, precedent);
+    Noeud(liste, nouveau)->suivant = noeudPrecedent->suivant;
+    noeudPrecedent->suivant = nouveau;
+
+    if (precedent == entete->queue) {
+        entete->queue = nouveau;
+    }
+
+    entete->taille++;
+    return true;
+}
+
+bool InsererAvant(ListePersistante* liste, DecalageP suivant, int valeur) {
+    if (!EstUtilisable(liste) || suivant == 0) {
+        return false;
+    }
+
+    if (suivant == Entete(liste)->tete) {
+        return InsererDebut(liste, valeur);
+    }
+
+    DecalageP precedent = TrouverPrecedent(liste, suivant);
+    if (precedent != 0) {
+        return InsererApres(liste, precedent, valeur);
+    }
+
+    return false;
+}
+
+bool InsererPosition(ListePersistante* liste, int position, int valeur) {
+    if (!EstUtilisable(liste) || position < 0 || position > CompterElements(liste)) {
+        return false;
+    }
+
+    if (position == 0) {
+        return InsererDebut(liste, valeur);
+    }
+
+    if (position == CompterElements(liste)) {
+        return InsererFin(liste, valeur);
+    }
+
+    return InsererApres(liste, ObtenirNoeudPosition(liste, position - 1), valeur);
+}
+
+bool InsererTrie(ListePersistante* liste, int valeur) {
+    if (!EstUtilisable(liste)) {
+        return false;
+    }
+
+    EnteteP* entete = Entete(liste);
+    if (EstVide(liste) || valeur <= Noeud(liste, entete->tete)->donnee) {
+        return InsererDebut(liste, valeur);
+    }
+
+    if (valeur >= Noeud(liste, entete->queue)->donnee) {
+        return InsererFin(liste, valeur);
+    }
+
+    DecalageP courant = entete->tete;
+    while (Noeud(liste, courant)->suivant != entete->queue
+           && Noeud(liste, Noeud(liste, courant)->suivant)->donnee < valeur) {
+        courant = Noeud(liste, courant)->suivant;
+    }
+
+    return InsererApres(liste, courant, valeur);
+}
+
+// ============================================================================
+// FONCTIONS DE SUPPRESSION
+// ============================================================================
+
+bool SupprimerDebut(ListePersistante* liste) {
+    if (!EstUtilisable(liste) || EstVide(liste)) {
+        return false;
+    }
+
+    EnteteP* entete = Entete(liste);
+    DecalageP ancienneTete = entete->tete;
+
+    if (entete->tete == entete->queue) {
+        entete->tete = 0;
+        entete->queue = 0;
+    } else {
+        entete->tete = Noeud(liste, ancienneTete)->suivant;
+        if (entete->estCirculaire) {
+            Noeud(liste, entete->queue)->suivant = entete->tete;
+        }
+    }
+
+    LibererNoeudP(liste, ancienneTete);
+    entete->taille--;
+    return true;
+}
+
+bool SupprimerFin(ListePersistante* liste) {
+    if (!EstUtilisable(liste) || EstVide(liste)) {
+        return false;
+    }
+
+    EnteteP* entete = Entete(liste);
+    if (entete->tete == entete->queue) {
+        return SupprimerDebut(liste);
+    }
+
+    DecalageP avantDernier = TrouverPrecedent(liste, entete->queue);
+    if (avantDernier == 0) {
+        return false;
+    }
+
+    LibererNoeudP(liste, entete->queue);
+    entete->queue = avantDernier;
+    Noeud(liste, avantDernier)->suivant = entete->estCirculaire ? entete->tete : 0;
+    entete->taille--;
+    return true;
+}
+
+bool SupprimerNoeud(ListePersistante* liste, DecalageP cible) {
+    if (!EstUtilisable(liste) || cible == 0 || EstVide(liste)) {
+        return false;
+    }
+
+    EnteteP* entete = Entete(liste);
+    if (cible == entete->tete) {
+        return SupprimerDebut(liste);
+    }
+
+    DecalageP precedent = TrouverPrecedent(liste, cible);
+    if (precedent == 0) {
+        return false;
+    }
+
+    Noeud(liste, precedent)->suivant = Noeud(liste, cible)->suivant;
+    if (cible == entete->queue) {
+        entete->queue = precedent;
+    }
+    LibererNoeudP(liste, cible);
+    entete->taille--;
+    return true;
+}
+
+bool SupprimerValeur(ListePersistante* liste, int valeur) {
+    if (!EstUtilisable(liste)) {
+        return false;
+    }
+
+    DecalageP cible = RechercherValeur(liste, valeur);
+    if (cible != 0) {
+        return SupprimerNoeud(liste, cible);
+    }
+    return false;
+}
+
+int SupprimerToutesOccurrences(ListePersistante* liste, int valeur) {
+    if (!EstUtilisable(liste) || EstVide(liste)) {
+        return 0;
+    }
+
+    EnteteP* entete = Entete(liste);
+    bool etaitCirculaire = entete->estCirculaire != 0;
+    if (etaitCirculaire) {
+        RendreLineaire(liste);
+    }
+
+    int compteur = 0;
+    int64_t restants = entete->taille;
+    DecalageP precedent = 0;
+    DecalageP cible = ChercherDepuisP(liste, entete->tete, &restants, valeur, &precedent);
+
+    while (cible != 0) {
+        DecalageP suivant = Noeud(liste, cible)->suivant;
+        if (precedent == 0) {
+            entete->tete = suivant;
+        } else {
+            Noeud(liste, precedent)->suivant = suivant;
+        }
+        if (cible == entete->queue) {
+            entete->queue = precedent;
+        }
+        LibererNoeudP(liste, cible);
+        entete->taille--;
+        compteur++;
+
+        restants--;
+        cible = ChercherDepuisP(liste, suivant, &restants, valeur, &precedent);
+    }
+
+    if (etaitCirculaire) {
+        if (entete->queue != 0) {
+            Noeud(liste, entete->queue)->suivant = entete->tete;
+        }
+        entete->estCirculaire = 1;
+    }
+
+    return compteur;
+}
+
+bool SupprimerPosition(ListePersistante* liste, int position) {
+    if (!EstUtilisable(liste) || position < 0 || position >= CompterElements(liste)) {
+        return false;
+    }
+
+    if (position == 0) {
+        return SupprimerDebut(liste);
+    }
+
+    // Le précédent est obtenu pendant le même parcours que la cible
+    DecalageP precedent = ObtenirNoeudPosition(liste, position - 1);
+    EnteteP* entete = Entete(liste);
+    DecalageP cible = Noeud(liste, precedent)->suivant;
+
+    Noeud(liste, precedent)->suivant = Noeud(liste, cible)->suivant;
+    if (cible == entete->queue) {
+        entete->queue = precedent;
+    }
+    LibererNoeudP(liste, cible);
+    entete->taille--;
+    return true;
+}
+
+// ============================================================================
+// FONCTIONS DE RECHERCHE
+// ============================================================================
+
+DecalageP RechercherValeur(const ListePersistante* liste, int valeur) {
+    if (!EstUtilisable(liste) || EstVide(liste)) {
+        return 0;
+    }
+
+    // taille borne le parcours : inutile de tester le retour à la tête
+    int64_t restants = Entete(liste)->taille;
+    DecalageP precedent = 0;
+    return ChercherDepuisP(liste, Entete(liste)->tete, &restants, valeur, &precedent);
+}
+
+DecalageP ObtenirNoeudPosition(const ListePersistante* liste, int position) {
+    if (!EstUtilisable(liste) || position < 0 || position >= CompterElements(liste)) {
+        return 0;
+    }
+
+    DecalageP courant = Entete(liste)->tete;
+    for (int i = 0; i < position; i++) {
+        courant = Noeud(liste, courant)->suivant;
+    }
+
+    return courant;
+}
+
+DecalageP TrouverPrecedent(const ListePersistante* liste, DecalageP cible) {
+    if (!EstUtilisable(liste) || cible == 0 || EstVide(liste) || cible == Entete(liste)->tete) {
+        return 0;
+    }
+
+    const EnteteP* entete = Entete(liste);
+    DecalageP precedent = entete->tete;
+    for (int64_t i = 1; i < entete->taille; i++) {
+        DecalageP courant = Noeud(liste, precedent)->suivant;
+        if (courant == cible) {
+            return precedent;
+        }
+        precedent = courant;
+    }
+
+    return 0;
+}
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+std::string ToString(const ListePersistante* liste) {
+    if (!EstUtilisable(liste)) {
+        return "ListePersistante[NULL]";
+    }
+
+    if (EstVide(liste)) {
+        return "ListePersistante[]";
+    }
+
+    const EnteteP* entete = Entete(liste);
+    std::string resultat = "ListePersistante[";
+    DecalageP courant = entete->tete;
+    for (int64_t i = 0; i < entete->taille; i++) {
+        if (i > 0) {
+            resultat += " -> ";
+        }
+        const NoeudP* noeud = Noeud(liste, courant);
+        resultat += "Noeud(" + std::to_string(noeud->donnee) + ")";
+        courant = noeud->suivant;
+    }
+
+    resultat += "]";
+    if (entete->estCirculaire) {
+        resultat += " (circulaire)";
+    }
+
+    return resultat;
+}
+
+int CompterElements(const ListePersistante* liste) {
+    if (!EstUtilisable(liste)) {
+        return 0;
+    }
+    return (int)Entete(liste)->taille;
+}
+
+bool EstVide(const ListePersistante* liste) {
+    return !EstUtilisable(liste) || Entete(liste)->tete == 0 || Entete(liste)->taille == 0;
+}
+
+// ============================================================================
+// FONCTIONS DE CONVERSION ET TRANSFORMATION
+// ============================================================================
+
+void RendreCirculaire(ListePersistante* liste) {
+    if (!EstUtilisable(liste) || EstVide(liste) || Entete(liste)->estCirculaire) {
+        return;
+    }
+
+    EnteteP* entete = Entete(liste);
+    Noeud(liste, entete->queue)->suivant = entete->tete;
+    entete->estCirculaire = 1;
+}
+
+void RendreLineaire(ListePersistante* liste) {
+    if (!EstUtilisable(liste) || !Entete(liste)->estCirculaire) {
+        return;
+    }
+
+    EnteteP* entete = Entete(liste);
+    if (entete->queue != 0) {
+        Noeud(liste, entete->queue)->suivant = 0;
+    }
+    entete->estCirculaire = 0;
+}
+
+void Inverser(ListePersistante* liste) {
+    if (!EstUtilisable(liste) || EstVide(liste) || Entete(liste)->tete == Entete(liste)->queue) {
+        return;
+    }
+
+    EnteteP* entete = Entete(liste);
+    DecalageP precedent = 0;
+    DecalageP courant = entete->tete;
+    for (int64_t i = 0; i < entete->taille; i++) {
+        NoeudP* noeud = Noeud(liste, courant);
+        DecalageP suivant = noeud->suivant;
+        noeud->suivant = precedent;
+        precedent = courant;
+        courant = suivant;
+    }
+
+    entete->queue = entete->tete;
+    entete->tete = precedent;
+    Noeud(liste, entete->queue)->suivant = entete->estCirculaire ? entete->tete : 0;
+}
+
+static DecalageP FusionnerChainesP(ListePersistante* liste, DecalageP a, DecalageP b) {
+    DecalageP tete = 0;
+    DecalageP* lien = &tete;
+
+    while (a != 0 && b != 0) {
+        if (Noeud(liste, a)->donnee <= Noeud(liste, b)->donnee) {
+            *lien = a;
+            lien = &Noeud(liste, a)->suivant;
+            a = *lien;
+        } else {
+            *lien = b;
+            lien = &Noeud(liste, b)->suivant;
+            b = *lien;
+        }
+    }
+    *lien = (a != 0) ? a : b;
+
+    return tete;
+}
+
+void Trier(ListePersistante* liste) {
+    if (!EstUtilisable(liste) || EstVide(liste) || Entete(liste)->tete == Entete(liste)->queue) {
+        return;
+    }
+
+    EnteteP* entete = Entete(liste);
+    bool etaitCirculaire = entete->estCirculaire != 0;
+    RendreLineaire(liste);
+
+    // Tri fusion ascendant : largeur de 1, 2, 4... sans récursion ni allocation
+    DecalageP tete = entete->tete;
+    for (int64_t largeur = 1; largeur < entete->taille; largeur *= 2) {
+        DecalageP reste = tete;
+        DecalageP nouvelleTete = 0;
+        DecalageP finFusion = 0;
+
+        while (reste != 0) {
+            DecalageP gauche = reste;
+            DecalageP finGauche = gauche;
+            for (int64_t i = 1; i < largeur && Noeud(liste, finGauche)->suivant != 0; i++) {
+                finGauche = Noeud(liste, finGauche)->suivant;
+            }
+            DecalageP droite = Noeud(liste, finGauche)->suivant;
+            Noeud(liste, finGauche)->suivant = 0;
+
+            DecalageP finDroite = droite;
+            for (int64_t i = 1; i < largeur && finDroite != 0 && Noeud(liste, finDroite)->suivant != 0; i++) {
+                finDroite = Noeud(liste, finDroite)->suivant;
+            }
+            if (finDroite != 0) {
+                reste = Noeud(liste, finDroite)->suivant;
+                Noeud(liste, finDroite)->suivant = 0;
+            } else {
+                reste = 0;
+            }
+
+            DecalageP fusion = FusionnerChainesP(liste, gauche, droite);
+            if (finFusion == 0) {
+                nouvelleTete = fusion;
+            } else {
+                Noeud(liste, finFusion)->suivant = fusion;
+            }
+            finFusion = fusion;
+            while (Noeud(liste, finFusion)->suivant != 0) {
+                finFusion = Noeud(liste, finFusion)->suivant;
+            }
+        }
+
+        tete = nouvelleTete;
+        entete->queue = finFusion;
+    }
+
+    entete->tete = tete;
+    if (etaitCirculaire) {
+        RendreCirculaire(liste);
+    }
+}
@@ -0,0 +1,288 @@
+#ifndef LISTE_PERSISTANTE_H
+#define LISTE_PERSISTANTE_H
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Décalage d'un nœud par rapport au début du fichier projeté
+ *
+ * Les nœuds d'une liste persistante ne contiennent jamais d'adresses brutes :
+ * le fichier peut être projeté à une adresse différente à chaque ouverture.
+ * Le décalage 0 désigne l'en-tête et joue le rôle de NULL.
+ */
+typedef uint64_t DecalageP;
+
+/**
+ * @brief Structure représentant un nœud de liste persistante (format fichier)
+ */
+typedef struct NoeudP {
+    int donnee;             /**< Donnée stockée dans le nœud */
+    int reserve;            /**< Remplissage explicite pour figer le format */
+    DecalageP suivant;      /**< Décalage du nœud suivant (0 = aucun) */
+} NoeudP;
+
+/**
+ * @brief En-tête placé au début du fichier projeté
+ */
+typedef struct EnteteP {
+    uint64_t magie;         /**< Signature du format */
+    uint32_t version;       /**< Version du format */
+    uint32_t tailleNoeud;   /**< sizeof(NoeudP) à la création */
+    uint64_t capacite;      /**< Taille du fichier en octets */
+    uint64_t fin;           /**< Premier octet jamais attribué à un nœud */
+    DecalageP tete;         /**< Décalage du premier nœud */
+    DecalageP queue;        /**< Décalage du dernier nœud */
+    DecalageP libre;        /**< Tête de la liste des emplacements libérés */
+    int64_t taille;         /**< Nombre d'éléments dans la liste */
+    uint32_t estCirculaire; /**< Indique si la liste est circulaire */
+    uint32_t reserve;       /**< Remplissage explicite */
+} EnteteP;
+
+/**
+ * @brief Structure représentant une liste simplement chaînée projetée en mémoire
+ *
+ * La structure elle-même vit en mémoire ordinaire ; seul l'en-tête et les
+ * nœuds résident dans le fichier. Les pointeurs obtenus via ResoudreNoeud
+ * sont invalidés par toute insertion (le fichier peut être agrandi et reprojeté).
+ * Si un agrandissement échoue et que l'ancienne projection ne peut pas non
+ * plus être rétablie, base reste NULL : la liste est alors inutilisable et
+ * toutes les fonctions se comportent comme pour une liste NULL (seule
+ * FermerPersistante reste utile).
+ */
+typedef struct {
+    unsigned char* base;    /**< Adresse de projection (l'en-tête est à base + 0) */
+    uint64_t tailleProjetee;/**< Nombre d'octets actuellement projetés */
+    intptr_t fichier;       /**< Descripteur (POSIX) ou HANDLE (Windows) du fichier */
+    intptr_t projection;    /**< HANDLE de projection (Windows uniquement) */
+} ListePersistante;
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+/**
+ * @brief Ouvre (ou crée) une liste persistante adossée à un fichier
+ *
+ * La réouverture d'un fichier existant est en O(1) : l'en-tête est validé puis
+ * la liste est immédiatement utilisable, sans reconstruction.
+ * @param chemin Chemin du fichier
+ * @return Pointeur vers la liste ouverte, ou NULL si le fichier est invalide
+ */
+ListePersistante* OuvrirPersistante(const char* chemin);
+
+/**
+ * @brief Force l'écriture des pages modifiées sur le disque (msync)
+ * @param liste Pointeur vers la liste
+ * @param bloquant true pour attendre la fin de l'écriture (MS_SYNC), false sinon (MS_ASYNC)
+ * @return true si la synchronisation a réussi, false sinon
+ */
+bool Synchroniser(ListePersistante* liste, bool bloquant = true);
+
+/**
+ * @brief Synchronise puis ferme la liste (le fichier est conservé)
+ * @param liste Pointeur vers la liste à fermer
+ */
+void FermerPersistante(ListePersistante* liste);
+
+/**
+ * @brief Convertit un décalage en pointeur vers le nœud projeté
+ * @param liste Pointeur vers la liste
+ * @param decalage Décalage du nœud
+ * @return Pointeur vers le nœud, ou NULL si le décalage est 0 ou invalide
+ */
+NoeudP* ResoudreNoeud(const ListePersistante* liste, DecalageP decalage);
+
+/**
+ * @brief Vide tous les éléments de la liste (les emplacements sont recyclés)
+ * @param liste Pointeur vers la liste à vider
+ */
+void Nettoyer(ListePersistante* liste);
+
+// ============================================================================
+// FONCTIONS D'INSERTION
+// ============================================================================
+
+/**
+ * @brief Insère un élément au début de la liste persistante
+ * @param liste Pointeur vers la liste
+ * @param valeur Valeur à insérer
+ * @return true si l'insertion a réussi, false si le fichier n'a pas pu grandir
+ */
+bool InsererDebut(ListePersistante* liste, int valeur);
+
+/**
+ * @brief Insère un élément à la fin de la liste persistante
+ * @param liste Pointeur vers la liste
+ * @param valeur Valeur à insérer
+ * @return true si l'insertion a réussi, false si le fichier n'a pas pu grandir
+ */
+bool InsererFin(ListePersistante* liste, int valeur);
+
+/**
+ * @brief Insère un élément après un nœud donné
+ * @param liste Pointeur vers la liste
+ * @param precedent Décalage du nœud après lequel insérer
+ * @param valeur Valeur à insérer
+ * @return true si l'insertion a réussi, false sinon
+ */
+bool InsererApres(ListePersistante* liste, DecalageP precedent, int valeur);
+
+/**
+ * @brief Insère un élément avant un nœud donné
+ * @param liste Pointeur vers la liste
+ * @param suivant Décalage du nœud avant lequel insérer
+ * @param valeur Valeur à insérer
+ * @return true si l'insertion a réussi, false sinon
+ */
+bool InsererAvant(ListePersistante* liste, DecalageP suivant, int valeur);
+
+/**
+ * @brief Insère un élément à une position spécifique
+ * @param liste Pointeur vers la liste
+ * @param position Position où insérer (0-based)
+ * @param valeur Valeur à insérer
+ * @return true si l'insertion a réussi, false si position invalide
+ */
+bool InsererPosition(ListePersistante* liste, int position, int valeur);
+
+/**
+ * @brief Insère un élément dans une liste triée (maintenant l'ordre)
+ * @param liste Pointeur vers la liste
+ * @param valeur Valeur à insérer
+ * @return true si l'insertion a réussi, false sinon
+ */
+bool InsererTrie(ListePersistante* liste, int valeur);
+
+// ============================================================================
+// FONCTIONS DE SUPPRESSION
+// ============================================================================
+
+/**
+ * @brief Supprime le premier élément de la liste persistante
+ * @param liste Pointeur vers la liste
+ * @return true si la suppression a réussi, false si liste vide
+ */
+bool SupprimerDebut(ListePersistante* liste);
+
+/**
+ * @brief Supprime le dernier élément de la liste persistante
+ * @param liste Pointeur vers la liste
+ * @return true si la suppression a réussi, false si liste vide
+ */
+bool SupprimerFin(ListePersistante* liste);
+
+/**
+ * @brief Supprime un nœud spécifique de la liste persistante
+ * @param liste Pointeur vers la liste
+ * @param cible Décalage du nœud à supprimer
+ * @return true si la suppression a réussi, false si nœud non trouvé
+ */
+bool SupprimerNoeud(ListePersistante* liste, DecalageP cible);
+
+/**
+ * @brief Supprime la première occurrence d'une valeur
+ * @param liste Pointeur vers la liste
+ * @param valeur Valeur à supprimer
+ * @return true si la suppression a réussi, false si valeur non trouvée
+ */
+bool SupprimerValeur(ListePersistante* liste, int valeur);
+
+/**
+ * @brief Supprime toutes les occurrences d'une valeur
+ * @param liste Pointeur vers la liste
+ * @param valeur Valeur à supprimer
+ * @return Nombre d'éléments supprimés
+ */
+int SupprimerToutesOccurrences(ListePersistante* liste, int valeur);
+
+/**
+ * @brief Supprime l'élément à une position spécifique
+ * @param liste Pointeur vers la liste
+ * @param position Position à supprimer (0-based)
+ * @return true si la suppression a réussi, false si position invalide
+ */
+bool SupprimerPosition(ListePersistante* liste, int position);
+
+// ============================================================================
+// FONCTIONS DE RECHERCHE
+// ============================================================================
+
+/**
+ * @brief Recherche la première occurrence d'une valeur
+ * @param liste Pointeur vers la liste
+ * @param valeur Valeur à rechercher
+ * @return Décalage du nœud trouvé, ou 0 si non trouvé
+ */
+DecalageP RechercherValeur(const ListePersistante* liste, int valeur);
+
+/**
+ * @brief Récupère le nœud à une position spécifique
+ * @param liste Pointeur vers la liste
+ * @param position Position souhaitée (0-based)
+ * @return Décalage du nœud, ou 0 si position invalide
+ */
+DecalageP ObtenirNoeudPosition(const ListePersistante* liste, int position);
+
+/**
+ * @brief Trouve le nœud précédent un nœud donné
+ * @param liste Pointeur vers la liste
+ * @param cible Décalage du nœud cible
+ * @return Décalage du nœud précédent, ou 0 si non trouvé
+ */
+DecalageP TrouverPrecedent(const ListePersistante* liste, DecalageP cible);
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+/**
+ * @brief Convertit une liste persistante en représentation string
+ * @param liste Pointeur vers la liste à convertir
+ * @return Représentation string de la liste
+ */
+std::string ToString(const ListePersistante* liste);
+
+/**
+ * @brief Compte le nombre d'éléments dans la liste persistante
+ * @param liste Pointeur vers la liste
+ * @return Nombre d'éléments
+ */
+int CompterElements(const ListePersistante* liste);
+
+/**
+ * @brief Vérifie si la liste persistante est vide
+ * @param liste Pointeur vers la liste
+ * @return true si la liste est vide, false sinon
+ */
+bool EstVide(const ListePersistante* liste);
+
+// ============================================================================
+// FONCTIONS DE CONVERSION ET TRANSFORMATION
+// ============================================================================
+
+/**
+ * @brief Convertit la liste persistante en liste circulaire
+ * @param liste Pointeur vers la liste
+ */
+void RendreCirculaire(ListePersistante* liste);
+
+/**
+ * @brief Convertit la liste persistante circulaire en liste linéaire
+ * @param liste Pointeur vers la liste
+ */
+void RendreLineaire(ListePersistante* liste);
+
+/**
+ * @brief Inverse l'ordre des éléments dans la liste persistante
+ * @param liste Pointeur vers la liste
+ */
+void Inverser(ListePersistante* liste);
+
+/**
+ * @brief Trie la liste persistante en ordre croissant (tri fusion sur les décalages)
+ * @param liste Pointeur vers la liste
+ */
+void Trier(ListePersistante* liste);
+
+#endif
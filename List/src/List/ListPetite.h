@@ -0,0 +1,745 @@
+#ifndef LISTE_PETITE_H
+#define LISTE_PETITE_H
+
+#include "ListS.h"
+#include "ListSIMD.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <string>
+
+/**
+ * Petite liste simple : les N premières valeurs sont rangées dans l'en-tête
+ * même de la liste, les suivantes dans une ListeSimple de débordement
+ * embarquée. Tant que la liste ne dépasse pas N éléments, aucune allocation
+ * n'a lieu en dehors de l'en-tête (qui peut vivre sur la pile ou dans un
+ * tableau de listes).
+ *
+ * Invariant : le débordement n'est non vide que si la zone locale est
+ * pleine. Une insertion dans une zone pleine repousse la dernière valeur
+ * locale en tête du débordement ; une suppression locale y reprend la tête.
+ *
+ * Les opérations reprennent la sémantique de ListS.h, avec des positions au
+ * lieu de nœuds. Les opérations globales (tri, inversion, rotations...) sur
+ * une liste qui déborde déversent la zone locale dans le débordement,
+ * appellent la fonction de ListS.h puis rechargent la zone locale, soit 2N
+ * opérations de nœud en plus. Une petite liste est toujours linéaire.
+ *
+ * @tparam N Capacité de la zone locale (au moins 1)
+ */
+template <int N>
+struct ListePetiteS {
+    static_assert(N >= 1, "La zone locale doit contenir au moins une valeur");
+
+    int locales[N];           /**< Premières valeurs de la liste */
+    int nombreLocales;        /**< Valeurs occupées dans locales */
+    ListeSimple debordement;  /**< Valeurs au-delà des N premières */
+};
+
+// ============================================================================
+// GESTION DE LA ZONE LOCALE (usage interne)
+// ============================================================================
+
+/**
+ * @brief Déplace toutes les valeurs locales en tête du débordement
+ * @return true si la liste est désormais entièrement dans le débordement
+ * @note En cas d'échec d'allocation, la liste est laissée intacte
+ */
+template <int N>
+bool DeverserPetiteS(ListePetiteS<N>* liste) {
+    int deplacees = 0;
+    for (int i = liste->nombreLocales - 1; i >= 0; i--) {
+        int tailleAvant = liste->debordement.taille;
+        InsererDebut(&liste->debordement, liste->locales[i]);
+        if (liste->debordement.taille == tailleAvant) {
+            // Remettre la liste dans son état initial
+            for (int j = 0; j < deplacees; j++) {
+                SupprimerDebut(&liste->debordement);
+            }
+            return false;
+        }
+        deplacees++;
+    }
+    liste->nombreLocales = 0;
+    return true;
+}
+
+/**
+ * @brief Complète la zone locale avec la tête du débordement
+ */
+template <int N>
+void RemplirPetiteS(ListePetiteS<N>* liste) {
+    while (liste->nombreLocales < N && liste->debordement.tete != nullptr) {
+        liste->locales[liste->nombreLocales++] = liste->debordement.tete->donnee;
+        SupprimerDebut(&liste->debordement);
+    }
+}
+
+/**
+ * @brief Applique une opération de ListS.h à la liste vue comme une seule chaîne
+ * @return false si la zone locale n'a pas pu être déversée (liste inchangée)
+ */
+template <int N, typename Operation>
+bool AppliquerPetiteS(ListePetiteS<N>* liste, Operation operation) {
+    if (!DeverserPetiteS(liste)) {
+        return false;
+    }
+    operation(&liste->debordement);
+    RemplirPetiteS(liste);
+    return true;
+}
+
+/**
+ * @brief Ramène un décalage vers la gauche dans [0, taille)
+ */
+inline int ReduireDecalagePetiteS(long long k, int taille) {
+    long long reste = k % taille;
+    return (int)(reste < 0 ? reste + taille : reste);
+}
+
+/**
+ * @brief Inverse les nombre premiers nœuds d'une chaîne
+ * @return Nouveau premier nœud (l'ancien premier pointe alors sur NULL)
+ */
+inline NoeudS* InverserSegmentPetiteS(NoeudS* premier, int nombre) {
+    NoeudS* precedent = nullptr;
+    NoeudS* courant = premier;
+    for (int i = 0; i < nombre; i++) {
+        NoeudS* suivant = courant->suivant;
+        courant->suivant = precedent;
+        precedent = courant;
+        courant = suivant;
+    }
+    return precedent;
+}
+
+// ============================================================================
+// PARCOURS
+// ============================================================================
+
+/**
+ * @brief Itérateur avant en lecture seule sur les valeurs d'une petite liste
+ *
+ * Parcourt la zone locale puis le débordement. Toute insertion ou
+ * suppression invalide les itérateurs en cours.
+ */
+template <int N>
+class IterateurPetiteS {
+public:
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = int;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const int*;
+    using reference = const int&;
+
+    IterateurPetiteS() = default;
+
+    IterateurPetiteS(const ListePetiteS<N>* liste, int index)
+        : liste_(liste), noeud_(nullptr), index_(index) {
+        if (liste_ != nullptr && index_ >= liste_->nombreLocales) {
+            noeud_ = ObtenirNoeudPosition(&liste_->debordement, index_ - liste_->nombreLocales);
+        }
+    }
+
+    reference operator*() const {
+        return index_ < liste_->nombreLocales ? liste_->locales[index_] : noeud_->donnee;
+    }
+    pointer operator->() const { return &**this; }
+
+    IterateurPetiteS& operator++() {
+        index_++;
+        if (index_ == liste_->nombreLocales) {
+            noeud_ = liste_->debordement.tete;
+        } else if (index_ > liste_->nombreLocales) {
+            noeud_ = noeud_->suivant;
+        }
+        return *this;
+    }
+
+    IterateurPetiteS operator++(int) {
+        IterateurPetiteS copie = *this;
+        ++*this;
+        return copie;
+    }
+
+    friend bool operator==(const IterateurPetiteS& a, const IterateurPetiteS& b) {
+        return a.index_ == b.index_;
+    }
+
+    /** @brief Position courante (taille en fin de parcours) */
+    int Index() const { return index_; }
+
+private:
+    const ListePetiteS<N>* liste_ = nullptr;
+    NoeudS* noeud_ = nullptr;
+    int index_ = 0;
+};
+
+template <int N>
+IterateurPetiteS<N> begin(const ListePetiteS<N>& liste) {
+    return IterateurPetiteS<N>(&liste, 0);
+}
+
+template <int N>
+IterateurPetiteS<N> end(const ListePetiteS<N>& liste) {
+    return IterateurPetiteS<N>(&liste, liste.nombreLocales + liste.debordement.taille);
+}
+
+template <int N>
+IterateurPetiteS<N> begin(ListePetiteS<N>& liste) {
+    return begin(static_cast<const ListePetiteS<N>&>(liste));
+}
+
+template <int N>
+IterateurPetiteS<N> end(ListePetiteS<N>& liste) {
+    return end(static_cast<const ListePetiteS<N>&>(liste));
+}
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+/**
+ * @brief Prépare une petite liste vide (aucune allocation)
+ * @param liste Liste à initialiser (contenu précédent ignoré)
+ */
+template <int N>
+void Initialiser(ListePetiteS<N>* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    liste->nombreLocales = 0;
+    liste->debordement.tete = nullptr;
+    liste->debordement.queue = nullptr;
+    liste->debordement.taille = 0;
+    liste->debordement.estCirculaire = false;
+    liste->debordement.estAllouee = false;
+    liste->debordement.sauts = nullptr;
+    liste->debordement.capaciteSauts = 0;
+}
+
+/**
+ * @brief Crée une petite liste vide
+ * @return Liste à passer à Nettoyer avant de sortir de portée
+ */
+template <int N>
+ListePetiteS<N> CreerPetiteS() {
+    ListePetiteS<N> liste;
+    Initialiser(&liste);
+    return liste;
+}
+
+/**
+ * @brief Vide la liste et libère les nœuds de débordement
+ * @param liste Liste à vider
+ */
+template <int N>
+void Nettoyer(ListePetiteS<N>* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    Nettoyer(&liste->debordement);
+    liste->nombreLocales = 0;
+}
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+template <int N>
+int CompterElements(const ListePetiteS<N>* liste) {
+    return liste == nullptr ? 0 : liste->nombreLocales + liste->debordement.taille;
+}
+
+template <int N>
+bool EstVide(const ListePetiteS<N>* liste) {
+    return CompterElements(liste) == 0;
+}
+
+/**
+ * @brief Indique si la liste a dépassé sa zone locale
+ * @return true si des nœuds de débordement sont alloués
+ */
+template <int N>
+bool Deborde(const ListePetiteS<N>* liste) {
+    return liste != nullptr && liste->debordement.taille > 0;
+}
+
+/**
+ * @brief Représentation au même format que ToString(const ListeSimple*)
+ */
+template <int N>
+std::string ToString(const ListePetiteS<N>* liste) {
+    if (liste == nullptr) {
+        return "Liste[NULL]";
+    }
+    std::string resultat = "Liste[";
+    bool premier = true;
+    for (int valeur : *liste) {
+        if (!premier) {
+            resultat += " -> ";
+        }
+        resultat += "Noeud(" + std::to_string(valeur) + ")";
+        premier = false;
+    }
+    return resultat + "]";
+}
+
+// ============================================================================
+// FONCTIONS D'INSERTION
+// ============================================================================
+
+/**
+ * @brief Insère une valeur à une position donnée
+ * @param position Position dans [0, taille]
+ * @return false si la position est invalide ou si l'allocation échoue
+ */
+template <int N>
+bool InsererPosition(ListePetiteS<N>* liste, int position, int valeur) {
+    if (liste == nullptr || position < 0 || position > CompterElements(liste)) {
+        return false;
+    }
+
+    // Au-delà de la zone locale (pleine dans ce cas)
+    if (position >= N) {
+        return InsererPosition(&liste->debordement, position - N, valeur);
+    }
+
+    if (liste->nombreLocales == N) {
+        int tailleAvant = liste->debordement.taille;
+        InsererDebut(&liste->debordement, liste->locales[N - 1]);
+        if (liste->debordement.taille == tailleAvant) {
+            return false;
+        }
+        liste->nombreLocales--;
+    }
+
+    std::copy_backward(liste->locales + position, liste->locales + liste->nombreLocales,
+                       liste->locales + liste->nombreLocales + 1);
+    liste->locales[position] = valeur;
+    liste->nombreLocales++;
+    return true;
+}
+
+template <int N>
+void InsererDebut(ListePetiteS<N>* liste, int valeur) {
+    InsererPosition(liste, 0, valeur);
+}
+
+template <int N>
+void InsererFin(ListePetiteS<N>* liste, int valeur) {
+    if (liste == nullptr) {
+        return;
+    }
+    if (liste->nombreLocales < N) {
+        liste->locales[liste->nombreLocales++] = valeur;
+    } else {
+        InsererFin(&liste->debordement, valeur);
+    }
+}
+
+/**
+ * @brief Insère une valeur dans une liste triée en conservant l'ordre
+ */
+template <int N>
+void InsererTrie(ListePetiteS<N>* liste, int valeur) {
+    if (liste == nullptr) {
+        return;
+    }
+
+    // Première position dont la valeur n'est pas inférieure
+    int position = (int)(std::lower_bound(liste->locales, liste->locales + liste->nombreLocales, valeur) -
+                         liste->locales);
+    if (position == N) {
+        for (NoeudS* noeud = liste->debordement.tete; noeud != nullptr && noeud->donnee < valeur;
+             noeud = noeud->suivant) {
+            position++;
+        }
+    }
+    InsererPosition(liste, position, valeur);
+}
+
+// ============================================================================
+// FONCTIONS DE SUPPRESSION
+// ============================================================================
+
+/**
+ * @brief Supprime la valeur d'une position donnée
+ * @param position Position dans [0, taille)
+ * @return false si la position est invalide
+ */
+template <int N>
+bool SupprimerPosition(ListePetiteS<N>* liste, int position) {
+    if (liste == nullptr || position < 0 || position >= CompterElements(liste)) {
+        return false;
+    }
+
+    if (position >= liste->nombreLocales) {
+        return SupprimerPosition(&liste->debordement, position - N);
+    }
+
+    std::copy(liste->locales + position + 1, liste->locales + liste->nombreLocales,
+              liste->locales + position);
+    liste->nombreLocales--;
+    RemplirPetiteS(liste);
+    return true;
+}
+
+template <int N>
+bool SupprimerDebut(ListePetiteS<N>* liste) {
+    return SupprimerPosition(liste, 0);
+}
+
+template <int N>
+bool SupprimerFin(ListePetiteS<N>* liste) {
+    if (liste == nullptr || EstVide(liste)) {
+        return false;
+    }
+    if (Deborde(liste)) {
+        return SupprimerFin(&liste->debordement);
+    }
+    liste->nombreLocales--;
+    return true;
+}
+
+/**
+ * @brief Recherche la première occurrence d'une valeur
+ * @return Position de la valeur, ou -1 si absente
+ */
+template <int N>
+int RechercherValeur(const ListePetiteS<N>* liste, int valeur) {
+    if (liste == nullptr) {
+        return -1;
+    }
+
+    int index = ChercherEntier(liste->locales, liste->nombreLocales, valeur);
+    if (index >= 0) {
+        return index;
+    }
+
+    index = N;
+    for (NoeudS* noeud = liste->debordement.tete; noeud != nullptr; noeud = noeud->suivant, index++) {
+        if (noeud->donnee == valeur) {
+            return index;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Supprime la première occurrence d'une valeur
+ * @return true si une valeur a été supprimée
+ */
+template <int N>
+bool SupprimerValeur(ListePetiteS<N>* liste, int valeur) {
+    int position = RechercherValeur(liste, valeur);
+    return position >= 0 && SupprimerPosition(liste, position);
+}
+
+/**
+ * @brief Supprime toutes les occurrences d'une valeur
+ * @return Nombre de valeurs supprimées
+ */
+template <int N>
+int SupprimerToutesOccurrences(ListePetiteS<N>* liste, int valeur) {
+    if (liste == nullptr) {
+        return 0;
+    }
+
+    int supprimees = 0;
+    if (CompterEntier(liste->locales, liste->nombreLocales, valeur) > 0) {
+        int* fin = std::remove(liste->locales, liste->locales + liste->nombreLocales, valeur);
+        supprimees = liste->nombreLocales - (int)(fin - liste->locales);
+        liste->nombreLocales -= supprimees;
+    }
+    supprimees += SupprimerToutesOccurrences(&liste->debordement, valeur);
+    RemplirPetiteS(liste);
+    return supprimees;
+}
+
+// ============================================================================
+// FONCTIONS D'ACCÈS
+// ============================================================================
+
+/**
+ * @brief Lit la valeur d'une position donnée
+ * @param position Position dans [0, taille)
+ * @param valeur Reçoit la valeur lue
+ * @return false si la position est invalide
+ */
+template <int N>
+bool ObtenirValeur(const ListePetiteS<N>* liste, int position, int* valeur) {
+    if (liste == nullptr || valeur == nullptr || position < 0 || position >= CompterElements(liste)) {
+        return false;
+    }
+    if (position < liste->nombreLocales) {
+        *valeur = liste->locales[position];
+    } else {
+        *valeur = ObtenirNoeudPosition(&liste->debordement, position - N)->donnee;
+    }
+    return true;
+}
+
+/**
+ * @brief Position du milieu (le second des deux pour une taille paire)
+ * @return taille / 2, ou -1 si la liste est vide
+ */
+template <int N>
+int TrouverMilieu(const ListePetiteS<N>* liste) {
+    return EstVide(liste) ? -1 : CompterElements(liste) / 2;
+}
+
+/**
+ * @brief Vérifie si la liste se lit de la même façon dans les deux sens
+ * @note Une liste qui déborde retourne temporairement la seconde moitié de
+ *       ses nœuds : pas de lecture concurrente pendant l'appel
+ */
+template <int N>
+bool EstPalindrome(const ListePetiteS<N>* liste) {
+    int taille = CompterElements(liste);
+    if (taille < 2) {
+        return true;
+    }
+
+    int moitie = taille / 2;
+    if (!Deborde(liste)) {
+        return std::equal(liste->locales, liste->locales + moitie,
+                          std::make_reverse_iterator(liste->locales + taille));
+    }
+
+    // Part de la seconde moitié rangée dans le débordement, retournée sur place
+    int debutSegment = std::max(N, taille - moitie);
+    int nombreSegment = taille - debutSegment;
+    NoeudS* premierSegment = debutSegment > N
+        ? ObtenirNoeudPosition(&liste->debordement, debutSegment - N - 1)->suivant
+        : liste->debordement.tete;
+    NoeudS* retourne = InverserSegmentPetiteS(premierSegment, nombreSegment);
+
+    // La première moitié s'arrête avant debutSegment : elle ne croise jamais
+    // les nœuds retournés
+    bool estPalindrome = true;
+    NoeudS* avant = liste->debordement.tete;
+    NoeudS* arriere = retourne;
+    for (int i = 0; i < moitie && estPalindrome; i++) {
+        int gauche;
+        if (i < N) {
+            gauche = liste->locales[i];
+        } else {
+            gauche = avant->donnee;
+            avant = avant->suivant;
+        }
+
+        int droite;
+        int miroir = taille - 1 - i;
+        if (miroir >= debutSegment) {
+            droite = arriere->donnee;
+            arriere = arriere->suivant;
+        } else {
+            droite = liste->locales[miroir];
+        }
+        estPalindrome = gauche == droite;
+    }
+
+    InverserSegmentPetiteS(retourne, nombreSegment);
+    return estPalindrome;
+}
+
+// ============================================================================
+// FONCTIONS DE MANIPULATION
+// ============================================================================
+
+template <int N>
+void Inverser(ListePetiteS<N>* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    if (!Deborde(liste)) {
+        std::reverse(liste->locales, liste->locales + liste->nombreLocales);
+        return;
+    }
+    AppliquerPetiteS(liste, [](ListeSimple* chaine) { Inverser(chaine); });
+}
+
+template <int N>
+void Trier(ListePetiteS<N>* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    if (!Deborde(liste)) {
+        std::sort(liste->locales, liste->locales + liste->nombreLocales);
+        return;
+    }
+    AppliquerPetiteS(liste, [](ListeSimple* chaine) { Trier(chaine); });
+}
+
+/**
+ * @brief Copie une petite liste (même capacité locale)
+ * @return Copie indépendante ; vide si l'allocation du débordement échoue
+ */
+template <int N>
+ListePetiteS<N> Copier(const ListePetiteS<N>* liste) {
+    ListePetiteS<N> copie = CreerPetiteS<N>();
+    if (liste == nullptr) {
+        return copie;
+    }
+
+    std::copy(liste->locales, liste->locales + liste->nombreLocales, copie.locales);
+    copie.nombreLocales = liste->nombreLocales;
+
+    if (Deborde(liste)) {
+        ListeSimple* chaine = Copier(&liste->debordement);
+        if (chaine == nullptr) {
+            copie.nombreLocales = 0;
+            return copie;
+        }
+        copie.debordement = *chaine;
+        copie.debordement.estAllouee = false;
+        free(chaine);
+    }
+    return copie;
+}
+
+/**
+ * @brief Ajoute une copie des valeurs de liste2 à la fin de liste1
+ * @note liste1 et liste2 peuvent désigner la même liste
+ */
+template <int N, int M>
+void Concatener(ListePetiteS<N>* liste1, const ListePetiteS<M>* liste2) {
+    if (liste1 == nullptr || liste2 == nullptr) {
+        return;
+    }
+
+    // La borne est fixée avant d'ajouter : l'auto-concaténation double la liste
+    int nombre = CompterElements(liste2);
+    IterateurPetiteS<M> courant = begin(*liste2);
+    for (int i = 0; i < nombre; i++, ++courant) {
+        InsererFin(liste1, *courant);
+    }
+}
+
+/**
+ * @brief Coupe la liste : liste garde [0, position), liste2 reçoit le reste
+ * @param position Même domaine que Diviser(ListeSimple*) : [1, taille - 2]
+ */
+template <int N>
+void Diviser(ListePetiteS<N>* liste, int position, ListePetiteS<N>* liste2) {
+    if (liste == nullptr || liste2 == nullptr || liste == liste2 || position < 1 ||
+        position >= CompterElements(liste) - 1) {
+        return;
+    }
+
+    Nettoyer(liste2);
+    IterateurPetiteS<N> fin = end(*liste);
+    for (IterateurPetiteS<N> courant(liste, position); courant != fin; ++courant) {
+        InsererFin(liste2, *courant);
+    }
+
+    if (position <= N) {
+        Nettoyer(&liste->debordement);
+        liste->nombreLocales = position;
+        return;
+    }
+
+    // Libérer les nœuds de débordement au-delà de la nouvelle queue
+    NoeudS* queue = ObtenirNoeudPosition(&liste->debordement, position - N - 1);
+    NoeudS* noeud = queue->suivant;
+    while (noeud != nullptr) {
+        NoeudS* suivant = noeud->suivant;
+        free(noeud);
+        noeud = suivant;
+    }
+    queue->suivant = nullptr;
+    liste->debordement.queue = queue;
+    liste->debordement.taille = position - N;
+}
+
+template <int N>
+void SupprimerDoublonsTries(ListePetiteS<N>* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    if (!Deborde(liste)) {
+        liste->nombreLocales = (int)(std::unique(liste->locales, liste->locales + liste->nombreLocales) -
+                                     liste->locales);
+        return;
+    }
+    AppliquerPetiteS(liste, [](ListeSimple* chaine) { SupprimerDoublonsTries(chaine); });
+}
+
+/**
+ * @brief Supprime les doublons en gardant la première occurrence de chaque valeur
+ */
+template <int N>
+void SupprimerDoublonsNonTries(ListePetiteS<N>* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    if (!Deborde(liste)) {
+        int gardees = 0;
+        for (int i = 0; i < liste->nombreLocales; i++) {
+            if (ChercherEntier(liste->locales, gardees, liste->locales[i]) < 0) {
+                liste->locales[gardees++] = liste->locales[i];
+            }
+        }
+        liste->nombreLocales = gardees;
+        return;
+    }
+    AppliquerPetiteS(liste, [](ListeSimple* chaine) { SupprimerDoublonsNonTries(chaine); });
+}
+
+/**
+ * @brief Fusionne deux listes triées dans une nouvelle liste
+ * @return Liste triée contenant une copie des valeurs des deux listes
+ */
+template <int N>
+ListePetiteS<N> FusionnerListesTriees(const ListePetiteS<N>* liste1, const ListePetiteS<N>* liste2) {
+    ListePetiteS<N> resultat = CreerPetiteS<N>();
+    if (liste1 == nullptr || liste2 == nullptr) {
+        return resultat;
+    }
+
+    IterateurPetiteS<N> a = begin(*liste1), finA = end(*liste1);
+    IterateurPetiteS<N> b = begin(*liste2), finB = end(*liste2);
+    while (a != finA || b != finB) {
+        if (b == finB || (a != finA && *a <= *b)) {
+            InsererFin(&resultat, *a++);
+        } else {
+            InsererFin(&resultat, *b++);
+        }
+    }
+    return resultat;
+}
+
+/**
+ * @brief Rotation : les k premières valeurs passent en fin de liste
+ * @param k Décalage (négatif : rotation dans l'autre sens)
+ */
+template <int N>
+void RotationGauche(ListePetiteS<N>* liste, int k) {
+    int taille = CompterElements(liste);
+    if (taille < 2) {
+        return;
+    }
+    if (!Deborde(liste)) {
+        int decalage = ReduireDecalagePetiteS(k, taille);
+        std::rotate(liste->locales, liste->locales + decalage, liste->locales + taille);
+        return;
+    }
+    AppliquerPetiteS(liste, [k](ListeSimple* chaine) { RotationGauche(chaine, k); });
+}
+
+/**
+ * @brief Rotation : les k dernières valeurs passent en tête de liste
+ */
+template <int N>
+void RotationDroite(ListePetiteS<N>* liste, int k) {
+    int taille = CompterElements(liste);
+    if (taille < 2) {
+        return;
+    }
+    RotationGauche(liste, ReduireDecalagePetiteS(-(long long)k, taille));
+}
+
+#endif
@@ -0,0 +1,333 @@
+#include "ListPile.h"
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Marque d'une case dont l'offre vient d'être prise par un dépilement
+ */
+#define PILE_CASE_PRISE ((uintptr_t)1)
+
+// ============================================================================
+// PILE DE TREIBER ÉLÉMENTAIRE (usage interne, tête et réserve)
+// ============================================================================
+
+/**
+ * @brief Une tentative d'empilement de la chaîne premier..dernier
+ * @return true si le compare-and-swap a réussi
+ */
+static bool TenterEmpiler(std::atomic<PointeurMarque>* tete, NoeudS* premier, NoeudS* dernier) {
+    PointeurMarque ancien = tete->load(std::memory_order_relaxed);
+    EcrireSuivant(dernier, AdresseDe<NoeudS>(ancien), std::memory_order_relaxed);
+    return tete->compare_exchange_weak(ancien, Remplacer(ancien, premier),
+                                       std::memory_order_release, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Une tentative de dépilement
+ * @param sommet Reçoit le nœud dépilé, qui appartient alors à l'appelant
+ * @return 1 si un nœud a été dépilé, 0 si la pile est vide, -1 si le compare-and-swap a échoué
+ */
+static int TenterDepiler(std::atomic<PointeurMarque>* tete, NoeudS** sommet) {
+    PointeurMarque ancien = tete->load(std::memory_order_acquire);
+    NoeudS* premier = AdresseDe<NoeudS>(ancien);
+    if (premier == nullptr) {
+        return 0;
+    }
+
+    // premier a pu être dépilé et réempilé entre-temps : le lien lu est alors
+    // périmé, mais la marque fera échouer l'échange
+    NoeudS* suivant = LireSuivant(premier, std::memory_order_relaxed);
+    if (tete->compare_exchange_weak(ancien, Remplacer(ancien, suivant),
+                                    std::memory_order_acquire, std::memory_order_relaxed)) {
+        *sommet = premier;
+        return 1;
+    }
+    return -1;
+}
+
+// ============================================================================
+// RÉSERVE DE NŒUDS (usage interne)
+// ============================================================================
+
+/**
+ * @brief Range un nœud dépilé dans la réserve (jamais rendu à free avant Detruire)
+ */
+static void RendreNoeud(PileConcurrente* pile, NoeudS* noeud) {
+    ReculExponentiel recul = CreerRecul();
+    while (!TenterEmpiler(&pile->reserve, noeud, noeud)) {
+        Reculer(&recul);
+    }
+}
+
+/**
+ * @brief Reprend un nœud de la réserve, ou en alloue un
+ */
+static NoeudS* ObtenirNoeud(PileConcurrente* pile) {
+    ReculExponentiel recul = CreerRecul();
+    NoeudS* noeud = nullptr;
+    int resultat;
+    while ((resultat = TenterDepiler(&pile->reserve, &noeud)) < 0) {
+        Reculer(&recul);
+    }
+    if (resultat == 1) {
+        return noeud;
+    }
+    return (NoeudS*)malloc(sizeof(NoeudS));
+}
+
+static void LibererChaine(NoeudS* noeud) {
+    while (noeud != nullptr) {
+        NoeudS* suivant = noeud->suivant;
+        free(noeud);
+        noeud = suivant;
+    }
+}
+
+// ============================================================================
+// ÉLIMINATION (usage interne)
+// ============================================================================
+
+/**
+ * @brief Case tirée au hasard (générateur xorshift propre à chaque thread)
+ */
+static CaseElimination* CaseAuHasard(PileConcurrente* pile) {
+    static thread_local uint32_t etat = 0;
+    if (etat == 0) {
+        etat = (uint32_t)std::hash<std::thread::id>()(std::this_thread::get_id()) | 1u;
+    }
+    etat ^= etat << 13;
+    etat ^= etat >> 17;
+    etat ^= etat << 5;
+    return &pile->elimination[etat % PILE_ELIMINATION_CASES];
+}
+
+/**
+ * @brief Offre un nœud à un dépilement concurrent
+ * @return true si un dépilement l'a pris (l'empilement est alors terminé)
+ */
+static bool OffrirNoeud(PileConcurrente* pile, NoeudS* noeud) {
+    CaseElimination* caseElim = CaseAuHasard(pile);
+    uintptr_t attendu = 0;
+    if (!caseElim->offre.compare_exchange_strong(attendu, (uintptr_t)noeud,
+                                                 std::memory_order_release, std::memory_order_relaxed)) {
+        return false;
+    }
+
+    for (int i = 0; i < PILE_ELIMINATION_ATTENTE; i++) {
+        if (caseElim->offre.load(std::memory_order_acquire) == PILE_CASE_PRISE) {
+            caseElim->offre.store(0, std::memory_order_release);
+            return true;
+        }
+        PauseProcesseur();
+    }
+
+    // Retirer l'offre ; si le retrait échoue, un dépilement l'a prise entre-temps
+    attendu = (uintptr_t)noeud;
+    if (caseElim->offre.compare_exchange_strong(attendu, 0, std::memory_order_acquire, std::memory_order_acquire)) {
+        return false;
+    }
+    caseElim->offre.store(0, std::memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Prend le nœud offert par un empilement concurrent, s'il y en a un
+ * @return true si une offre a été prise (le dépilement est alors terminé)
+ */
+static bool PrendreOffre(PileConcurrente* pile, int* valeur) {
+    CaseElimination* caseElim = CaseAuHasard(pile);
+    uintptr_t offre = caseElim->offre.load(std::memory_order_acquire);
+    if (offre == 0 || offre == PILE_CASE_PRISE) {
+        return false;
+    }
+    if (!caseElim->offre.compare_exchange_strong(offre, PILE_CASE_PRISE,
+                                                 std::memory_order_acquire, std::memory_order_relaxed)) {
+        return false;
+    }
+
+    // L'empilement ne touche plus au nœud une fois la case marquée
+    NoeudS* noeud = (NoeudS*)offre;
+    if (valeur != nullptr) {
+        *valeur = noeud->donnee;
+    }
+    RendreNoeud(pile, noeud);
+    return true;
+}
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+PileConcurrente* AllocatePileConcurrente() {
+    PileConcurrente* pile = new (std::nothrow) PileConcurrente;
+    if (pile == nullptr) {
+        return nullptr;
+    }
+    pile->tete.store(Marquer(nullptr, 0), std::memory_order_relaxed);
+    pile->reserve.store(Marquer(nullptr, 0), std::memory_order_relaxed);
+    pile->taille.store(0, std::memory_order_relaxed);
+    for (int i = 0; i < PILE_ELIMINATION_CASES; i++) {
+        pile->elimination[i].offre.store(0, std::memory_order_relaxed);
+    }
+    return pile;
+}
+
+void Detruire(PileConcurrente* pile) {
+    if (pile == nullptr) {
+        return;
+    }
+    LibererChaine(AdresseDe<NoeudS>(pile->tete.load(std::memory_order_acquire)));
+    LibererChaine(AdresseDe<NoeudS>(pile->reserve.load(std::memory_order_acquire)));
+    delete pile;
+}
+
+bool InsererListe(PileConcurrente* pile, ListeSimple* source) {
+    if (pile == nullptr || source == nullptr || source->estCirculaire) {
+        return false;
+    }
+    if (source->tete == nullptr) {
+        return true;
+    }
+
+    ReculExponentiel recul = CreerRecul();
+    while (!TenterEmpiler(&pile->tete, source->tete, source->queue)) {
+        Reculer(&recul);
+    }
+    pile->taille.fetch_add(source->taille, std::memory_order_relaxed);
+
+    source->tete = nullptr;
+    source->queue = nullptr;
+    source->taille = 0;
+    return true;
+}
+
+ListeSimple* ExtraireListe(PileConcurrente* pile) {
+    if (pile == nullptr) {
+        return nullptr;
+    }
+    ListeSimple* liste = AllocateSimple();
+    if (liste == nullptr) {
+        return nullptr;
+    }
+
+    PointeurMarque ancien = pile->tete.load(std::memory_order_relaxed);
+    while (!pile->tete.compare_exchange_weak(ancien, Remplacer(ancien, nullptr),
+                                             std::memory_order_acquire, std::memory_order_relaxed)) {
+    }
+
+    // Les nœuds détachés peuvent encore être lus par un dépilement en retard :
+    // leurs valeurs sont recopiées et eux-mêmes restent dans la réserve
+    NoeudS* noeud = AdresseDe<NoeudS>(ancien);
+    int extraits = 0;
+    while (noeud != nullptr) {
+        NoeudS* suivant = noeud->suivant;
+        int tailleAvant = liste->taille;
+        InsererFin(liste, noeud->donnee);
+        if (liste->taille == tailleAvant) {
+            // Plus de mémoire : le reste retourne sur la pile
+            NoeudS* dernier = noeud;
+            while (dernier->suivant != nullptr) {
+                dernier = dernier->suivant;
+            }
+            ReculExponentiel recul = CreerRecul();
+            while (!TenterEmpiler(&pile->tete, noeud, dernier)) {
+                Reculer(&recul);
+            }
+            break;
+        }
+        RendreNoeud(pile, noeud);
+        extraits++;
+        noeud = suivant;
+    }
+    pile->taille.fetch_sub(extraits, std::memory_order_relaxed);
+    return liste;
+}
+
+// ============================================================================
+// OPÉRATIONS CONCURRENTES
+// ============================================================================
+
+bool InsererDebut(PileConcurrente* pile, int valeur) {
+    if (pile == nullptr) {
+        return false;
+    }
+    NoeudS* noeud = ObtenirNoeud(pile);
+    if (noeud == nullptr) {
+        return false;
+    }
+    noeud->donnee = valeur;
+
+    ReculExponentiel recul = CreerRecul();
+    while (true) {
+        if (TenterEmpiler(&pile->tete, noeud, noeud)) {
+            pile->taille.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        // Tête disputée : tenter un rendez-vous avec un dépilement
+        if (OffrirNoeud(pile, noeud)) {
+            return true;
+        }
+        Reculer(&recul);
+    }
+}
+
+bool SupprimerDebut(PileConcurrente* pile, int* valeur) {
+    if (pile == nullptr) {
+        return false;
+    }
+
+    ReculExponentiel recul = CreerRecul();
+    while (true) {
+        NoeudS* sommet = nullptr;
+        int resultat = TenterDepiler(&pile->tete, &sommet);
+        if (resultat == 0) {
+            return false;
+        }
+        if (resultat == 1) {
+            pile->taille.fetch_sub(1, std::memory_order_relaxed);
+            if (valeur != nullptr) {
+                *valeur = sommet->donnee;
+            }
+            RendreNoeud(pile, sommet);
+            return true;
+        }
+        if (PrendreOffre(pile, valeur)) {
+            return true;
+        }
+        Reculer(&recul);
+    }
+}
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+int CompterElements(const PileConcurrente* pile) {
+    if (pile == nullptr) {
+        return 0;
+    }
+    int taille = pile->taille.load(std::memory_order_relaxed);
+    return taille < 0 ? 0 : taille;
+}
+
+bool EstVide(const PileConcurrente* pile) {
+    return pile == nullptr || AdresseDe<NoeudS>(pile->tete.load(std::memory_order_acquire)) == nullptr;
+}
+
+std::string ToString(const PileConcurrente* pile) {
+    if (pile == nullptr) {
+        return "Liste[NULL]";
+    }
+    std::string resultat = "Liste[";
+    for (NoeudS* noeud = AdresseDe<NoeudS>(pile->tete.load(std::memory_order_acquire)); noeud != nullptr;
+         noeud = noeud->suivant) {
+        if (resultat.size() > 6) {
+            resultat += " -> ";
+        }
+        resultat += ToString(noeud);
+    }
+    return resultat + "]";
+}
@@ -0,0 +1,120 @@
+#ifndef LISTE_PILE_H
+#define LISTE_PILE_H
+
+#include "ListAtomique.h"
+#include "ListS.h"
+#include <atomic>
+#include <string>
+
+/**
+ * @brief Nombre de cases du tableau d'élimination
+ */
+#define PILE_ELIMINATION_CASES 16
+
+/**
+ * @brief Pauses pendant lesquelles un empilement attend un partenaire
+ */
+#define PILE_ELIMINATION_ATTENTE 128
+
+/**
+ * @brief Case d'élimination, seule sur sa ligne de cache
+ *
+ * Contient 0 (libre), l'adresse d'un nœud offert par un empilement en
+ * attente, ou PILE_CASE_PRISE quand un dépilement vient de le prendre.
+ */
+typedef struct {
+    alignas(64) std::atomic<uintptr_t> offre;
+} CaseElimination;
+
+/**
+ * @brief Pile sans verrou (Treiber) sur les nœuds de ListeSimple
+ *
+ * InsererDebut et SupprimerDebut sont des compare-and-swap sur la tête,
+ * protégés de l'ABA par un pointeur marqué. Quand un compare-and-swap
+ * échoue, l'opération tente de rencontrer une opération inverse dans le
+ * tableau d'élimination : un empilement et un dépilement qui s'y croisent
+ * s'annulent sans toucher la tête, ce qui absorbe la contention.
+ *
+ * Récupération des nœuds : un dépilement concurrent peut encore lire le
+ * lien suivant d'un nœud qui vient d'être dépilé. Les nœuds dépilés ne sont
+ * donc jamais rendus à free pendant la vie de la pile : ils passent dans une
+ * réserve (elle-même une pile de Treiber) où les empilements suivants les
+ * reprennent. La mémoire est bornée par le pic d'occupation et rendue par
+ * Detruire.
+ */
+typedef struct {
+    alignas(64) std::atomic<PointeurMarque> tete;     /**< Sommet de la pile */
+    alignas(64) std::atomic<PointeurMarque> reserve;  /**< Nœuds libres réutilisables */
+    alignas(64) std::atomic<int> taille;              /**< Nombre d'éléments (indicatif en concurrence) */
+    CaseElimination elimination[PILE_ELIMINATION_CASES]; /**< Rendez-vous empilement/dépilement */
+} PileConcurrente;
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+/**
+ * @brief Crée une pile concurrente vide
+ * @return Pointeur vers la pile, ou NULL en cas d'échec
+ */
+PileConcurrente* AllocatePileConcurrente();
+
+/**
+ * @brief Libère la pile, ses éléments et sa réserve de nœuds
+ * @param pile Pile à détruire (plus aucun thread ne doit l'utiliser)
+ */
+void Detruire(PileConcurrente* pile);
+
+/**
+ * @brief Empile d'un seul coup tous les nœuds d'une liste simple
+ * @param pile Pile destinataire
+ * @param source Liste dont les nœuds sont repris (vidée) ; sa tête devient le sommet
+ * @return false si source est circulaire (rien n'est repris)
+ */
+bool InsererListe(PileConcurrente* pile, ListeSimple* source);
+
+/**
+ * @brief Détache atomiquement tout le contenu de la pile
+ * @param pile Pile à vider
+ * @return Liste simple (du sommet vers le fond), ou NULL en cas d'échec d'allocation
+ */
+ListeSimple* ExtraireListe(PileConcurrente* pile);
+
+// ============================================================================
+// OPÉRATIONS CONCURRENTES
+// ============================================================================
+
+/**
+ * @brief Empile une valeur (sans verrou)
+ * @param pile Pile concernée
+ * @param valeur Valeur à empiler
+ * @return false si aucun nœud n'a pu être obtenu
+ */
+bool InsererDebut(PileConcurrente* pile, int valeur);
+
+/**
+ * @brief Dépile une valeur (sans verrou)
+ * @param pile Pile concernée
+ * @param valeur Reçoit la valeur dépilée (peut être NULL)
+ * @return false si la pile était vide
+ */
+bool SupprimerDebut(PileConcurrente* pile, int* valeur);
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+/**
+ * @brief Nombre d'éléments (exact seulement en l'absence d'opérations en cours)
+ */
+int CompterElements(const PileConcurrente* pile);
+
+bool EstVide(const PileConcurrente* pile);
+
+/**
+ * @brief Représentation au format de ToString(const ListeSimple*)
+ * @note À n'appeler qu'en l'absence d'opérations concurrentes
+ */
+std::string ToString(const PileConcurrente* pile);
+
+#endif
@@ -0,0 +1,244 @@
+#include "ListRcu.h"
+#include "ListAtomique.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+// ============================================================================
+// PUBLICATION DES LIENS (usage interne)
+// ============================================================================
+
+static inline NoeudD* Charger(NoeudD* const& lien) {
+    return std::atomic_ref<NoeudD*>(const_cast<NoeudD*&>(lien)).load(std::memory_order_acquire);
+}
+
+static inline void Publier(NoeudD*& lien, NoeudD* valeur) {
+    std::atomic_ref<NoeudD*>(lien).store(valeur, std::memory_order_release);
+}
+
+static inline void PublierTaille(ListeDouble* liste, int taille) {
+    std::atomic_ref<int>(liste->taille).store(taille, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Accroche un nœud initialisé entre precedent et suivant (l'un ou l'autre peut être NULL)
+ *
+ * Le lien avant est publié en premier, puis le lien arrière : dans chaque
+ * sens, un lecteur voit le nœud complet ou ne le voit pas.
+ */
+static void Accrocher(ListeDouble* liste, NoeudD* precedent, NoeudD* noeud, NoeudD* suivant) {
+    noeud->precedent = precedent;
+    noeud->suivant = suivant;
+    Publier(precedent != nullptr ? precedent->suivant : liste->tete, noeud);
+    Publier(suivant != nullptr ? suivant->precedent : liste->queue, noeud);
+    PublierTaille(liste, liste->taille + 1);
+}
+
+static NoeudD* NouveauNoeud(int valeur) {
+    NoeudD* noeud = (NoeudD*)malloc(sizeof(NoeudD));
+    if (noeud != nullptr) {
+        noeud->donnee = valeur;
+    }
+    return noeud;
+}
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+ListeDoubleRcu* AllocateDoubleRcu() {
+    ListeDoubleRcu* liste = new (std::nothrow) ListeDoubleRcu;
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    liste->liste = CreerDouble();
+    liste->domaine = DomaineEpoqueGlobal();
+    return liste;
+}
+
+void Detruire(ListeDoubleRcu* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    NoeudD* noeud = liste->liste.tete;
+    while (noeud != nullptr) {
+        NoeudD* suivant = SansRetrait(noeud->suivant);
+        free(noeud);
+        noeud = suivant;
+    }
+    delete liste;
+}
+
+// ============================================================================
+// LECTURE (sans verrou)
+// ============================================================================
+
+void EntrerLecture(const ListeDoubleRcu* liste) {
+    EntrerSection(liste->domaine, ParticipantEpoqueDuThread());
+}
+
+void SortirLecture(const ListeDoubleRcu* liste) {
+    SortirSection(liste->domaine, ParticipantEpoqueDuThread());
+}
+
+NoeudD* PremierRcu(const ListeDoubleRcu* liste) {
+    return liste != nullptr ? Charger(liste->liste.tete) : nullptr;
+}
+
+NoeudD* SuivantRcu(const NoeudD* noeud) {
+    return noeud != nullptr ? SansRetrait(Charger(noeud->suivant)) : nullptr;
+}
+
+NoeudD* ObtenirNoeudPosition(const ListeDoubleRcu* liste, int position) {
+    int taille = CompterElements(liste);
+    if (position < 0 || position >= taille) {
+        return nullptr;
+    }
+
+    // Parcours depuis l'extrémité la plus proche. Les liens precedent sont
+    // publiés comme les liens suivant ; ceux d'un nœud supprimé restent
+    // valides pendant la section, comme son lien suivant.
+    NoeudD* noeud;
+    if (position <= taille / 2) {
+        noeud = PremierRcu(liste);
+        for (int i = 0; i < position && noeud != nullptr; i++) {
+            noeud = SuivantRcu(noeud);
+        }
+    } else {
+        noeud = Charger(liste->liste.queue);
+        for (int i = taille - 1; i > position && noeud != nullptr; i--) {
+            noeud = Charger(noeud->precedent);
+        }
+    }
+    return noeud;
+}
+
+bool RechercherValeur(const ListeDoubleRcu* liste, int valeur) {
+    if (liste == nullptr) {
+        return false;
+    }
+    EntrerLecture(liste);
+    NoeudD* noeud = PremierRcu(liste);
+    while (noeud != nullptr && noeud->donnee != valeur) {
+        noeud = SuivantRcu(noeud);
+    }
+    SortirLecture(liste);
+    return noeud != nullptr;
+}
+
+int CompterElements(const ListeDoubleRcu* liste) {
+    if (liste == nullptr) {
+        return 0;
+    }
+    return std::atomic_ref<int>(const_cast<int&>(liste->liste.taille)).load(std::memory_order_relaxed);
+}
+
+std::string ToString(const ListeDoubleRcu* liste) {
+    if (liste == nullptr) {
+        return "ListeDouble[NULL]";
+    }
+    std::string resultat = "ListeDouble[";
+    EntrerLecture(liste);
+    for (NoeudD* noeud = PremierRcu(liste); noeud != nullptr; noeud = SuivantRcu(noeud)) {
+        if (resultat.size() > 12) {
+            resultat += " <-> ";
+        }
+        resultat += "Noeud(" + std::to_string(noeud->donnee) + ")";
+    }
+    SortirLecture(liste);
+    return resultat + "]";
+}
+
+// ============================================================================
+// ÉCRITURE (sérialisée)
+// ============================================================================
+
+bool InsererDebut(ListeDoubleRcu* liste, int valeur) {
+    if (liste == nullptr) {
+        return false;
+    }
+    NoeudD* noeud = NouveauNoeud(valeur);
+    if (noeud == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> garde(liste->ecriture);
+    Accrocher(&liste->liste, nullptr, noeud, liste->liste.tete);
+    return true;
+}
+
+bool InsererFin(ListeDoubleRcu* liste, int valeur) {
+    if (liste == nullptr) {
+        return false;
+    }
+    NoeudD* noeud = NouveauNoeud(valeur);
+    if (noeud == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> garde(liste->ecriture);
+    Accrocher(&liste->liste, liste->liste.queue, noeud, nullptr);
+    return true;
+}
+
+bool InsererApres(ListeDoubleRcu* liste, NoeudD* precedent, int valeur) {
+    if (liste == nullptr || precedent == nullptr) {
+        return false;
+    }
+    NoeudD* noeud = NouveauNoeud(valeur);
+    if (noeud == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> garde(liste->ecriture);
+    // La marque ne se pose que sous le verrou : sa lecture ici est exacte
+    if (EstRetire(precedent->suivant)) {
+        free(noeud);
+        return false;
+    }
+    Accrocher(&liste->liste, precedent, noeud, precedent->suivant);
+    return true;
+}
+
+bool InsererAvant(ListeDoubleRcu* liste, NoeudD* suivant, int valeur) {
+    if (liste == nullptr || suivant == nullptr) {
+        return false;
+    }
+    NoeudD* noeud = NouveauNoeud(valeur);
+    if (noeud == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> garde(liste->ecriture);
+    if (EstRetire(suivant->suivant)) {
+        free(noeud);
+        return false;
+    }
+    Accrocher(&liste->liste, suivant->precedent, noeud, suivant);
+    return true;
+}
+
+bool SupprimerNoeud(ListeDoubleRcu* liste, NoeudD* noeud) {
+    if (liste == nullptr || noeud == nullptr) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> garde(liste->ecriture);
+        if (EstRetire(noeud->suivant)) {
+            return false;
+        }
+        NoeudD* precedent = noeud->precedent;
+        NoeudD* suivant = noeud->suivant;
+
+        // Les liens de noeud restent valides pour les lecteurs qui s'y trouvent
+        Publier(noeud->suivant, AvecRetrait(suivant));
+        Publier(precedent != nullptr ? precedent->suivant : liste->liste.tete, suivant);
+        Publier(suivant != nullptr ? suivant->precedent : liste->liste.queue, precedent);
+        PublierTaille(&liste->liste, liste->liste.taille - 1);
+    }
+    Retirer(liste->domaine, ParticipantEpoqueDuThread(), noeud);
+    return true;
+}
+
+void Synchroniser(ListeDoubleRcu* liste) {
+    if (liste != nullptr) {
+        AttendreGrace(liste->domaine);
+    }
+}
@@ -0,0 +1,138 @@
+#ifndef LISTE_RCU_H
+#define LISTE_RCU_H
+
+#include "ListD.h"
+#include "ListRecuperation.h"
+#include <mutex>
+#include <string>
+
+/**
+ * @brief ListeDouble en mode RCU (lecture, copie, mise à jour) pour les usages à lecture dominante
+ *
+ * Les lecteurs ne prennent aucun verrou : ils ouvrent une section de
+ * lecture (EntrerLecture, une annonce dans le domaine d'époques : un store
+ * seq_cst suivi d'une barrière, soit xchg + mfence sur x86, au plus une
+ * fois par section extérieure) puis parcourent les liens par de simples
+ * chargements acquire.
+ *
+ * Les écrivains se sérialisent sur le verrou ecriture. Chaque nœud est
+ * entièrement initialisé avant d'être publié par un store release ; un
+ * nœud supprimé est décroché, mais ses propres liens restent intacts pour
+ * les lecteurs arrêtés dessus. Son lien suivant porte la marque de retrait
+ * (ListAtomique.h), que les lecteurs effacent et que les écrivains
+ * utilisent pour refuser un nœud déjà supprimé. Il n'est libéré qu'après
+ * une période de grâce, quand plus aucune section ouverte avant sa
+ * suppression ne subsiste.
+ *
+ * InsererApres, InsererAvant et SupprimerNoeud lisent le lien du nœud
+ * passé pour y chercher cette marque. Si ce nœud a pu être supprimé par
+ * un autre écrivain, l'appelant doit être resté en section de lecture
+ * depuis qu'il l'a obtenu : sinon sa mémoire peut déjà être libérée.
+ */
+typedef struct {
+    ListeDouble liste;        /**< Liste publiée (tete, queue, taille et liens lus par les lecteurs) */
+    DomaineEpoque* domaine;   /**< Domaine des sections de lecture et des retraits */
+    std::mutex ecriture;      /**< Sérialise les écrivains */
+} ListeDoubleRcu;
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+/**
+ * @brief Crée une liste RCU vide, sur DomaineEpoqueGlobal
+ * @return Pointeur vers la liste, ou NULL en cas d'échec
+ */
+ListeDoubleRcu* AllocateDoubleRcu();
+
+/**
+ * @brief Libère la liste et ses nœuds (plus aucun lecteur ni écrivain ne doit l'utiliser)
+ */
+void Detruire(ListeDoubleRcu* liste);
+
+// ============================================================================
+// LECTURE (sans verrou)
+// ============================================================================
+
+/**
+ * @brief Ouvre une section de lecture ; les sections s'imbriquent
+ *
+ * Les nœuds obtenus dans la section restent valides jusqu'à SortirLecture,
+ * même s'ils sont supprimés entre temps.
+ */
+void EntrerLecture(const ListeDoubleRcu* liste);
+
+void SortirLecture(const ListeDoubleRcu* liste);
+
+/**
+ * @brief Premier nœud publié (à appeler en section de lecture)
+ */
+NoeudD* PremierRcu(const ListeDoubleRcu* liste);
+
+/**
+ * @brief Nœud suivant publié, marque de retrait effacée (à appeler en section de lecture)
+ */
+NoeudD* SuivantRcu(const NoeudD* noeud);
+
+/**
+ * @brief Obtient le nœud à une position (à appeler en section de lecture)
+ *
+ * Comme pour ListeDouble, le parcours part de l'extrémité la plus proche.
+ * Pendant une écriture concurrente, la position est relative à un état
+ * de la liste proche de celui du moment de l'appel.
+ * @return Le nœud, ou NULL si la position dépasse la liste
+ */
+NoeudD* ObtenirNoeudPosition(const ListeDoubleRcu* liste, int position);
+
+/**
+ * @brief Recherche une valeur (ouvre et ferme sa propre section)
+ */
+bool RechercherValeur(const ListeDoubleRcu* liste, int valeur);
+
+/**
+ * @brief Nombre d'éléments publiés
+ */
+int CompterElements(const ListeDoubleRcu* liste);
+
+std::string ToString(const ListeDoubleRcu* liste);
+
+// ============================================================================
+// ÉCRITURE (sérialisée)
+// ============================================================================
+
+/**
+ * @brief Insère une valeur en tête
+ * @return false si l'allocation échoue
+ */
+bool InsererDebut(ListeDoubleRcu* liste, int valeur);
+
+bool InsererFin(ListeDoubleRcu* liste, int valeur);
+
+/**
+ * @brief Insère une valeur après un nœud obtenu en lecture
+ * @return false si precedent a été supprimé entre temps ou si l'allocation échoue
+ * @note Si precedent a pu être supprimé, appeler dans la section qui l'a obtenu
+ */
+bool InsererApres(ListeDoubleRcu* liste, NoeudD* precedent, int valeur);
+
+/**
+ * @brief Insère une valeur avant un nœud obtenu en lecture
+ * @return false si suivant a été supprimé entre temps ou si l'allocation échoue
+ * @note Si suivant a pu être supprimé, appeler dans la section qui l'a obtenu
+ */
+bool InsererAvant(ListeDoubleRcu* liste, NoeudD* suivant, int valeur);
+
+/**
+ * @brief Supprime un nœud ; sa mémoire est libérée après une période de grâce
+ * @return false si le nœud était déjà supprimé
+ * @note Si le nœud a pu être supprimé, appeler dans la section qui l'a obtenu
+ */
+bool SupprimerNoeud(ListeDoubleRcu* liste, NoeudD* noeud);
+
+/**
+ * @brief Attend que toutes les sections ouvertes avant l'appel soient fermées
+ * @note À appeler hors section de lecture
+ */
+void Synchroniser(ListeDoubleRcu* liste);
+
+#endif
@@ -0,0 +1,576 @@
+#include "ListRecuperation.h"
+#include "ListAtomique.h"
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+// ============================================================================
+// LOTS DE RETRAITS (usage interne)
+// ============================================================================
+
+static bool AjouterAuLot(LotRetraits* lot, void* pointeur) {
+    if (lot->nombre == lot->capacite) {
+        int capacite = lot->capacite == 0 ? 16 : lot->capacite * 2;
+        void** elements = (void**)realloc(lot->elements, sizeof(void*) * capacite);
+        if (elements == nullptr) {
+            return false;
+        }
+        lot->elements = elements;
+        lot->capacite = capacite;
+    }
+    lot->elements[lot->nombre++] = pointeur;
+    return true;
+}
+
+/**
+ * @brief Libère tout le lot d'un coup et le vide
+ * @return Nombre de pointeurs libérés
+ */
+static int LibererLot(FonctionLiberation liberer, LotRetraits* lot) {
+    int liberes = lot->nombre;
+    for (int i = 0; i < lot->nombre; i++) {
+        liberer(lot->elements[i]);
+    }
+    lot->nombre = 0;
+    return liberes;
+}
+
+static void DetruireLot(FonctionLiberation liberer, LotRetraits* lot) {
+    LibererLot(liberer, lot);
+    free(lot->elements);
+    lot->elements = nullptr;
+    lot->capacite = 0;
+}
+
+/**
+ * @brief Porte inscrits au moins à indice + 1 pour que la case soit examinée
+ */
+static void InscrireCase(std::atomic<int>* inscrits, int indice) {
+    int courant = inscrits->load(std::memory_order_relaxed);
+    while (courant < indice + 1 && !inscrits->compare_exchange_weak(courant, indice + 1, std::memory_order_seq_cst)) {
+    }
+}
+
+/**
+ * @brief Prend la première case libre, en attendant qu'une se libère si besoin
+ */
+template <typename Participant>
+static int PrendreCase(Participant* participants) {
+    while (true) {
+        for (int i = 0; i < RECUPERATION_PARTICIPANTS_MAX; i++) {
+            bool attendu = false;
+            if (!participants[i].occupe.load(std::memory_order_relaxed) &&
+                participants[i].occupe.compare_exchange_strong(attendu, true, std::memory_order_acquire)) {
+                return i;
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+
+// ============================================================================
+// POINTEURS DE DANGER
+// ============================================================================
+
+DomaineDanger* AllocateDomaineDanger(int seuil, FonctionLiberation liberer) {
+    DomaineDanger* domaine = new (std::nothrow) DomaineDanger;
+    if (domaine == nullptr) {
+        return nullptr;
+    }
+    for (ParticipantDanger& participant : domaine->participants) {
+        participant.occupe.store(false, std::memory_order_relaxed);
+        for (std::atomic<const void*>& danger : participant.dangers) {
+            danger.store(nullptr, std::memory_order_relaxed);
+        }
+        participant.retraits = LotRetraits{nullptr, 0, 0};
+    }
+    domaine->inscrits.store(0, std::memory_order_relaxed);
+    domaine->nonRecuperes.store(0, std::memory_order_relaxed);
+    domaine->seuil = seuil > 0 ? seuil : RECUPERATION_SEUIL_DEFAUT;
+    domaine->liberer = liberer != nullptr ? liberer : free;
+    return domaine;
+}
+
+void Detruire(DomaineDanger* domaine) {
+    if (domaine == nullptr) {
+        return;
+    }
+    for (ParticipantDanger& participant : domaine->participants) {
+        DetruireLot(domaine->liberer, &participant.retraits);
+    }
+    delete domaine;
+}
+
+DomaineDanger* DomaineDangerGlobal() {
+    // Jamais détruit : des threads peuvent encore s'en servir pendant la destruction des statiques
+    static DomaineDanger* domaine = AllocateDomaineDanger();
+    return domaine;
+}
+
+ParticipantDanger* Rejoindre(DomaineDanger* domaine) {
+    if (domaine == nullptr) {
+        return nullptr;
+    }
+    int indice = PrendreCase(domaine->participants);
+    InscrireCase(&domaine->inscrits, indice);
+    return &domaine->participants[indice];
+}
+
+void Quitter(DomaineDanger* domaine, ParticipantDanger* participant) {
+    if (domaine == nullptr || participant == nullptr) {
+        return;
+    }
+    EffacerAnnonces(participant);
+    Recuperer(domaine, participant);
+    participant->occupe.store(false, std::memory_order_release);
+}
+
+namespace {
+
+    /**
+     * @brief Rend la case du thread dans le domaine global quand le thread se termine
+     */
+    struct AttacheDanger {
+        ParticipantDanger* participant = nullptr;
+        ~AttacheDanger() {
+            Quitter(DomaineDangerGlobal(), participant);
+        }
+    };
+
+} // namespace
+
+ParticipantDanger* ParticipantDangerDuThread() {
+    static thread_local AttacheDanger attache;
+    if (attache.participant == nullptr) {
+        attache.participant = Rejoindre(DomaineDangerGlobal());
+    }
+    return attache.participant;
+}
+
+/**
+ * @brief Indique si un thread annonce actuellement pointeur
+ */
+static bool EstAnnonce(const DomaineDanger* domaine, const void* pointeur) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int inscrits = domaine->inscrits.load(std::memory_order_acquire);
+    for (int i = 0; i < inscrits; i++) {
+        for (const std::atomic<const void*>& danger : domaine->participants[i].dangers) {
+            if (danger.load(std::memory_order_seq_cst) == pointeur) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void Retirer(DomaineDanger* domaine, ParticipantDanger* participant, void* pointeur) {
+    if (domaine == nullptr || participant == nullptr || pointeur == nullptr) {
+        return;
+    }
+    if (!AjouterAuLot(&participant->retraits, pointeur)) {
+        // Plus de mémoire pour le lot : attendre que plus personne n'annonce le nœud
+        while (EstAnnonce(domaine, pointeur)) {
+            std::this_thread::yield();
+        }
+        domaine->liberer(pointeur);
+        return;
+    }
+    domaine->nonRecuperes.fetch_add(1, std::memory_order_relaxed);
+
+    // Attendre que le lot dépasse le nombre d'annonces possibles : chaque passe libère alors au moins seuil nœuds
+    int inscrits = domaine->inscrits.load(std::memory_order_relaxed);
+    if (participant->retraits.nombre >= domaine->seuil + DANGER_PAR_PARTICIPANT * inscrits) {
+        Recuperer(domaine, participant);
+    }
+}
+
+int Recuperer(DomaineDanger* domaine, ParticipantDanger* participant) {
+    if (domaine == nullptr || participant == nullptr || participant->retraits.nombre == 0) {
+        return 0;
+    }
+
+    // Relever toutes les annonces (après les décrochages qui ont précédé les retraits)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int inscrits = domaine->inscrits.load(std::memory_order_acquire);
+    const void** annonces = (const void**)malloc(sizeof(void*) * (inscrits * DANGER_PAR_PARTICIPANT + 1));
+    if (annonces == nullptr) {
+        return 0;
+    }
+    int nombreAnnonces = 0;
+    for (int i = 0; i < inscrits; i++) {
+        for (std::atomic<const void*>& danger : domaine->participants[i].dangers) {
+            const void* pointeur = danger.load(std::memory_order_seq_cst);
+            if (pointeur != nullptr) {
+                annonces[nombreAnnonces++] = pointeur;
+            }
+        }
+    }
+    std::sort(annonces, annonces + nombreAnnonces);
+
+    // Libérer les non-annoncés et tasser les autres en tête du lot
+    LotRetraits* lot = &participant->retraits;
+    int gardes = 0;
+    for (int i = 0; i < lot->nombre; i++) {
+        void* pointeur = lot->elements[i];
+        if (std::binary_search(annonces, annonces + nombreAnnonces, (const void*)pointeur)) {
+            lot->elements[gardes++] = pointeur;
+        } else {
+            domaine->liberer(pointeur);
+        }
+    }
+    int liberes = lot->nombre - gardes;
+    lot->nombre = gardes;
+    free(annonces);
+
+    domaine->nonRecuperes.fetch_sub(liberes, std::memory_order_relaxed);
+    return liberes;
+}
+
+int CompterNonRecuperes(const DomaineDanger* domaine) {
+    return domaine != nullptr ? domaine->nonRecuperes.load(std::memory_order_relaxed) : 0;
+}
+
+// ============================================================================
+// ÉPOQUES
+// ============================================================================
+
+DomaineEpoque* AllocateDomaineEpoque(int seuil, FonctionLiberation liberer) {
+    DomaineEpoque* domaine = new (std::nothrow) DomaineEpoque;
+    if (domaine == nullptr) {
+        return nullptr;
+    }
+    domaine->epoque.store(0, std::memory_order_relaxed);
+    for (ParticipantEpoque& participant : domaine->participants) {
+        participant.occupe.store(false, std::memory_order_relaxed);
+        participant.etat.store(0, std::memory_order_relaxed);
+        participant.imbrication = 0;
+        for (int k = 0; k < 3; k++) {
+            participant.limbes[k] = LotRetraits{nullptr, 0, 0};
+            participant.epoquesLimbes[k] = 0;
+        }
+    }
+    domaine->inscrits.store(0, std::memory_order_relaxed);
+    domaine->nonRecuperes.store(0, std::memory_order_relaxed);
+    domaine->seuil = seuil > 0 ? seuil : RECUPERATION_SEUIL_DEFAUT;
+    domaine->liberer = liberer != nullptr ? liberer : free;
+    return domaine;
+}
+
+void Detruire(DomaineEpoque* domaine) {
+    if (domaine == nullptr) {
+        return;
+    }
+    for (ParticipantEpoque& participant : domaine->participants) {
+        for (LotRetraits& limbe : participant.limbes) {
+            DetruireLot(domaine->liberer, &limbe);
+        }
+    }
+    delete domaine;
+}
+
+DomaineEpoque* DomaineEpoqueGlobal() {
+    // Jamais détruit, comme DomaineDangerGlobal
+    static DomaineEpoque* domaine = AllocateDomaineEpoque();
+    return domaine;
+}
+
+ParticipantEpoque* Rejoindre(DomaineEpoque* domaine) {
+    if (domaine == nullptr) {
+        return nullptr;
+    }
+    int indice = PrendreCase(domaine->participants);
+    InscrireCase(&domaine->inscrits, indice);
+    ParticipantEpoque* participant = &domaine->participants[indice];
+    participant->imbrication = 0;
+    return participant;
+}
+
+void Quitter(DomaineEpoque* domaine, ParticipantEpoque* participant) {
+    if (domaine == nullptr || participant == nullptr) {
+        return;
+    }
+    participant->imbrication = 0;
+    participant->etat.store(0, std::memory_order_release);
+    Recuperer(domaine, participant);
+    participant->occupe.store(false, std::memory_order_release);
+}
+
+namespace {
+
+    struct AttacheEpoque {
+        ParticipantEpoque* participant = nullptr;
+        ~AttacheEpoque() {
+            Quitter(DomaineEpoqueGlobal(), participant);
+        }
+    };
+
+} // namespace
+
+ParticipantEpoque* ParticipantEpoqueDuThread() {
+    static thread_local AttacheEpoque attache;
+    if (attache.participant == nullptr) {
+        attache.participant = Rejoindre(DomaineEpoqueGlobal());
+    }
+    return attache.participant;
+}
+
+void EntrerSection(DomaineEpoque* domaine, ParticipantEpoque* participant) {
+    if (participant->imbrication++ > 0) {
+        return;
+    }
+    uint64_t epoque = domaine->epoque.load(std::memory_order_seq_cst);
+    participant->etat.store((epoque << 1) | 1u, std::memory_order_seq_cst);
+    // L'annonce doit précéder toute lecture de nœud
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void SortirSection(DomaineEpoque* domaine, ParticipantEpoque* participant) {
+    (void)domaine;
+    if (--participant->imbrication == 0) {
+        participant->etat.store(0, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Avance l'époque si tous les threads en section ont vu l'époque courante
+ * @return true si l'époque a avancé (par cet appel ou un autre)
+ */
+static bool TenterAvancer(DomaineEpoque* domaine) {
+    uint64_t epoque = domaine->epoque.load(std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int inscrits = domaine->inscrits.load(std::memory_order_acquire);
+    for (int i = 0; i < inscrits; i++) {
+        uint64_t etat = domaine->participants[i].etat.load(std::memory_order_seq_cst);
+        if ((etat & 1u) != 0 && (etat >> 1) != epoque) {
+            return false;
+        }
+    }
+    domaine->epoque.compare_exchange_strong(epoque, epoque + 1, std::memory_order_seq_cst);
+    return true;
+}
+
+/**
+ * @brief Libère les limbes du participant dont l'époque est dépassée de deux
+ */
+static int LibererLimbes(DomaineEpoque* domaine, ParticipantEpoque* participant) {
+    uint64_t epoque = domaine->epoque.load(std::memory_order_seq_cst);
+    int liberes = 0;
+    for (int k = 0; k < 3; k++) {
+        if (participant->limbes[k].nombre > 0 && participant->epoquesLimbes[k] + 2 <= epoque) {
+            liberes += LibererLot(domaine->liberer, &participant->limbes[k]);
+        }
+    }
+    domaine->nonRecuperes.fetch_sub(liberes, std::memory_order_relaxed);
+    return liberes;
+}
+
+void Retirer(DomaineEpoque* domaine, ParticipantEpoque* participant, void* pointeur) {
+    if (domaine == nullptr || participant == nullptr || pointeur == nullptr) {
+        return;
+    }
+    uint64_t epoque = domaine->epoque.load(std::memory_order_seq_cst);
+    int indice = (int)(epoque % 3);
+    LotRetraits* limbe = &participant->limbes[indice];
+    if (participant->epoquesLimbes[indice] != epoque) {
+        // Le limbe date au plus de epoque - 3 : il est sûr
+        domaine->nonRecuperes.fetch_sub(LibererLot(domaine->liberer, limbe), std::memory_order_relaxed);
+        participant->epoquesLimbes[indice] = epoque;
+    }
+
+    if (!AjouterAuLot(limbe, pointeur)) {
+        // Plus de mémoire pour le lot : attendre que le nœud soit sûr
+        while (domaine->epoque.load(std::memory_order_seq_cst) < epoque + 2) {
+            TenterAvancer(domaine);
+            std::this_thread::yield();
+        }
+        domaine->liberer(pointeur);
+        return;
+    }
+    domaine->nonRecuperes.fetch_add(1, std::memory_order_relaxed);
+
+    int enAttente = participant->limbes[0].nombre + participant->limbes[1].nombre + participant->limbes[2].nombre;
+    if (enAttente >= domaine->seuil) {
+        TenterAvancer(domaine);
+        LibererLimbes(domaine, participant);
+    }
+}
+
+int Recuperer(DomaineEpoque* domaine, ParticipantEpoque* participant) {
+    if (domaine == nullptr || participant == nullptr) {
+        return 0;
+    }
+    TenterAvancer(domaine);
+    TenterAvancer(domaine);
+    return LibererLimbes(domaine, participant);
+}
+
+void AttendreGrace(DomaineEpoque* domaine) {
+    if (domaine == nullptr) {
+        return;
+    }
+    // Deux avancées : la première peut avoir été validée avant les sections les plus récentes
+    uint64_t depart = domaine->epoque.load(std::memory_order_seq_cst);
+    while (domaine->epoque.load(std::memory_order_seq_cst) < depart + 2) {
+        if (!TenterAvancer(domaine)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+int CompterNonRecuperes(const DomaineEpoque* domaine) {
+    return domaine != nullptr ? domaine->nonRecuperes.load(std::memory_order_relaxed) : 0;
+}
+
+// ============================================================================
+// LECTEURS SANS VERROU DES LISTES SIMPLES ET DOUBLES
+// ============================================================================
+
+/**
+ * @brief Parcours main dans la main : chaque nœud est annoncé puis validé avant lecture
+ *
+ * Le nœud courant reste annoncé pendant la validation du suivant (deux
+ * cases alternées). Si le lien du nœud courant a changé ou porte la
+ * marque de retrait, ce nœud a été supprimé : reprise depuis la tête.
+ */
+template <typename Liste, typename Noeud>
+static bool RechercherProtegee(const Liste* liste, int valeur) {
+    if (liste == nullptr) {
+        return false;
+    }
+    ParticipantDanger* participant = ParticipantDangerDuThread();
+    std::atomic_ref<Noeud*> tete(const_cast<Liste*>(liste)->tete);
+    bool trouve = false;
+
+reprendre:
+    int indice = 0;
+    Noeud* noeud = tete.load(std::memory_order_acquire);
+    Annoncer(participant, indice, noeud);
+    if (tete.load(std::memory_order_seq_cst) != noeud) {
+        goto reprendre;
+    }
+    while (noeud != nullptr) {
+        if (noeud->donnee == valeur) {
+            trouve = true;
+            break;
+        }
+        std::atomic_ref<Noeud*> lien(noeud->suivant);
+        Noeud* suivant = lien.load(std::memory_order_acquire);
+        if (EstRetire(suivant)) {
+            goto reprendre;
+        }
+        indice ^= 1;
+        Annoncer(participant, indice, suivant);
+        if (lien.load(std::memory_order_seq_cst) != suivant) {
+            goto reprendre;
+        }
+        noeud = suivant;
+    }
+
+    Annoncer(participant, 0, nullptr);
+    Annoncer(participant, 1, nullptr);
+    return trouve;
+}
+
+/**
+ * @brief Accroche un nœud complet en fin ; le store release le publie aux lecteurs
+ */
+template <typename Liste, typename Noeud>
+static void PublierFin(Liste* liste, Noeud* noeud) {
+    noeud->suivant = nullptr;
+    if (liste->queue == nullptr) {
+        std::atomic_ref<Noeud*>(liste->tete).store(noeud, std::memory_order_release);
+    } else {
+        std::atomic_ref<Noeud*>(liste->queue->suivant).store(noeud, std::memory_order_release);
+    }
+    liste->queue = noeud;
+    liste->taille++;
+}
+
+/**
+ * @brief Marque, décroche puis retire le nœud qui suit precedent (ou la tête)
+ */
+template <typename Liste, typename Noeud>
+static void DecrocherDiffere(Liste* liste, Noeud* precedent, Noeud* noeud) {
+    Noeud* suivant = noeud->suivant;
+    // Marquer d'abord : un lecteur arrêté sur noeud ne pourra plus valider son suivant
+    std::atomic_ref<Noeud*>(noeud->suivant).store(AvecRetrait(suivant), std::memory_order_release);
+    std::atomic_ref<Noeud*>(precedent != nullptr ? precedent->suivant : liste->tete)
+        .store(suivant, std::memory_order_release);
+    if (liste->queue == noeud) {
+        liste->queue = precedent;
+    }
+    liste->taille--;
+    Retirer(DomaineDangerGlobal(), ParticipantDangerDuThread(), noeud);
+}
+
+bool RechercherValeurProtegee(const ListeSimple* liste, int valeur) {
+    return RechercherProtegee<ListeSimple, NoeudS>(liste, valeur);
+}
+
+bool RechercherValeurProtegee(const ListeDouble* liste, int valeur) {
+    return RechercherProtegee<ListeDouble, NoeudD>(liste, valeur);
+}
+
+bool InsererFinPublie(ListeSimple* liste, int valeur) {
+    if (liste == nullptr || liste->estCirculaire) {
+        return false;
+    }
+    NoeudS* noeud = (NoeudS*)malloc(sizeof(NoeudS));
+    if (noeud == nullptr) {
+        return false;
+    }
+    noeud->donnee = valeur;
+    PublierFin(liste, noeud);
+    return true;
+}
+
+bool InsererFinPublie(ListeDouble* liste, int valeur) {
+    if (liste == nullptr || liste->estCirculaire || liste->estInversee) {
+        return false;
+    }
+    NoeudD* noeud = (NoeudD*)malloc(sizeof(NoeudD));
+    if (noeud == nullptr) {
+        return false;
+    }
+    noeud->donnee = valeur;
+    noeud->precedent = liste->queue;
+    PublierFin(liste, noeud);
+    return true;
+}
+
+bool SupprimerValeurDifferee(ListeSimple* liste, int valeur) {
+    if (liste == nullptr || liste->estCirculaire) {
+        return false;
+    }
+    NoeudS* precedent = nullptr;
+    NoeudS* noeud = liste->tete;
+    while (noeud != nullptr && noeud->donnee != valeur) {
+        precedent = noeud;
+        noeud = noeud->suivant;
+    }
+    if (noeud == nullptr) {
+        return false;
+    }
+    DecrocherDiffere(liste, precedent, noeud);
+    return true;
+}
+
+bool SupprimerValeurDifferee(ListeDouble* liste, int valeur) {
+    if (liste == nullptr || liste->estCirculaire || liste->estInversee) {
+        return false;
+    }
+    NoeudD* noeud = liste->tete;
+    while (noeud != nullptr && noeud->donnee != valeur) {
+        noeud = noeud->suivant;
+    }
+    if (noeud == nullptr) {
+        return false;
+    }
+    // Les lecteurs ne suivent que suivant : precedent reste un champ de l'écrivain
+    if (noeud->suivant != nullptr) {
+        noeud->suivant->precedent = noeud->precedent;
+    }
+    DecrocherDiffere(liste, noeud->precedent, noeud);
+    return true;
+}
@@ -0,0 +1,307 @@
+#ifndef LISTE_RECUPERATION_H
+#define LISTE_RECUPERATION_H
+
+#include "ListS.h"
+#include "ListD.h"
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Récupération différée de la mémoire des nœuds partagés entre threads.
+ *
+ * Un nœud décroché d'une structure concurrente peut encore être lu par un
+ * thread qui l'avait atteint : il est d'abord retiré (Retirer), puis rendu à
+ * free par lots, une fois qu'aucun lecteur ne peut plus le tenir.
+ *
+ * Deux domaines sont proposés :
+ * - pointeurs de danger (DomaineDanger) : chaque lecteur annonce les nœuds
+ *   qu'il s'apprête à lire ; un nœud retiré n'est libéré que s'il n'est
+ *   annoncé par personne. La mémoire non récupérée reste bornée même si un
+ *   lecteur s'arrête, au prix d'une annonce et d'une validation par nœud ;
+ * - époques (DomaineEpoque) : un lecteur n'annonce que son entrée et sa
+ *   sortie de section. Un nœud retiré à l'époque e est libéré quand
+ *   l'époque globale atteint e + 2. Les lectures ne coûtent presque rien,
+ *   mais un lecteur bloqué en section empêche toute récupération.
+ *
+ * Chaque thread opère à travers un participant (une case du domaine) qu'il
+ * obtient par Rejoindre et rend par Quitter. Pour les domaines globaux,
+ * ParticipantDangerDuThread et ParticipantEpoqueDuThread s'en chargent :
+ * la case est rendue automatiquement à la fin du thread.
+ */
+
+#define RECUPERATION_PARTICIPANTS_MAX 256  /**< Threads inscrits simultanément dans un domaine */
+#define DANGER_PAR_PARTICIPANT 4           /**< Pointeurs de danger d'un participant */
+#define RECUPERATION_SEUIL_DEFAUT 64       /**< Retraits accumulés avant une tentative de récupération */
+
+/**
+ * @brief Fonction qui rend la mémoire d'un nœud retiré (free par défaut)
+ */
+typedef void (*FonctionLiberation)(void* pointeur);
+
+/**
+ * @brief Lot de pointeurs retirés, libérés ensemble
+ */
+typedef struct {
+    void** elements;      /**< Pointeurs retirés (alloués par malloc) */
+    int nombre;           /**< Nombre de pointeurs dans le lot */
+    int capacite;         /**< Capacité de elements */
+} LotRetraits;
+
+// ============================================================================
+// POINTEURS DE DANGER
+// ============================================================================
+
+/**
+ * @brief Case d'un thread dans un domaine de pointeurs de danger
+ */
+typedef struct {
+    alignas(64) std::atomic<bool> occupe;                     /**< Case prise par un thread */
+    std::atomic<const void*> dangers[DANGER_PAR_PARTICIPANT]; /**< Nœuds en cours de lecture */
+    LotRetraits retraits;                                     /**< Retirés par ce participant */
+} ParticipantDanger;
+
+/**
+ * @brief Domaine de pointeurs de danger
+ *
+ * Un participant lance une récupération dès que son lot atteint seuil plus
+ * le nombre d'annonces possibles, A = DANGER_PAR_PARTICIPANT × (participants
+ * inscrits) : il relève toutes les annonces, les trie, puis libère en une
+ * passe chaque retiré qui n'y figure pas. Au plus A nœuds survivent à la
+ * passe, qui en libère donc au moins seuil ; la mémoire non récupérée d'un
+ * participant reste inférieure à seuil + A nœuds, même si un lecteur s'arrête.
+ */
+typedef struct {
+    ParticipantDanger participants[RECUPERATION_PARTICIPANTS_MAX];
+    std::atomic<int> inscrits;        /**< Cases à examiner (plus haute case prise + 1) */
+    std::atomic<int> nonRecuperes;    /**< Nœuds retirés pas encore libérés */
+    int seuil;                        /**< Taille de lot déclenchant une récupération */
+    FonctionLiberation liberer;       /**< Libération d'un nœud */
+} DomaineDanger;
+
+/**
+ * @brief Crée un domaine de pointeurs de danger
+ * @param seuil Taille de lot déclenchant une récupération (défaut si <= 0)
+ * @param liberer Fonction de libération des nœuds (free si NULL)
+ * @return Pointeur vers le domaine, ou NULL en cas d'échec
+ */
+DomaineDanger* AllocateDomaineDanger(int seuil = RECUPERATION_SEUIL_DEFAUT, FonctionLiberation liberer = nullptr);
+
+/**
+ * @brief Libère tous les nœuds retirés puis le domaine
+ * @param domaine Domaine à détruire (plus aucun thread ne doit l'utiliser)
+ */
+void Detruire(DomaineDanger* domaine);
+
+/**
+ * @brief Domaine global, jamais détruit, utilisé par les structures de la bibliothèque
+ */
+DomaineDanger* DomaineDangerGlobal();
+
+/**
+ * @brief Prend une case libre du domaine (attend si toutes sont prises)
+ * @return Participant du thread appelant, ou NULL si domaine est NULL
+ */
+ParticipantDanger* Rejoindre(DomaineDanger* domaine);
+
+/**
+ * @brief Efface les annonces, tente une récupération et rend la case
+ *
+ * Les nœuds encore protégés restent dans la case et seront examinés par
+ * son prochain occupant.
+ */
+void Quitter(DomaineDanger* domaine, ParticipantDanger* participant);
+
+/**
+ * @brief Participant du thread courant dans DomaineDangerGlobal (rendu à la fin du thread)
+ */
+ParticipantDanger* ParticipantDangerDuThread();
+
+/**
+ * @brief Annonce qu'un nœud va être lu
+ *
+ * L'annonce ne protège qu'après validation : l'appelant doit relire le lien
+ * d'où vient le nœud et recommencer s'il a changé entre temps.
+ * @param participant Participant du thread appelant
+ * @param indice Case d'annonce, dans [0, DANGER_PAR_PARTICIPANT)
+ * @param pointeur Nœud annoncé (NULL efface l'annonce)
+ */
+static inline void Annoncer(ParticipantDanger* participant, int indice, const void* pointeur) {
+    participant->dangers[indice].store(pointeur, std::memory_order_seq_cst);
+}
+
+/**
+ * @brief Efface toutes les annonces d'un participant
+ */
+static inline void EffacerAnnonces(ParticipantDanger* participant) {
+    for (int i = 0; i < DANGER_PAR_PARTICIPANT; i++) {
+        participant->dangers[i].store(nullptr, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Retire un nœud déjà décroché ; il sera libéré quand plus personne ne l'annonce
+ */
+void Retirer(DomaineDanger* domaine, ParticipantDanger* participant, void* pointeur);
+
+/**
+ * @brief Libère en une passe les nœuds retirés par participant qui ne sont plus annoncés
+ * @return Nombre de nœuds libérés
+ */
+int Recuperer(DomaineDanger* domaine, ParticipantDanger* participant);
+
+/**
+ * @brief Nombre de nœuds retirés pas encore libérés dans tout le domaine
+ */
+int CompterNonRecuperes(const DomaineDanger* domaine);
+
+// ============================================================================
+// ÉPOQUES
+// ============================================================================
+
+/**
+ * @brief Case d'un thread dans un domaine d'époques
+ *
+ * etat vaut (époque << 1) | 1 tant que le thread est en section, 0 sinon.
+ * Les retraits sont rangés dans trois limbes, selon l'époque de retrait
+ * modulo 3 : quand l'époque globale vaut g, les limbes des époques
+ * inférieures ou égales à g - 2 ne sont plus accessibles à aucun lecteur.
+ */
+typedef struct {
+    alignas(64) std::atomic<bool> occupe;   /**< Case prise par un thread */
+    std::atomic<uint64_t> etat;             /**< Époque annoncée et présence en section */
+    int imbrication;                        /**< Profondeur des sections imbriquées */
+    LotRetraits limbes[3];                  /**< Retraits par époque modulo 3 */
+    uint64_t epoquesLimbes[3];              /**< Époque des retraits de chaque limbe */
+} ParticipantEpoque;
+
+/**
+ * @brief Domaine de récupération par époques
+ *
+ * Un participant qui a accumulé seuil retraits tente d'avancer l'époque
+ * globale (possible seulement si tous les threads en section ont vu
+ * l'époque courante), puis libère ses limbes devenus sûrs. Tant qu'aucun
+ * lecteur ne s'attarde en section, la mémoire non récupérée d'un
+ * participant reste de l'ordre de trois lots.
+ */
+typedef struct {
+    alignas(64) std::atomic<uint64_t> epoque;  /**< Époque globale */
+    ParticipantEpoque participants[RECUPERATION_PARTICIPANTS_MAX];
+    std::atomic<int> inscrits;                 /**< Cases à examiner (plus haute case prise + 1) */
+    std::atomic<int> nonRecuperes;             /**< Nœuds retirés pas encore libérés */
+    int seuil;                                 /**< Retraits déclenchant une tentative d'avancée */
+    FonctionLiberation liberer;                /**< Libération d'un nœud */
+} DomaineEpoque;
+
+/**
+ * @brief Crée un domaine d'époques
+ * @param seuil Retraits accumulés avant une tentative de récupération (défaut si <= 0)
+ * @param liberer Fonction de libération des nœuds (free si NULL)
+ * @return Pointeur vers le domaine, ou NULL en cas d'échec
+ */
+DomaineEpoque* AllocateDomaineEpoque(int seuil = RECUPERATION_SEUIL_DEFAUT, FonctionLiberation liberer = nullptr);
+
+/**
+ * @brief Libère tous les nœuds retirés puis le domaine
+ * @param domaine Domaine à détruire (plus aucun thread ne doit l'utiliser)
+ */
+void Detruire(DomaineEpoque* domaine);
+
+/**
+ * @brief Domaine global, jamais détruit, utilisé par les structures de la bibliothèque
+ */
+DomaineEpoque* DomaineEpoqueGlobal();
+
+/**
+ * @brief Prend une case libre du domaine (attend si toutes sont prises)
+ * @return Participant du thread appelant, ou NULL si domaine est NULL
+ */
+ParticipantEpoque* Rejoindre(DomaineEpoque* domaine);
+
+/**
+ * @brief Tente une récupération et rend la case (le thread doit être hors section)
+ *
+ * Les retraits encore trop récents restent dans les limbes de la case et
+ * seront libérés par son prochain occupant, ou par Detruire.
+ */
+void Quitter(DomaineEpoque* domaine, ParticipantEpoque* participant);
+
+/**
+ * @brief Participant du thread courant dans DomaineEpoqueGlobal (rendu à la fin du thread)
+ */
+ParticipantEpoque* ParticipantEpoqueDuThread();
+
+/**
+ * @brief Entre en section de lecture (les sections s'imbriquent)
+ *
+ * Tout nœud atteint pendant la section reste lisible jusqu'à SortirSection.
+ */
+void EntrerSection(DomaineEpoque* domaine, ParticipantEpoque* participant);
+
+void SortirSection(DomaineEpoque* domaine, ParticipantEpoque* participant);
+
+/**
+ * @brief Retire un nœud déjà décroché ; il sera libéré deux époques plus tard
+ */
+void Retirer(DomaineEpoque* domaine, ParticipantEpoque* participant, void* pointeur);
+
+/**
+ * @brief Tente d'avancer l'époque deux fois et libère les limbes devenus sûrs
+ *
+ * Sans lecteur en section, un appel libère tous les retraits du participant.
+ * @return Nombre de nœuds libérés
+ */
+int Recuperer(DomaineEpoque* domaine, ParticipantEpoque* participant);
+
+/**
+ * @brief Attend une période de grâce : toute section ouverte avant l'appel est fermée au retour
+ * @note L'appelant doit être hors section, sinon l'attente ne se termine pas
+ */
+void AttendreGrace(DomaineEpoque* domaine);
+
+/**
+ * @brief Nombre de nœuds retirés pas encore libérés dans tout le domaine
+ */
+int CompterNonRecuperes(const DomaineEpoque* domaine);
+
+// ============================================================================
+// LECTEURS SANS VERROU DES LISTES SIMPLES ET DOUBLES
+// ============================================================================
+
+/*
+ * Les fonctions suivantes partagent une ListeSimple ou une ListeDouble
+ * ordinaire entre des lecteurs sans verrou et des écrivains qui, eux, se
+ * sérialisent (par un mutex de l'appelant). Les lecteurs s'appuient sur
+ * DomaineDangerGlobal : ils annoncent chaque nœud avant de le lire. Un
+ * écrivain qui supprime un nœud marque d'abord son lien suivant (bit de
+ * poids faible, voir ListAtomique.h), le décroche, puis le retire ; un
+ * lecteur qui trouve la marque reprend depuis la tête.
+ *
+ * Tant que des lecteurs sont actifs, seules ces fonctions d'écriture sont
+ * permises sur la liste (ni circulaire ni inversée).
+ */
+
+/**
+ * @brief Recherche une valeur sans verrou pendant que d'autres threads écrivent
+ * @return true si la valeur a été vue dans la liste
+ */
+bool RechercherValeurProtegee(const ListeSimple* liste, int valeur);
+
+bool RechercherValeurProtegee(const ListeDouble* liste, int valeur);
+
+/**
+ * @brief Ajoute une valeur en fin et la publie aux lecteurs (écrivains sérialisés)
+ * @return false si la liste est invalide ou si l'allocation échoue
+ */
+bool InsererFinPublie(ListeSimple* liste, int valeur);
+
+bool InsererFinPublie(ListeDouble* liste, int valeur);
+
+/**
+ * @brief Supprime la première occurrence d'une valeur et diffère la libération du nœud
+ * @return true si la valeur a été trouvée et supprimée
+ */
+bool SupprimerValeurDifferee(ListeSimple* liste, int valeur);
+
+bool SupprimerValeurDifferee(ListeDouble* liste, int valeur);
+
+#endif
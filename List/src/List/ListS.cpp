@@ -1,7 +1,60 @@
 #include "ListS.h"
+#include "ListParcours.h"
+#include "ListSIMD.h"
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <string>
 
+// ============================================================================
+// PARCOURS PAR SÉRIES CONTIGUËS
+// ============================================================================
+
+/**
+ * @brief Avance le parcours jusqu'au prochain nœud contenant valeur
+ *
+ * Les nœuds alloués à la suite (liste construite d'un trait, chargement en
+ * bloc) sont souvent placés à pas constant : une telle série est mesurée
+ * par tronçons de LISTE_SIMD_TRONCON nœuds, chacun comparé par le moteur
+ * vectoriel. Ailleurs on avance nœud par nœud, avec le préchargement du
+ * moteur de parcours.
+ * @return Nœud trouvé (parcours->courant, non visité), ou NULL
+ */
+static NoeudS* ChercherDepuis(ParcoursS* parcours, int valeur) {
+    while (parcours->restants > 0 && parcours->courant != nullptr) {
+        NoeudS* courant = parcours->courant;
+        NoeudS* suivant = courant->suivant;
+        ptrdiff_t pas = (ptrdiff_t)((uintptr_t)suivant - (uintptr_t)courant);
+
+        int maximum = (parcours->restants < LISTE_SIMD_TRONCON) ? parcours->restants : LISTE_SIMD_TRONCON;
+
+        int serie = 1;
+        if (maximum >= LISTE_SIMD_SERIE_MIN && suivant != nullptr && PasSerieValide(pas, sizeof(NoeudS))) {
+            serie = MesurerSerie(courant, pas, offsetof(NoeudS, suivant), maximum);
+        }
+
+        if (serie >= LISTE_SIMD_SERIE_MIN) {
+            int index = ChercherEntierPas(&courant->donnee, pas, serie, valeur);
+            if (index != 0) {
+                AvancerSerie(parcours, (index < 0) ? serie : index, pas);
+            }
+            if (index >= 0) {
+                return parcours->courant;
+            }
+            continue;
+        }
+
+        for (int i = 0; i < serie; i++) {
+            if (parcours->courant->donnee == valeur) {
+                return parcours->courant;
+            }
+            AvancerParcours(parcours);
+        }
+    }
+
+    return nullptr;
+}
+
 // ============================================================================
 // FONCTIONS DE CRÉATION ET DESTRUCTION
 // ============================================================================
@@ -15,6 +68,8 @@ ListeSimple* AllocateSimple()
     	nouvelleListe->taille = 0;
     	nouvelleListe->estCirculaire = false;
         nouvelleListe->estAllouee = true; // Marquer comme allouée
+        nouvelleListe->sauts = nullptr;
+        nouvelleListe->capaciteSauts = 0;
     }
     return nouvelleListe;
 }
@@ -27,6 +82,8 @@ ListeSimple CreerSimple()
     nouvelleListe.taille = 0;
     nouvelleListe.estCirculaire = false;
     nouvelleListe.estAllouee = true; // Marquer comme allouée
+    nouvelleListe.sauts = nullptr;
+    nouvelleListe.capaciteSauts = 0;
     return nouvelleListe;
 }
 
@@ -55,24 +112,20 @@ void Initialiser(ListeSimple* liste) {
     liste->taille = 0;
     liste->estCirculaire = false;
     liste->estAllouee = false; // Par défaut, pas allouée dynamiquement
+    liste->sauts = nullptr;
+    liste->capaciteSauts = 0;
 }
 
 void Nettoyer(ListeSimple* liste) {
-    if (liste == nullptr || EstVide(liste)) {
+    if (liste == nullptr) {
         return;
     }
     
-    NoeudS* courant = liste->tete;
-    NoeudS* suivant = nullptr;
-    
-    while (courant != nullptr) {
-        suivant = courant->suivant;
-        free(courant);
-        courant = suivant;
-        
-        // Pour éviter les boucles infinies dans les listes circulaires
-        if (courant == liste->tete) {
-            break;
+    if (!EstVide(liste)) {
+        // taille borne le parcours, y compris sur une liste circulaire
+        ParcoursS parcours = DebuterParcours(liste);
+        for (NoeudS* noeud = AvancerParcours(&parcours); noeud != nullptr; noeud = AvancerParcours(&parcours)) {
+            free(noeud);
         }
     }
     
@@ -80,6 +133,7 @@ void Nettoyer(ListeSimple* liste) {
     liste->queue = nullptr;
     liste->taille = 0;
     liste->estCirculaire = false;
+    DesactiverSauts(liste);
 }
 
 void Detruire(ListeSimple* liste) {
@@ -87,7 +141,7 @@ void Detruire(ListeSimple* liste) {
         return;
     }
     
-    // Nettoyer tous les nœuds
+    // Nettoyer tous les nœuds (et rendre l'éventuelle table de sauts)
     Nettoyer(liste);
     
     // Libérer la structure de la liste elle-même
@@ -125,6 +179,7 @@ void InsererDebut(ListeSimple* liste, int valeur) {
     }
     
     liste->taille++;
+    AjusterSauts(liste);
 }
 
 void InsererFin(ListeSimple* liste, int valeur) {
@@ -150,6 +205,7 @@ void InsererFin(ListeSimple* liste, int valeur) {
     }
     
     liste->taille++;
+    AjusterSauts(liste);
 }
 
 bool InsererApres(ListeSimple* liste, NoeudS* precedent, int valeur) {
@@ -173,6 +229,7 @@ bool InsererApres(ListeSimple* liste, NoeudS* precedent, int valeur) {
     }
     
     liste->taille++;
+    AjusterSauts(liste);
     return true;
 }
 
@@ -326,39 +383,39 @@ bool SupprimerValeur(ListeSimple* liste, int valeur) {
 }
 
 int SupprimerToutesOccurrences(ListeSimple* liste, int valeur) {
-    if (liste == nullptr) {
+    if (liste == nullptr || EstVide(liste)) {
         return 0;
     }
     
+    bool etaitCirculaire = liste->estCirculaire;
+    RendreLineaire(liste);
+    
     int compteur = 0;
-    NoeudS* courant = liste->tete;
-    NoeudS* precedent = nullptr;
+    ParcoursS parcours = DebuterParcours(liste);
+    NoeudS* cible = ChercherDepuis(&parcours, valeur);
     
-    while (courant != nullptr) {
-        if (courant->donnee == valeur) {
-            NoeudS* aSupprimer = courant;
-            courant = courant->suivant;
-            
-            if (aSupprimer == liste->tete) {
-                SupprimerDebut(liste);
-            } else if (precedent != nullptr) {
-                precedent->suivant = aSupprimer->suivant;
-                if (aSupprimer == liste->queue) {
-                    liste->queue = precedent;
-                }
-                free(aSupprimer);
-                liste->taille--;
-            }
-            
-            compteur++;
+    while (cible != nullptr) {
+        NoeudS* suivant = cible->suivant;
+        if (parcours.precedent == nullptr) {
+            liste->tete = suivant;
         } else {
-            precedent = courant;
-            courant = courant->suivant;
+            parcours.precedent->suivant = suivant;
         }
-        
-        if (courant == liste->tete && liste->estCirculaire) {
-            break;
+        if (cible == liste->queue) {
+            liste->queue = parcours.precedent;
         }
+        free(cible);
+        liste->taille--;
+        compteur++;
+        
+        // suivant prend la position de cible : l'index ne bouge pas
+        parcours.courant = suivant;
+        parcours.restants--;
+        cible = ChercherDepuis(&parcours, valeur);
+    }
+    
+    if (etaitCirculaire) {
+        RendreCirculaire(liste);
     }
     
     return compteur;
@@ -394,22 +451,9 @@ NoeudS* RechercherValeur(const ListeSimple* liste, int valeur) {
         return nullptr;
     }
     
-    NoeudS* courant = liste->tete;
-    bool premierPassage = true;
-    
-    while (courant != nullptr && (premierPassage || courant != liste->tete)) {
-        if (courant->donnee == valeur) {
-            return courant;
-        }
-        courant = courant->suivant;
-        premierPassage = false;
-        
-        if (!liste->estCirculaire && courant == nullptr) {
-            break;
-        }
-    }
-    
-    return nullptr;
+    // taille borne le parcours, y compris sur une liste circulaire
+    ParcoursS parcours = DebuterParcours(liste);
+    return ChercherDepuis(&parcours, valeur);
 }
 
 NoeudS** RechercherToutesOccurrences(const ListeSimple* liste, int valeur, int* count) {
@@ -420,19 +464,10 @@ NoeudS** RechercherToutesOccurrences(const ListeSimple* liste, int valeur, int*
     *count = 0;
     
     // Premier passage : compter les occurrences
-    NoeudS* courant = liste->tete;
-    bool premierPassage = true;
-    
-    while (courant != nullptr && (premierPassage || courant != liste->tete)) {
-        if (courant->donnee == valeur) {
-            (*count)++;
-        }
-        courant = courant->suivant;
-        premierPassage = false;
-        
-        if (!liste->estCirculaire && courant == nullptr) {
-            break;
-        }
+    ParcoursS parcours = DebuterParcours(liste);
+    while (ChercherDepuis(&parcours, valeur) != nullptr) {
+        (*count)++;
+        AvancerParcours(&parcours);
     }
     
     if (*count == 0) {
@@ -447,19 +482,9 @@ NoeudS** RechercherToutesOccurrences(const ListeSimple* liste, int valeur, int*
     }
     
     int index = 0;
-    courant = liste->tete;
-    premierPassage = true;
-    
-    while (courant != nullptr && (premierPassage || courant != liste->tete)) {
-        if (courant->donnee == valeur) {
-            resultats[index++] = courant;
-        }
-        courant = courant->suivant;
-        premierPassage = false;
-        
-        if (!liste->estCirculaire && courant == nullptr) {
-            break;
-        }
+    parcours = DebuterParcours(liste);
+    while (ChercherDepuis(&parcours, valeur) != nullptr) {
+        resultats[index++] = AvancerParcours(&parcours);
     }
     
     resultats[index] = nullptr;
@@ -471,12 +496,12 @@ NoeudS* ObtenirNoeudPosition(const ListeSimple* liste, int position) {
         return nullptr;
     }
     
-    NoeudS* courant = liste->tete;
-    for (int i = 0; i < position && courant != nullptr; i++) {
-        courant = courant->suivant;
+    ParcoursS parcours = DebuterParcours(liste);
+    for (int i = 0; i < position && parcours.courant != nullptr; i++) {
+        AvancerParcours(&parcours);
     }
     
-    return courant;
+    return parcours.courant;
 }
 
 NoeudS* TrouverPrecedent(const ListeSimple* liste, const NoeudS* cible) {
@@ -484,21 +509,12 @@ NoeudS* TrouverPrecedent(const ListeSimple* liste, const NoeudS* cible) {
         return nullptr;
     }
     
-    NoeudS* courant = liste->tete;
-    NoeudS* precedent = nullptr;
-    bool premierPassage = true;
-    
-    while (courant != nullptr && (premierPassage || courant != liste->tete)) {
-        if (courant == cible) {
-            return precedent;
-        }
-        precedent = courant;
-        courant = courant->suivant;
-        premierPassage = false;
-        
-        if (!liste->estCirculaire && courant == nullptr) {
-            break;
+    ParcoursS parcours = DebuterParcours(liste);
+    while (parcours.courant != nullptr && parcours.restants > 0) {
+        if (parcours.courant == cible) {
+            return parcours.precedent;
         }
+        AvancerParcours(&parcours);
     }
     
     return nullptr;
@@ -525,21 +541,12 @@ std::string ToString(const ListeSimple* liste) {
     }
     
     std::string resultat = "Liste[";
-    NoeudS* courant = liste->tete;
-    bool premierPassage = true;
-    
-    while (courant != nullptr && (premierPassage || courant != liste->tete)) {
-        resultat += ToString(courant);
-        courant = courant->suivant;
-        premierPassage = false;
-        
-        if (courant != nullptr && (courant != liste->tete || !liste->estCirculaire)) {
+    ParcoursS parcours = DebuterParcours(liste);
+    for (NoeudS* noeud = AvancerParcours(&parcours); noeud != nullptr; noeud = AvancerParcours(&parcours)) {
+        if (noeud != liste->tete) {
             resultat += " -> ";
         }
-        
-        if (!liste->estCirculaire && courant == nullptr) {
-            break;
-        }
+        resultat += ToString(noeud);
     }
     
     resultat += "]";
@@ -570,23 +577,62 @@ bool ContientCycle(const ListeSimple* liste) {
         return true;
     }
     
-    if (liste->tete->suivant == nullptr) {
-        return false;
+    return AnalyserCycle(liste).present;
+}
+
+AnalyseCycleS AnalyserCycle(const ListeSimple* liste) {
+    AnalyseCycleS analyse;
+    analyse.present = false;
+    analyse.entree = nullptr;
+    analyse.longueurCycle = 0;
+    analyse.longueurQueue = 0;
+
+    if (liste == nullptr || liste->tete == nullptr) {
+        return analyse;
     }
-    
-    NoeudS* lent = liste->tete;
-    NoeudS* rapide = liste->tete;
-    
-    while (rapide != nullptr && rapide->suivant != nullptr) {
-        lent = lent->suivant;
-        rapide = rapide->suivant->suivant;
-        
-        if (lent == rapide) {
-            return true;
+
+    // Brent : la tortue se téléporte sur le lièvre à chaque puissance de deux,
+    // le lièvre seul avance (une lecture de lien par pas, contre trois pour Floyd).
+    NoeudS* tortue = liste->tete;
+    NoeudS* lievre = liste->tete->suivant;
+    int puissance = 1;
+    int longueur = 1;
+    int parcourus = 1;
+
+    while (lievre != tortue) {
+        if (lievre == nullptr) {
+            analyse.longueurQueue = parcourus;
+            return analyse;
+        }
+        if (puissance == longueur) {
+            tortue = lievre;
+            puissance *= 2;
+            longueur = 0;
         }
+        lievre = lievre->suivant;
+        longueur++;
+        parcourus++;
     }
-    
-    return false;
+
+    // Entrée du cycle : deux curseurs séparés de longueur pas avancent ensemble
+    tortue = liste->tete;
+    lievre = liste->tete;
+    for (int i = 0; i < longueur; i++) {
+        lievre = lievre->suivant;
+    }
+
+    int queue = 0;
+    while (tortue != lievre) {
+        tortue = tortue->suivant;
+        lievre = lievre->suivant;
+        queue++;
+    }
+
+    analyse.present = true;
+    analyse.entree = tortue;
+    analyse.longueurCycle = longueur;
+    analyse.longueurQueue = queue;
+    return analyse;
 }
 
 // ============================================================================
@@ -709,17 +755,9 @@ ListeSimple* Copier(const ListeSimple* liste) {
         return nouvelleListe;
     }
     
-    NoeudS* courant = liste->tete;
-    bool premierPassage = true;
-    
-    while (courant != nullptr && (premierPassage || courant != liste->tete)) {
-        InsererFin(nouvelleListe, courant->donnee);
-        courant = courant->suivant;
-        premierPassage = false;
-        
-        if (!liste->estCirculaire && courant == nullptr) {
-            break;
-        }
+    ParcoursS parcours = DebuterParcours(liste);
+    for (NoeudS* noeud = AvancerParcours(&parcours); noeud != nullptr; noeud = AvancerParcours(&parcours)) {
+        InsererFin(nouvelleListe, noeud->donnee);
     }
     
     if (liste->estCirculaire) {
@@ -737,7 +775,13 @@ void Concatener(ListeSimple* liste1, const ListeSimple* liste2) {
     if (EstVide(liste1)) {
         ListeSimple* copie = Copier(liste2);
         if (copie != nullptr) {
+            // La table de sauts reste celle de liste1
+            NoeudS** sauts = liste1->sauts;
+            int capaciteSauts = liste1->capaciteSauts;
             *liste1 = *copie;
+            liste1->sauts = sauts;
+            liste1->capaciteSauts = capaciteSauts;
+            AjusterSauts(liste1);
             free(copie);
         }
         return;
@@ -763,6 +807,7 @@ void Concatener(ListeSimple* liste1, const ListeSimple* liste2) {
     liste1->queue->suivant = copieListe2->tete;
     liste1->queue = copieListe2->queue;
     liste1->taille += copieListe2->taille;
+    AjusterSauts(liste1);
     
     // Restaurer l'état circulaire si nécessaire
     if (etaitCirculaire) {
@@ -778,6 +823,7 @@ void Diviser(ListeSimple* liste, int position, ListeSimple* liste2) {
         return;
     }
     
+    // liste2 repart de zéro, sans table de sauts
     Initialiser(liste2);
     
     NoeudS* noeudDivision = ObtenirNoeudPosition(liste, position);
@@ -801,6 +847,8 @@ void Diviser(ListeSimple* liste, int position, ListeSimple* liste2) {
             liste->queue->suivant = nullptr;
         }
         liste->taille = position;
+        // Les entrées au-delà de la coupe désignent désormais des nœuds de liste2
+        InvaliderSauts(liste, position);
     }
     
     // Si la liste était circulaire, rendre liste2 linéaire
@@ -1007,4 +1055,47 @@ bool EstPalindrome(const ListeSimple* liste) {
     milieu->suivant = prev;
     
     return estPalindrome;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Ramène un décalage vers la gauche dans [0, taille)
+ */
+static int ReduireDecalage(long long k, int taille) {
+    long long reste = k % taille;
+    return (int)(reste < 0 ? reste + taille : reste);
+}
+
+void RotationGauche(ListeSimple* liste, int k) {
+    if (liste == nullptr || liste->taille < 2) {
+        return;
+    }
+
+    int decalage = ReduireDecalage(k, liste->taille);
+    if (decalage == 0) {
+        return;
+    }
+
+    // La nouvelle queue est le nœud decalage - 1 : sans lien arrière, c'est
+    // la seule marche possible (taille - k pas pour une rotation à droite).
+    NoeudS* nouvelleQueue = liste->tete;
+    for (int i = 1; i < decalage; i++) {
+        nouvelleQueue = nouvelleQueue->suivant;
+    }
+
+    // Sur une liste circulaire l'anneau est déjà fermé : on déplace seulement
+    // tete/queue. Sinon on ferme l'anneau puis on le recoupe ailleurs.
+    liste->queue->suivant = liste->tete;
+    liste->tete = nouvelleQueue->suivant;
+    liste->queue = nouvelleQueue;
+    if (!liste->estCirculaire) {
+        nouvelleQueue->suivant = nullptr;
+    }
+}
+
+void RotationDroite(ListeSimple* liste, int k) {
+    if (liste == nullptr || liste->taille < 2) {
+        return;
+    }
+
+    RotationGauche(liste, ReduireDecalage(-(long long)k, liste->taille));
+}
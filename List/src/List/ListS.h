@@ -20,8 +20,20 @@ typedef struct {
     int taille;           /**< Nombre d'éléments dans la liste */
     bool estCirculaire;   /**< Indique si la liste est circulaire */
     bool estAllouee;      // Nouveau flag pour suivre l'allocation
+    NoeudS** sauts;       /**< Table de sauts (voir ListParcours.h), NULL si inactive */
+    int capaciteSauts;    /**< Nombre d'entrées allouées dans sauts */
 } ListeSimple;
 
+/**
+ * @brief Résultat de l'analyse de cycle d'une chaîne de liens suivant
+ */
+typedef struct {
+    bool present;         /**< Indique si la chaîne boucle */
+    NoeudS* entree;       /**< Premier nœud du cycle (NULL sans cycle) */
+    int longueurCycle;    /**< Nombre de nœuds du cycle (0 sans cycle) */
+    int longueurQueue;    /**< Nœuds avant l'entrée, ou de toute la chaîne sans cycle */
+} AnalyseCycleS;
+
 // ============================================================================
 // FONCTIONS DE CRÉATION ET DESTRUCTION
 // ============================================================================
@@ -241,6 +253,15 @@ bool EstVide(const ListeSimple* liste);
  */
 bool ContientCycle(const ListeSimple* liste);
 
+/**
+ * @brief Analyse les liens réels depuis la tête (algorithme de Brent)
+ * @param liste Pointeur vers la liste
+ * @return Présence du cycle, nœud d'entrée, longueur du cycle et de la queue
+ * @note Ignore estCirculaire : une liste circulaire saine donne entree == tete,
+ *       longueurCycle == taille et longueurQueue == 0
+ */
+AnalyseCycleS AnalyserCycle(const ListeSimple* liste);
+
 // ============================================================================
 // FONCTIONS DE CONVERSION ET TRANSFORMATION
 // ============================================================================
@@ -285,9 +306,9 @@ void Concatener(ListeSimple* liste1, const ListeSimple* liste2);
 
 /**
  * @brief Divise la liste en deux listes à une position spécifique
- * @param liste Liste à diviser
+ * @param liste Liste à diviser (garde sa table de sauts, tronquée à la coupe)
  * @param position Position de division
- * @param liste2 Nouvelle liste contenant les éléments après la position
+ * @param liste2 Nouvelle liste contenant les éléments après la position (réinitialisée, sans table de sauts)
  */
 void Diviser(ListeSimple* liste, int position, ListeSimple* liste2);
 
@@ -329,4 +350,19 @@ NoeudS* TrouverMilieu(const ListeSimple* liste);
  */
 bool EstPalindrome(const ListeSimple* liste);
 
+/**
+ * @brief Fait une rotation de la liste vers la gauche (la tête passe en queue)
+ * @param liste Pointeur vers la liste
+ * @param k Nombre de positions (réduit modulo taille, négatif = vers la droite)
+ * @note Aucun nœud n'est relié un par un : seul le point de coupure change
+ */
+void RotationGauche(ListeSimple* liste, int k);
+
+/**
+ * @brief Fait une rotation de la liste vers la droite (la queue passe en tête)
+ * @param liste Pointeur vers la liste
+ * @param k Nombre de positions (réduit modulo taille, négatif = vers la gauche)
+ */
+void RotationDroite(ListeSimple* liste, int k);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,410 @@
+#include "ListSIMD.h"
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define LISTE_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define LISTE_SIMD_X86 0
+#endif
+
+// ============================================================================
+// NOYAUX SCALAIRES (référence et fin de tableau)
+// ============================================================================
+
+static int ChercherScalaire(const int* valeurs, int nombre, int valeur) {
+    for (int i = 0; i < nombre; i++) {
+        if (valeurs[i] == valeur) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int CompterScalaire(const int* valeurs, int nombre, int valeur) {
+    int compteur = 0;
+    for (int i = 0; i < nombre; i++) {
+        compteur += (valeurs[i] == valeur);
+    }
+    return compteur;
+}
+
+static inline int LireEntier(const char* adresse) {
+    int valeur;
+    memcpy(&valeur, adresse, sizeof(valeur));
+    return valeur;
+}
+
+static int ChercherPasScalaire(const char* premier, ptrdiff_t pas, int nombre, int valeur) {
+    for (int i = 0; i < nombre; i++) {
+        if (LireEntier(premier + i * pas) == valeur) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int CompterPasScalaire(const char* premier, ptrdiff_t pas, int nombre, int valeur) {
+    int compteur = 0;
+    for (int i = 0; i < nombre; i++) {
+        compteur += (LireEntier(premier + i * pas) == valeur);
+    }
+    return compteur;
+}
+
+#if LISTE_SIMD_X86
+
+// ============================================================================
+// NOYAUX SSE4.2 (4 entiers par comparaison)
+// ============================================================================
+
+__attribute__((target("sse4.2")))
+static int ChercherSSE42(const int* valeurs, int nombre, int valeur) {
+    const __m128i cle = _mm_set1_epi32(valeur);
+    int i = 0;
+
+    for (; i + 16 <= nombre; i += 16) {
+        __m128i a = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(valeurs + i)), cle);
+        __m128i b = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(valeurs + i + 4)), cle);
+        __m128i c = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(valeurs + i + 8)), cle);
+        __m128i d = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(valeurs + i + 12)), cle);
+        __m128i tout = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        if (!_mm_testz_si128(tout, tout)) {
+            int masque = _mm_movemask_ps(_mm_castsi128_ps(a))
+                       | (_mm_movemask_ps(_mm_castsi128_ps(b)) << 4)
+                       | (_mm_movemask_ps(_mm_castsi128_ps(c)) << 8)
+                       | (_mm_movemask_ps(_mm_castsi128_ps(d)) << 12);
+            return i + __builtin_ctz(masque);
+        }
+    }
+
+    for (; i + 4 <= nombre; i += 4) {
+        __m128i a = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(valeurs + i)), cle);
+        int masque = _mm_movemask_ps(_mm_castsi128_ps(a));
+        if (masque != 0) {
+            return i + __builtin_ctz(masque);
+        }
+    }
+
+    int reste = ChercherScalaire(valeurs + i, nombre - i, valeur);
+    return reste < 0 ? -1 : i + reste;
+}
+
+__attribute__((target("sse4.2")))
+static int SommerSSE42(__m128i accumulateur) {
+    return _mm_extract_epi32(accumulateur, 0) + _mm_extract_epi32(accumulateur, 1)
+         + _mm_extract_epi32(accumulateur, 2) + _mm_extract_epi32(accumulateur, 3);
+}
+
+__attribute__((target("sse4.2")))
+static int CompterSSE42(const int* valeurs, int nombre, int valeur) {
+    const __m128i cle = _mm_set1_epi32(valeur);
+    __m128i accumulateur = _mm_setzero_si128();
+    int i = 0;
+
+    // Une égalité vaut -1 par voie : on la soustrait pour compter
+    for (; i + 16 <= nombre; i += 16) {
+        accumulateur = _mm_sub_epi32(accumulateur, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(valeurs + i)), cle));
+        accumulateur = _mm_sub_epi32(accumulateur, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(valeurs + i + 4)), cle));
+        accumulateur = _mm_sub_epi32(accumulateur, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(valeurs + i + 8)), cle));
+        accumulateur = _mm_sub_epi32(accumulateur, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(valeurs + i + 12)), cle));
+    }
+    for (; i + 4 <= nombre; i += 4) {
+        accumulateur = _mm_sub_epi32(accumulateur, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(valeurs + i)), cle));
+    }
+
+    return SommerSSE42(accumulateur) + CompterScalaire(valeurs + i, nombre - i, valeur);
+}
+
+__attribute__((target("sse4.2")))
+static __m128i ChargerPasSSE42(const char* premier, ptrdiff_t pas) {
+    return _mm_setr_epi32(LireEntier(premier), LireEntier(premier + pas),
+                          LireEntier(premier + 2 * pas), LireEntier(premier + 3 * pas));
+}
+
+__attribute__((target("sse4.2")))
+static int ChercherPasSSE42(const char* premier, ptrdiff_t pas, int nombre, int valeur) {
+    const __m128i cle = _mm_set1_epi32(valeur);
+    int i = 0;
+
+    for (; i + 4 <= nombre; i += 4) {
+        __m128i egal = _mm_cmpeq_epi32(ChargerPasSSE42(premier + i * pas, pas), cle);
+        int masque = _mm_movemask_ps(_mm_castsi128_ps(egal));
+        if (masque != 0) {
+            return i + __builtin_ctz(masque);
+        }
+    }
+
+    int reste = ChercherPasScalaire(premier + i * pas, pas, nombre - i, valeur);
+    return reste < 0 ? -1 : i + reste;
+}
+
+__attribute__((target("sse4.2")))
+static int CompterPasSSE42(const char* premier, ptrdiff_t pas, int nombre, int valeur) {
+    const __m128i cle = _mm_set1_epi32(valeur);
+    __m128i accumulateur = _mm_setzero_si128();
+    int i = 0;
+
+    for (; i + 4 <= nombre; i += 4) {
+        accumulateur = _mm_sub_epi32(accumulateur, _mm_cmpeq_epi32(ChargerPasSSE42(premier + i * pas, pas), cle));
+    }
+
+    return SommerSSE42(accumulateur) + CompterPasScalaire(premier + i * pas, pas, nombre - i, valeur);
+}
+
+// ============================================================================
+// NOYAUX AVX2 (8 entiers par comparaison)
+// ============================================================================
+
+__attribute__((target("avx2")))
+static int MasqueAVX2(__m256i egal) {
+    return _mm256_movemask_ps(_mm256_castsi256_ps(egal));
+}
+
+__attribute__((target("avx2")))
+static int ChercherAVX2(const int* valeurs, int nombre, int valeur) {
+    const __m256i cle = _mm256_set1_epi32(valeur);
+    int i = 0;
+
+    for (; i + 16 <= nombre; i += 16) {
+        __m256i a = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(valeurs + i)), cle);
+        __m256i b = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(valeurs + i + 8)), cle);
+        __m256i tout = _mm256_or_si256(a, b);
+        if (!_mm256_testz_si256(tout, tout)) {
+            int masque = MasqueAVX2(a) | (MasqueAVX2(b) << 8);
+            return i + __builtin_ctz(masque);
+        }
+    }
+
+    for (; i + 8 <= nombre; i += 8) {
+        int masque = MasqueAVX2(_mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(valeurs + i)), cle));
+        if (masque != 0) {
+            return i + __builtin_ctz(masque);
+        }
+    }
+
+    int reste = ChercherScalaire(valeurs + i, nombre - i, valeur);
+    return reste < 0 ? -1 : i + reste;
+}
+
+__attribute__((target("avx2")))
+static int SommerAVX2(__m256i accumulateur) {
+    __m128i somme = _mm_add_epi32(_mm256_castsi256_si128(accumulateur), _mm256_extracti128_si256(accumulateur, 1));
+    somme = _mm_add_epi32(somme, _mm_shuffle_epi32(somme, _MM_SHUFFLE(1, 0, 3, 2)));
+    somme = _mm_add_epi32(somme, _mm_shuffle_epi32(somme, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(somme);
+}
+
+__attribute__((target("avx2")))
+static int CompterAVX2(const int* valeurs, int nombre, int valeur) {
+    const __m256i cle = _mm256_set1_epi32(valeur);
+    __m256i accumulateur = _mm256_setzero_si256();
+    int i = 0;
+
+    for (; i + 16 <= nombre; i += 16) {
+        accumulateur = _mm256_sub_epi32(accumulateur, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(valeurs + i)), cle));
+        accumulateur = _mm256_sub_epi32(accumulateur, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(valeurs + i + 8)), cle));
+    }
+    for (; i + 8 <= nombre; i += 8) {
+        accumulateur = _mm256_sub_epi32(accumulateur, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(valeurs + i)), cle));
+    }
+
+    return SommerAVX2(accumulateur) + CompterScalaire(valeurs + i, nombre - i, valeur);
+}
+
+__attribute__((target("avx2")))
+static __m256i IndexPasAVX2(ptrdiff_t pas) {
+    int p = (int)pas;
+    return _mm256_setr_epi32(0, p, 2 * p, 3 * p, 4 * p, 5 * p, 6 * p, 7 * p);
+}
+
+__attribute__((target("avx2")))
+static int ChercherPasAVX2(const char* premier, ptrdiff_t pas, int nombre, int valeur) {
+    const __m256i cle = _mm256_set1_epi32(valeur);
+    const __m256i index = IndexPasAVX2(pas);
+    int i = 0;
+
+    for (; i + 8 <= nombre; i += 8) {
+        __m256i lus = _mm256_i32gather_epi32((const int*)(premier + i * pas), index, 1);
+        int masque = MasqueAVX2(_mm256_cmpeq_epi32(lus, cle));
+        if (masque != 0) {
+            return i + __builtin_ctz(masque);
+        }
+    }
+
+    int reste = ChercherPasScalaire(premier + i * pas, pas, nombre - i, valeur);
+    return reste < 0 ? -1 : i + reste;
+}
+
+__attribute__((target("avx2")))
+static int CompterPasAVX2(const char* premier, ptrdiff_t pas, int nombre, int valeur) {
+    const __m256i cle = _mm256_set1_epi32(valeur);
+    const __m256i index = IndexPasAVX2(pas);
+    __m256i accumulateur = _mm256_setzero_si256();
+    int i = 0;
+
+    for (; i + 8 <= nombre; i += 8) {
+        __m256i lus = _mm256_i32gather_epi32((const int*)(premier + i * pas), index, 1);
+        accumulateur = _mm256_sub_epi32(accumulateur, _mm256_cmpeq_epi32(lus, cle));
+    }
+
+    return SommerAVX2(accumulateur) + CompterPasScalaire(premier + i * pas, pas, nombre - i, valeur);
+}
+
+#endif
+
+// ============================================================================
+// SÉLECTION DU JEU D'INSTRUCTIONS
+// ============================================================================
+
+static std::atomic<int> niveauForce(-1);
+
+NiveauSIMD NiveauSIMDDisponible() {
+    static const NiveauSIMD niveau = []() {
+#if LISTE_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return SIMD_AVX2;
+        }
+        if (__builtin_cpu_supports("sse4.2")) {
+            return SIMD_SSE42;
+        }
+#endif
+        return SIMD_SCALAIRE;
+    }();
+    return niveau;
+}
+
+NiveauSIMD NiveauSIMDActif() {
+    int force = niveauForce.load(std::memory_order_relaxed);
+    return force < 0 ? NiveauSIMDDisponible() : (NiveauSIMD)force;
+}
+
+void ForcerNiveauSIMD(NiveauSIMD niveau) {
+    NiveauSIMD disponible = NiveauSIMDDisponible();
+    niveauForce.store(niveau > disponible ? disponible : niveau, std::memory_order_relaxed);
+}
+
+// ============================================================================
+// RECHERCHE DANS UN TABLEAU CONTIGU
+// ============================================================================
+
+int ChercherEntier(const int* valeurs, int nombre, int valeur) {
+    if (valeurs == nullptr || nombre <= 0) {
+        return -1;
+    }
+
+    switch (NiveauSIMDActif()) {
+#if LISTE_SIMD_X86
+        case SIMD_AVX2:
+            return ChercherAVX2(valeurs, nombre, valeur);
+        case SIMD_SSE42:
+            return ChercherSSE42(valeurs, nombre, valeur);
+#endif
+        default:
+            return ChercherScalaire(valeurs, nombre, valeur);
+    }
+}
+
+int CompterEntier(const int* valeurs, int nombre, int valeur) {
+    if (valeurs == nullptr || nombre <= 0) {
+        return 0;
+    }
+
+    switch (NiveauSIMDActif()) {
+#if LISTE_SIMD_X86
+        case SIMD_AVX2:
+            return CompterAVX2(valeurs, nombre, valeur);
+        case SIMD_SSE42:
+            return CompterSSE42(valeurs, nombre, valeur);
+#endif
+        default:
+            return CompterScalaire(valeurs, nombre, valeur);
+    }
+}
+
+// ============================================================================
+// RECHERCHE DANS UNE SÉRIE DE NŒUDS À PAS CONSTANT
+// ============================================================================
+
+/**
+ * @brief Les index de collecte sont des entiers 32 bits : 7 * pas doit y tenir
+ */
+static bool PasCollectable(ptrdiff_t pas) {
+    return pas <= INT_MAX / 8 && pas >= INT_MIN / 8;
+}
+
+int ChercherEntierPas(const void* premier, ptrdiff_t pas, int nombre, int valeur) {
+    if (premier == nullptr || nombre <= 0) {
+        return -1;
+    }
+
+    const char* octets = (const char*)premier;
+    if (pas == (ptrdiff_t)sizeof(int)) {
+        return ChercherEntier((const int*)premier, nombre, valeur);
+    }
+
+    switch (PasCollectable(pas) ? NiveauSIMDActif() : SIMD_SCALAIRE) {
+#if LISTE_SIMD_X86
+        case SIMD_AVX2:
+            return ChercherPasAVX2(octets, pas, nombre, valeur);
+        case SIMD_SSE42:
+            return ChercherPasSSE42(octets, pas, nombre, valeur);
+#endif
+        default:
+            return ChercherPasScalaire(octets, pas, nombre, valeur);
+    }
+}
+
+int CompterEntierPas(const void* premier, ptrdiff_t pas, int nombre, int valeur) {
+    if (premier == nullptr || nombre <= 0) {
+        return 0;
+    }
+
+    const char* octets = (const char*)premier;
+    if (pas == (ptrdiff_t)sizeof(int)) {
+        return CompterEntier((const int*)premier, nombre, valeur);
+    }
+
+    switch (PasCollectable(pas) ? NiveauSIMDActif() : SIMD_SCALAIRE) {
+#if LISTE_SIMD_X86
+        case SIMD_AVX2:
+            return CompterPasAVX2(octets, pas, nombre, valeur);
+        case SIMD_SSE42:
+            return CompterPasSSE42(octets, pas, nombre, valeur);
+#endif
+        default:
+            return CompterPasScalaire(octets, pas, nombre, valeur);
+    }
+}
+
+int MesurerSerie(const void* premier, ptrdiff_t pas, size_t decalageLien, int maximum) {
+    if (premier == nullptr || maximum <= 1) {
+        return premier == nullptr ? 0 : 1;
+    }
+
+    // L'adresse du nœud suivant est calculée, pas chargée : les lectures des
+    // liens sont indépendantes et le processeur peut les lancer en avance.
+    // Le lien lu ne sert qu'à la comparaison, jamais d'adresse pour la suite.
+    const char* noeud = (const char*)premier;
+    int longueur = 1;
+    while (longueur < maximum) {
+        const char* lien;
+        memcpy(&lien, noeud + decalageLien, sizeof(lien));
+        noeud += pas;
+        if (lien != noeud) {
+            break;
+        }
+        longueur++;
+    }
+
+    return longueur;
+}
+
+bool PasSerieValide(ptrdiff_t pas, size_t tailleNoeud) {
+    ptrdiff_t absolu = pas < 0 ? -pas : pas;
+    return absolu >= (ptrdiff_t)tailleNoeud && absolu <= LISTE_SIMD_PAS_MAX;
+}
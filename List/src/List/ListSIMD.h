@@ -0,0 +1,122 @@
+#ifndef LISTE_SIMD_H
+#define LISTE_SIMD_H
+
+#include <cstddef>
+
+/**
+ * @brief Nombre minimal de nœuds contigus pour passer par le moteur vectoriel
+ */
+#define LISTE_SIMD_SERIE_MIN 8
+
+/**
+ * @brief Écart maximal (en octets) entre deux nœuds d'une même série
+ */
+#define LISTE_SIMD_PAS_MAX 256
+
+/**
+ * @brief Nombre maximal de nœuds mesurés avant d'être comparés
+ *
+ * Une recherche compare chaque tronçon dès qu'il est mesuré : une
+ * occurrence proche de la tête est trouvée sans mesurer toute la série.
+ */
+#define LISTE_SIMD_TRONCON 64
+
+/**
+ * @brief Jeu d'instructions utilisé par le moteur de recherche
+ */
+typedef enum {
+    SIMD_SCALAIRE = 0,  /**< Une comparaison par entier */
+    SIMD_SSE42 = 1,     /**< 4 entiers par instruction, 16 par itération */
+    SIMD_AVX2 = 2       /**< 8 entiers par instruction, 16 par itération */
+} NiveauSIMD;
+
+// ============================================================================
+// SÉLECTION DU JEU D'INSTRUCTIONS
+// ============================================================================
+
+/**
+ * @brief Niveau le plus élevé supporté par le processeur (détecté une fois)
+ * @return Niveau détecté
+ */
+NiveauSIMD NiveauSIMDDisponible();
+
+/**
+ * @brief Niveau effectivement utilisé par les fonctions de recherche
+ * @return Niveau actif
+ */
+NiveauSIMD NiveauSIMDActif();
+
+/**
+ * @brief Impose un niveau (tests, mesures) ; borné au niveau disponible
+ * @param niveau Niveau souhaité
+ */
+void ForcerNiveauSIMD(NiveauSIMD niveau);
+
+// ============================================================================
+// RECHERCHE DANS UN TABLEAU CONTIGU
+// ============================================================================
+
+/**
+ * @brief Recherche la première occurrence d'une valeur dans un tableau d'entiers
+ * @param valeurs Tableau à parcourir
+ * @param nombre Nombre d'éléments
+ * @param valeur Valeur à rechercher
+ * @return Index de la première occurrence, ou -1 si absente
+ */
+int ChercherEntier(const int* valeurs, int nombre, int valeur);
+
+/**
+ * @brief Compte les occurrences d'une valeur dans un tableau d'entiers
+ * @param valeurs Tableau à parcourir
+ * @param nombre Nombre d'éléments
+ * @param valeur Valeur à compter
+ * @return Nombre d'occurrences
+ */
+int CompterEntier(const int* valeurs, int nombre, int valeur);
+
+// ============================================================================
+// RECHERCHE DANS UNE SÉRIE DE NŒUDS À PAS CONSTANT
+// ============================================================================
+
+/**
+ * @brief Recherche une valeur dans des éléments espacés d'un pas constant
+ * @param premier Adresse de l'entier du premier élément
+ * @param pas Écart en octets entre deux éléments (peut être négatif)
+ * @param nombre Nombre d'éléments
+ * @param valeur Valeur à rechercher
+ * @return Index de la première occurrence, ou -1 si absente
+ */
+int ChercherEntierPas(const void* premier, ptrdiff_t pas, int nombre, int valeur);
+
+/**
+ * @brief Compte une valeur dans des éléments espacés d'un pas constant
+ * @param premier Adresse de l'entier du premier élément
+ * @param pas Écart en octets entre deux éléments (peut être négatif)
+ * @param nombre Nombre d'éléments
+ * @param valeur Valeur à compter
+ * @return Nombre d'occurrences
+ */
+int CompterEntierPas(const void* premier, ptrdiff_t pas, int nombre, int valeur);
+
+/**
+ * @brief Mesure une série de nœuds chaînés par pointeur et placés à pas constant
+ *
+ * Le lien de chaque nœud (à decalageLien) doit désigner l'adresse premier + k * pas.
+ * Seuls les nœuds dont l'appartenance à la série est déjà prouvée sont lus.
+ * @param premier Premier nœud de la série
+ * @param pas Écart en octets entre deux nœuds consécutifs
+ * @param decalageLien Position du pointeur vers le nœud suivant dans un nœud
+ * @param maximum Nombre maximal de nœuds à mesurer
+ * @return Nombre de nœuds de la série (au moins 1)
+ */
+int MesurerSerie(const void* premier, ptrdiff_t pas, size_t decalageLien, int maximum);
+
+/**
+ * @brief Indique si un écart entre deux nœuds peut former une série exploitable
+ * @param pas Écart en octets entre deux nœuds
+ * @param tailleNoeud Taille d'un nœud
+ * @return true si |pas| est compris entre tailleNoeud et LISTE_SIMD_PAS_MAX
+ */
+bool PasSerieValide(ptrdiff_t pas, size_t tailleNoeud);
+
+#endif
@@ -0,0 +1,406 @@
+#include "ListSegmentee.h"
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+// ============================================================================
+// TABLE DE SEGMENTS (usage interne, commune aux deux listes)
+// ============================================================================
+
+template <typename Noeud>
+static Noeud* Avancer(Noeud* noeud, int pas) {
+    for (int i = 0; i < pas; i++) {
+        noeud = noeud->suivant;
+    }
+    return noeud;
+}
+
+template <typename Segmentee>
+static bool ReserverSegments(Segmentee* liste, int nombre) {
+    if (nombre <= liste->capacite) {
+        return true;
+    }
+    using Segment = std::remove_pointer_t<decltype(liste->segments)>;
+    int capacite = liste->capacite > 0 ? liste->capacite : 8;
+    while (capacite < nombre) {
+        capacite *= 2;
+    }
+    Segment* segments = (Segment*)realloc(liste->segments, (size_t)capacite * sizeof(Segment));
+    if (segments == nullptr) {
+        return false;
+    }
+    liste->segments = segments;
+    liste->capacite = capacite;
+    return true;
+}
+
+template <typename Segmentee, typename Noeud>
+static bool InsererSegment(Segmentee* liste, int indice, Noeud* debut, int taille) {
+    if (!ReserverSegments(liste, liste->nombreSegments + 1)) {
+        return false;
+    }
+    memmove(&liste->segments[indice + 1], &liste->segments[indice],
+            (size_t)(liste->nombreSegments - indice) * sizeof(liste->segments[0]));
+    liste->segments[indice].debut = debut;
+    liste->segments[indice].taille = taille;
+    liste->nombreSegments++;
+    return true;
+}
+
+template <typename Segmentee>
+static void RetirerSegment(Segmentee* liste, int indice) {
+    memmove(&liste->segments[indice], &liste->segments[indice + 1],
+            (size_t)(liste->nombreSegments - indice - 1) * sizeof(liste->segments[0]));
+    liste->nombreSegments--;
+}
+
+/**
+ * @brief Segment qui contient position (0 <= position < taille) et décalage dans ce segment
+ *
+ * Les tailles sont cumulées depuis l'extrémité la plus proche.
+ */
+template <typename Segmentee>
+static int TrouverSegment(const Segmentee* liste, int position, int* decalage) {
+    if (position < liste->liste.taille / 2) {
+        int indice = 0;
+        while (position >= liste->segments[indice].taille) {
+            position -= liste->segments[indice].taille;
+            indice++;
+        }
+        *decalage = position;
+        return indice;
+    }
+    int indice = liste->nombreSegments - 1;
+    int debut = liste->liste.taille - liste->segments[indice].taille;
+    while (position < debut) {
+        indice--;
+        debut -= liste->segments[indice].taille;
+    }
+    *decalage = position - debut;
+    return indice;
+}
+
+/**
+ * @brief Ramène un segment modifié entre pas / 2 et 2 * pas nœuds
+ *
+ * Trop long, il est coupé après pas nœuds (si la table ne peut grandir,
+ * il reste simplement long). Trop court, il est fusionné avec son voisin,
+ * puis le résultat est recoupé au besoin.
+ */
+template <typename Segmentee>
+static void Equilibrer(Segmentee* liste, int indice) {
+    int taille = liste->segments[indice].taille;
+    if (taille > 2 * liste->pas) {
+        auto coupure = Avancer(liste->segments[indice].debut, liste->pas);
+        if (InsererSegment(liste, indice + 1, coupure, taille - liste->pas)) {
+            liste->segments[indice].taille = liste->pas;
+        }
+    } else if (taille < liste->pas / 2 && liste->nombreSegments > 1) {
+        int gauche = indice + 1 < liste->nombreSegments ? indice : indice - 1;
+        liste->segments[gauche].taille += liste->segments[gauche + 1].taille;
+        RetirerSegment(liste, gauche + 1);
+        Equilibrer(liste, gauche);
+    }
+}
+
+/**
+ * @brief Pose des segments de pas nœuds sur toute la liste (la table doit être vide et assez grande)
+ */
+template <typename Segmentee>
+static void PoserSegments(Segmentee* liste) {
+    auto noeud = liste->liste.tete;
+    for (int restants = liste->liste.taille; restants > 0; restants -= liste->pas) {
+        int taille = restants < liste->pas ? restants : liste->pas;
+        liste->segments[liste->nombreSegments].debut = noeud;
+        liste->segments[liste->nombreSegments].taille = taille;
+        liste->nombreSegments++;
+        noeud = Avancer(noeud, taille);
+    }
+    if (liste->nombreSegments > 1) {
+        Equilibrer(liste, liste->nombreSegments - 1);
+    }
+}
+
+/**
+ * @brief Retire cible de la liste simple ; precedent est NULL en tête
+ */
+static void Decrocher(ListeSimple* liste, NoeudS* precedent, NoeudS* cible) {
+    if (precedent == nullptr) {
+        SupprimerDebut(liste);
+        return;
+    }
+    precedent->suivant = cible->suivant;
+    if (cible == liste->queue) {
+        liste->queue = precedent;
+    }
+    liste->taille--;
+    free(cible);
+}
+
+static void Decrocher(ListeDouble* liste, NoeudD* precedent, NoeudD* cible) {
+    (void)precedent;
+    SupprimerNoeud(liste, cible);
+}
+
+// ============================================================================
+// OPÉRATIONS COMMUNES (usage interne)
+// ============================================================================
+
+template <typename Segmentee>
+static Segmentee* AllouerSegmentee(int pas) {
+    if (pas < 2) {
+        return nullptr;
+    }
+    Segmentee* liste = (Segmentee*)malloc(sizeof(Segmentee));
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    liste->segments = nullptr;
+    liste->nombreSegments = 0;
+    liste->capacite = 0;
+    liste->pas = pas;
+    return liste;
+}
+
+template <typename Segmentee>
+static void LibererSegmentee(Segmentee* liste) {
+    Nettoyer(&liste->liste);
+    free(liste->segments);
+    free(liste);
+}
+
+template <typename Segmentee>
+static bool InsererFinSegmentee(Segmentee* liste, int valeur) {
+    if (liste->nombreSegments == 0) {
+        if (!ReserverSegments(liste, 1)) {
+            return false;
+        }
+        InsererFin(&liste->liste, valeur);
+        if (liste->liste.taille == 0) {
+            return false;
+        }
+        InsererSegment(liste, 0, liste->liste.tete, 1);
+        return true;
+    }
+    int taille = liste->liste.taille;
+    InsererFin(&liste->liste, valeur);
+    if (liste->liste.taille == taille) {
+        return false;
+    }
+    liste->segments[liste->nombreSegments - 1].taille++;
+    Equilibrer(liste, liste->nombreSegments - 1);
+    return true;
+}
+
+template <typename Segmentee>
+static bool InsererPositionSegmentee(Segmentee* liste, int position, int valeur) {
+    if (position < 0 || position > liste->liste.taille) {
+        return false;
+    }
+    if (position == liste->liste.taille) {
+        return InsererFinSegmentee(liste, valeur);
+    }
+    if (position == 0) {
+        int taille = liste->liste.taille;
+        InsererDebut(&liste->liste, valeur);
+        if (liste->liste.taille == taille) {
+            return false;
+        }
+        liste->segments[0].debut = liste->liste.tete;
+        liste->segments[0].taille++;
+        Equilibrer(liste, 0);
+        return true;
+    }
+
+    // Le nouveau nœud rejoint le segment de son prédécesseur
+    int decalage;
+    int indice = TrouverSegment(liste, position - 1, &decalage);
+    if (!InsererApres(&liste->liste, Avancer(liste->segments[indice].debut, decalage), valeur)) {
+        return false;
+    }
+    liste->segments[indice].taille++;
+    Equilibrer(liste, indice);
+    return true;
+}
+
+template <typename Segmentee>
+static bool SupprimerPositionSegmentee(Segmentee* liste, int position) {
+    if (position < 0 || position >= liste->liste.taille) {
+        return false;
+    }
+    using Noeud = std::remove_pointer_t<decltype(liste->liste.tete)>;
+
+    int decalage;
+    int indice = TrouverSegment(liste, position, &decalage);
+    Noeud* precedent = nullptr;
+    Noeud* cible;
+    if (decalage > 0) {
+        precedent = Avancer(liste->segments[indice].debut, decalage - 1);
+        cible = precedent->suivant;
+    } else {
+        cible = liste->segments[indice].debut;
+        // Seule la liste simple a besoin du prédécesseur : le dernier nœud du segment précédent
+        if constexpr (std::is_same_v<Noeud, NoeudS>) {
+            if (indice > 0) {
+                precedent = Avancer(liste->segments[indice - 1].debut, liste->segments[indice - 1].taille - 1);
+            }
+        }
+        liste->segments[indice].debut = cible->suivant;
+    }
+    Decrocher(&liste->liste, precedent, cible);
+
+    if (--liste->segments[indice].taille == 0) {
+        RetirerSegment(liste, indice);
+    } else {
+        Equilibrer(liste, indice);
+    }
+    return true;
+}
+
+template <typename Segmentee>
+static auto ObtenirNoeudSegmentee(const Segmentee* liste, int position) -> decltype(liste->liste.tete) {
+    if (position < 0 || position >= liste->liste.taille) {
+        return nullptr;
+    }
+    int decalage;
+    int indice = TrouverSegment(liste, position, &decalage);
+    return Avancer(liste->segments[indice].debut, decalage);
+}
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+ListeSimpleSegmentee* AllocateSimpleSegmentee(int pas) {
+    ListeSimpleSegmentee* liste = AllouerSegmentee<ListeSimpleSegmentee>(pas);
+    if (liste != nullptr) {
+        liste->liste = CreerSimple();
+    }
+    return liste;
+}
+
+ListeDoubleSegmentee* AllocateDoubleSegmentee(int pas) {
+    ListeDoubleSegmentee* liste = AllouerSegmentee<ListeDoubleSegmentee>(pas);
+    if (liste != nullptr) {
+        liste->liste = CreerDouble();
+    }
+    return liste;
+}
+
+ListeSimpleSegmentee* Segmenter(ListeSimple* source, int pas) {
+    ListeSimpleSegmentee* liste = source != nullptr ? AllocateSimpleSegmentee(pas) : nullptr;
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    if (!ReserverSegments(liste, (source->taille + pas - 1) / pas)) {
+        LibererSegmentee(liste);
+        return nullptr;
+    }
+    if (source->estCirculaire) {
+        RendreLineaire(source);
+    }
+
+    // Les nœuds changent de propriétaire ; la source reste une liste vide valide
+    liste->liste.tete = source->tete;
+    liste->liste.queue = source->queue;
+    liste->liste.taille = source->taille;
+    source->tete = nullptr;
+    source->queue = nullptr;
+    source->taille = 0;
+    PoserSegments(liste);
+    return liste;
+}
+
+ListeDoubleSegmentee* Segmenter(ListeDouble* source, int pas) {
+    ListeDoubleSegmentee* liste = source != nullptr ? AllocateDoubleSegmentee(pas) : nullptr;
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    if (!ReserverSegments(liste, (source->taille + pas - 1) / pas)) {
+        LibererSegmentee(liste);
+        return nullptr;
+    }
+    if (source->estCirculaire) {
+        RendreLineaire(source);
+    }
+    // Les segments suivent les champs suivant : ils doivent porter l'ordre logique
+    Materialiser(source);
+
+    liste->liste.tete = source->tete;
+    liste->liste.queue = source->queue;
+    liste->liste.taille = source->taille;
+    source->tete = nullptr;
+    source->queue = nullptr;
+    source->taille = 0;
+    PoserSegments(liste);
+    return liste;
+}
+
+void Detruire(ListeSimpleSegmentee* liste) {
+    if (liste != nullptr) {
+        LibererSegmentee(liste);
+    }
+}
+
+void Detruire(ListeDoubleSegmentee* liste) {
+    if (liste != nullptr) {
+        LibererSegmentee(liste);
+    }
+}
+
+// ============================================================================
+// FONCTIONS D'INSERTION ET DE SUPPRESSION
+// ============================================================================
+
+bool InsererFin(ListeSimpleSegmentee* liste, int valeur) {
+    return liste != nullptr && InsererFinSegmentee(liste, valeur);
+}
+
+bool InsererFin(ListeDoubleSegmentee* liste, int valeur) {
+    return liste != nullptr && InsererFinSegmentee(liste, valeur);
+}
+
+bool InsererPosition(ListeSimpleSegmentee* liste, int position, int valeur) {
+    return liste != nullptr && InsererPositionSegmentee(liste, position, valeur);
+}
+
+bool InsererPosition(ListeDoubleSegmentee* liste, int position, int valeur) {
+    return liste != nullptr && InsererPositionSegmentee(liste, position, valeur);
+}
+
+bool SupprimerPosition(ListeSimpleSegmentee* liste, int position) {
+    return liste != nullptr && SupprimerPositionSegmentee(liste, position);
+}
+
+bool SupprimerPosition(ListeDoubleSegmentee* liste, int position) {
+    return liste != nullptr && SupprimerPositionSegmentee(liste, position);
+}
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+NoeudS* ObtenirNoeudPosition(const ListeSimpleSegmentee* liste, int position) {
+    return liste != nullptr ? ObtenirNoeudSegmentee(liste, position) : nullptr;
+}
+
+NoeudD* ObtenirNoeudPosition(const ListeDoubleSegmentee* liste, int position) {
+    return liste != nullptr ? ObtenirNoeudSegmentee(liste, position) : nullptr;
+}
+
+int CompterElements(const ListeSimpleSegmentee* liste) {
+    return liste != nullptr ? liste->liste.taille : 0;
+}
+
+int CompterElements(const ListeDoubleSegmentee* liste) {
+    return liste != nullptr ? liste->liste.taille : 0;
+}
+
+std::string ToString(const ListeSimpleSegmentee* liste) {
+    return liste != nullptr ? ToString(&liste->liste) : "Liste[NULL]";
+}
+
+std::string ToString(const ListeDoubleSegmentee* liste) {
+    return liste != nullptr ? ToString(&liste->liste) : "ListeDouble[NULL]";
+}
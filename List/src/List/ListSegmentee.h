@@ -0,0 +1,231 @@
+#ifndef LISTE_SEGMENTEE_H
+#define LISTE_SEGMENTEE_H
+
+#include "ListS.h"
+#include "ListD.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define SEGMENT_PAS_DEFAUT 4096
+#define PARCOURS_PARALLELE_PARTS 64
+
+/**
+ * @brief Segment d'une liste segmentée : son premier nœud et son nombre de nœuds
+ */
+typedef struct {
+    NoeudS* debut;      /**< Premier nœud du segment */
+    int taille;         /**< Nombre de nœuds du segment (au moins 1) */
+} SegmentS;
+
+typedef struct {
+    NoeudD* debut;      /**< Premier nœud du segment */
+    int taille;         /**< Nombre de nœuds du segment (au moins 1) */
+} SegmentD;
+
+/**
+ * @brief ListeSimple accompagnée de points de découpe tous les pas nœuds environ
+ *
+ * segments découpe la liste, dans l'ordre, en tronçons contigus dont on
+ * connaît le premier nœud et la longueur. Les insertions et suppressions
+ * de ce module tiennent la table à jour : un segment qui dépasse 2 * pas
+ * nœuds est coupé en deux, un segment qui descend sous pas / 2 nœuds est
+ * fusionné avec un voisin. Une opération par position coûte O(n / pas)
+ * pour trouver le segment plus O(pas) pour y marcher, au lieu de O(n).
+ *
+ * ParcourirParallele lance ses threads directement sur des segments
+ * disjoints, sans parcours préalable depuis la tête.
+ *
+ * La liste ne doit être modifiée qu'à travers les fonctions de ce module
+ * (elle n'est jamais circulaire).
+ */
+typedef struct {
+    ListeSimple liste;      /**< Nœuds de la liste */
+    SegmentS* segments;     /**< Segments dans l'ordre de la liste */
+    int nombreSegments;     /**< Nombre de segments utilisés */
+    int capacite;           /**< Nombre de segments alloués */
+    int pas;                /**< Longueur visée d'un segment */
+} ListeSimpleSegmentee;
+
+/**
+ * @brief ListeDouble accompagnée de points de découpe (voir ListeSimpleSegmentee)
+ * @note La liste ne doit être ni circulaire ni inversée logiquement
+ */
+typedef struct {
+    ListeDouble liste;      /**< Nœuds de la liste */
+    SegmentD* segments;     /**< Segments dans l'ordre de la liste */
+    int nombreSegments;     /**< Nombre de segments utilisés */
+    int capacite;           /**< Nombre de segments alloués */
+    int pas;                /**< Longueur visée d'un segment */
+} ListeDoubleSegmentee;
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+/**
+ * @brief Crée une liste segmentée vide
+ * @param pas Longueur visée d'un segment (au moins 2)
+ * @return Pointeur vers la liste, ou NULL en cas d'échec
+ */
+ListeSimpleSegmentee* AllocateSimpleSegmentee(int pas = SEGMENT_PAS_DEFAUT);
+
+ListeDoubleSegmentee* AllocateDoubleSegmentee(int pas = SEGMENT_PAS_DEFAUT);
+
+/**
+ * @brief Reprend les nœuds d'une liste existante et pose ses points de découpe en un parcours
+ *
+ * La source est laissée vide (ses nœuds appartiennent désormais à la liste
+ * segmentée) ; une liste circulaire est d'abord rendue linéaire.
+ * @return Liste segmentée, ou NULL en cas d'échec (la source est alors intacte)
+ */
+ListeSimpleSegmentee* Segmenter(ListeSimple* source, int pas = SEGMENT_PAS_DEFAUT);
+
+ListeDoubleSegmentee* Segmenter(ListeDouble* source, int pas = SEGMENT_PAS_DEFAUT);
+
+void Detruire(ListeSimpleSegmentee* liste);
+
+void Detruire(ListeDoubleSegmentee* liste);
+
+// ============================================================================
+// FONCTIONS D'INSERTION ET DE SUPPRESSION
+// ============================================================================
+
+/**
+ * @brief Ajoute une valeur en fin de liste
+ * @return false si l'allocation échoue
+ */
+bool InsererFin(ListeSimpleSegmentee* liste, int valeur);
+
+bool InsererFin(ListeDoubleSegmentee* liste, int valeur);
+
+/**
+ * @brief Insère une valeur pour qu'elle occupe la position donnée
+ * @return false si la position dépasse la taille ou si l'allocation échoue
+ */
+bool InsererPosition(ListeSimpleSegmentee* liste, int position, int valeur);
+
+bool InsererPosition(ListeDoubleSegmentee* liste, int position, int valeur);
+
+/**
+ * @brief Supprime l'élément à une position
+ * @return false si la position est hors de la liste
+ */
+bool SupprimerPosition(ListeSimpleSegmentee* liste, int position);
+
+bool SupprimerPosition(ListeDoubleSegmentee* liste, int position);
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+/**
+ * @brief Obtient le nœud à une position en partant du segment qui la contient
+ */
+NoeudS* ObtenirNoeudPosition(const ListeSimpleSegmentee* liste, int position);
+
+NoeudD* ObtenirNoeudPosition(const ListeDoubleSegmentee* liste, int position);
+
+int CompterElements(const ListeSimpleSegmentee* liste);
+
+int CompterElements(const ListeDoubleSegmentee* liste);
+
+std::string ToString(const ListeSimpleSegmentee* liste);
+
+std::string ToString(const ListeDoubleSegmentee* liste);
+
+// ============================================================================
+// PARCOURS PARALLÈLE
+// ============================================================================
+
+/**
+ * @brief Répartit des segments consécutifs en parts, les calcule en parallèle et les fusionne dans l'ordre
+ *
+ * Le découpage en parts ne dépend que de la table de segments, jamais du
+ * nombre de threads ni de l'ordonnancement : le résultat est le même d'un
+ * appel à l'autre, même pour une réduction non associative (somme de
+ * flottants). Les threads se distribuent les parts par un compteur
+ * partagé ; le thread appelant en calcule aussi.
+ */
+template <typename Segment, typename T, typename Map, typename Reduce>
+T ParcourirSegmentsT(const Segment* segments, int nombreSegments, int nombreThreads, T neutre, Map map,
+                     Reduce reduce) {
+    if (nombreSegments <= 0) {
+        return neutre;
+    }
+    int parts = nombreSegments < PARCOURS_PARALLELE_PARTS ? nombreSegments : PARCOURS_PARALLELE_PARTS;
+    if (nombreThreads <= 0) {
+        nombreThreads = (int)std::thread::hardware_concurrency();
+    }
+    if (nombreThreads > parts) {
+        nombreThreads = parts;
+    }
+
+    // Un partiel par ligne de cache (et jamais de std::vector<bool>)
+    struct alignas(64) Partiel {
+        T valeur;
+    };
+    std::vector<Partiel> partiels(parts, Partiel{neutre});
+    std::atomic<int> prochaine(0);
+    auto calculer = [&]() {
+        for (int part = prochaine.fetch_add(1); part < parts; part = prochaine.fetch_add(1)) {
+            int premier = (int)((long long)part * nombreSegments / parts);
+            int dernier = (int)((long long)(part + 1) * nombreSegments / parts);
+            T& partiel = partiels[part].valeur;
+            for (int s = premier; s < dernier; s++) {
+                auto noeud = segments[s].debut;
+                for (int i = 0; i < segments[s].taille; i++) {
+                    map(partiel, noeud->donnee);
+                    noeud = noeud->suivant;
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 1; t < nombreThreads; t++) {
+        threads.emplace_back(calculer);
+    }
+    calculer();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    T resultat = neutre;
+    for (int part = 0; part < parts; part++) {
+        reduce(resultat, partiels[part].valeur);
+    }
+    return resultat;
+}
+
+/**
+ * @brief Agrège toute la liste sur plusieurs threads
+ *
+ * map(partiel, valeur) accumule un élément dans le résultat partiel de
+ * sa part ; reduce(total, partiel) fusionne les partiels, dans l'ordre de
+ * la liste. Par exemple, pour une somme :
+ * ParcourirParallele(liste, 8, 0LL,
+ *     [](long long& s, int v) { s += v; },
+ *     [](long long& s, const long long& p) { s += p; })
+ * @param nombreThreads Nombre de threads (0 = nombre de cœurs)
+ * @param neutre Valeur initiale de chaque partiel et du total
+ * @note La liste ne doit pas être modifiée pendant le parcours
+ */
+template <typename T, typename Map, typename Reduce>
+T ParcourirParallele(const ListeSimpleSegmentee* liste, int nombreThreads, T neutre, Map map, Reduce reduce) {
+    if (liste == nullptr) {
+        return neutre;
+    }
+    return ParcourirSegmentsT(liste->segments, liste->nombreSegments, nombreThreads, neutre, map, reduce);
+}
+
+template <typename T, typename Map, typename Reduce>
+T ParcourirParallele(const ListeDoubleSegmentee* liste, int nombreThreads, T neutre, Map map, Reduce reduce) {
+    if (liste == nullptr) {
+        return neutre;
+    }
+    return ParcourirSegmentsT(liste->segments, liste->nombreSegments, nombreThreads, neutre, map, reduce);
+}
+
+#endif
@@ -0,0 +1,865 @@
+#ifndef LISTE_STATIQUE_H
+#define LISTE_STATIQUE_H
+
+#include <string>
+
+/**
+ * Listes à capacité fixe : les N nœuds sont rangés dans la structure même
+ * de la liste et chaînés par index. Aucune fonction n'appelle malloc ou
+ * free ; une insertion dans une liste pleine renvoie false.
+ *
+ * Les nœuds libres forment une pile chaînée par leur champ suivant ; les
+ * nœuds jamais servis sont pris dans l'ordre au-delà de borne, ce qui rend
+ * Initialiser et Nettoyer en temps constant. Chaque opération est donc
+ * bornée : O(1) pour les insertions et suppressions aux extrémités (et sur
+ * un nœud donné pour la liste double), O(N) pour les accès par position ou
+ * par valeur, O(N log N) pour Trier (fusion itérative, sans récursion).
+ *
+ * Les fonctions reprennent la sémantique de ListS.h et ListD.h, un nœud
+ * étant désigné par son index dans noeuds (STATIQUE_AUCUN pour NULL). Une
+ * liste statique est toujours linéaire et se copie par simple affectation.
+ */
+
+/**
+ * @brief Index signifiant « aucun nœud »
+ */
+#define STATIQUE_AUCUN (-1)
+
+/**
+ * @brief Nœud de liste simple statique
+ */
+typedef struct {
+    int donnee;           /**< Donnée stockée dans le nœud */
+    int suivant;          /**< Index du nœud suivant (ou du libre suivant) */
+} NoeudStatiqueS;
+
+/**
+ * @brief Nœud de liste double statique
+ */
+typedef struct {
+    int donnee;           /**< Donnée stockée dans le nœud */
+    int precedent;        /**< Index du nœud précédent */
+    int suivant;          /**< Index du nœud suivant (ou du libre suivant) */
+} NoeudStatiqueD;
+
+/**
+ * @brief Liste simplement chaînée de capacité N sans allocation
+ */
+template <int N>
+struct ListeStatique {
+    static_assert(N >= 1, "La capacité doit être d'au moins un nœud");
+
+    NoeudStatiqueS noeuds[N];  /**< Stockage des nœuds */
+    int tete;                  /**< Index du premier nœud */
+    int queue;                 /**< Index du dernier nœud */
+    int taille;                /**< Nombre d'éléments */
+    int libre;                 /**< Sommet de la pile des nœuds rendus */
+    int borne;                 /**< Premier index jamais servi */
+};
+
+/**
+ * @brief Liste doublement chaînée de capacité N sans allocation
+ */
+template <int N>
+struct ListeDoubleStatique {
+    static_assert(N >= 1, "La capacité doit être d'au moins un nœud");
+
+    NoeudStatiqueD noeuds[N];  /**< Stockage des nœuds */
+    int tete;                  /**< Index du premier nœud */
+    int queue;                 /**< Index du dernier nœud */
+    int taille;                /**< Nombre d'éléments */
+    int libre;                 /**< Sommet de la pile des nœuds rendus */
+    int borne;                 /**< Premier index jamais servi */
+};
+
+// ============================================================================
+// GESTION DES NŒUDS (usage interne, communs aux deux listes)
+// ============================================================================
+
+template <typename Liste>
+void InitialiserStatique(Liste* liste) {
+    liste->tete = STATIQUE_AUCUN;
+    liste->queue = STATIQUE_AUCUN;
+    liste->taille = 0;
+    liste->libre = STATIQUE_AUCUN;
+    liste->borne = 0;
+}
+
+/**
+ * @brief Sort un nœud de la réserve
+ * @return Index du nœud, ou STATIQUE_AUCUN si la liste est pleine
+ */
+template <typename Liste>
+int PrendreNoeudStatique(Liste* liste) {
+    int index = liste->libre;
+    if (index != STATIQUE_AUCUN) {
+        liste->libre = liste->noeuds[index].suivant;
+        return index;
+    }
+    if (liste->borne < (int)(sizeof(liste->noeuds) / sizeof(liste->noeuds[0]))) {
+        return liste->borne++;
+    }
+    return STATIQUE_AUCUN;
+}
+
+template <typename Liste>
+void RendreNoeudStatique(Liste* liste, int index) {
+    liste->noeuds[index].suivant = liste->libre;
+    liste->libre = index;
+}
+
+/**
+ * @brief Vrai pour la liste double (champ precedent présent)
+ */
+template <typename Liste>
+constexpr bool EstDoubleStatique() {
+    return requires(Liste liste) { liste.noeuds[0].precedent; };
+}
+
+/**
+ * @brief Recalcule les liens precedent et la queue après un rechaînage par suivant
+ */
+template <typename Liste>
+void RelierPrecedentsStatique(Liste* liste) {
+    int precedent = STATIQUE_AUCUN;
+    for (int index = liste->tete; index != STATIQUE_AUCUN; index = liste->noeuds[index].suivant) {
+        if constexpr (EstDoubleStatique<Liste>()) {
+            liste->noeuds[index].precedent = precedent;
+        }
+        precedent = index;
+    }
+    liste->queue = precedent;
+}
+
+/**
+ * @brief Chaîne un nouveau nœud après precedent (STATIQUE_AUCUN : en tête)
+ * @return Index du nœud créé, ou STATIQUE_AUCUN si la liste est pleine
+ */
+template <typename Liste>
+int LierApresStatique(Liste* liste, int precedent, int valeur) {
+    int index = PrendreNoeudStatique(liste);
+    if (index == STATIQUE_AUCUN) {
+        return STATIQUE_AUCUN;
+    }
+
+    int suivant = (precedent == STATIQUE_AUCUN) ? liste->tete : liste->noeuds[precedent].suivant;
+    liste->noeuds[index].donnee = valeur;
+    liste->noeuds[index].suivant = suivant;
+    if constexpr (EstDoubleStatique<Liste>()) {
+        liste->noeuds[index].precedent = precedent;
+        if (suivant != STATIQUE_AUCUN) {
+            liste->noeuds[suivant].precedent = index;
+        }
+    }
+
+    if (precedent == STATIQUE_AUCUN) {
+        liste->tete = index;
+    } else {
+        liste->noeuds[precedent].suivant = index;
+    }
+    if (suivant == STATIQUE_AUCUN) {
+        liste->queue = index;
+    }
+    liste->taille++;
+    return index;
+}
+
+/**
+ * @brief Retire cible, dont le prédécesseur est precedent, et rend son nœud
+ */
+template <typename Liste>
+void DelierStatique(Liste* liste, int precedent, int cible) {
+    int suivant = liste->noeuds[cible].suivant;
+    if (precedent == STATIQUE_AUCUN) {
+        liste->tete = suivant;
+    } else {
+        liste->noeuds[precedent].suivant = suivant;
+    }
+    if (suivant == STATIQUE_AUCUN) {
+        liste->queue = precedent;
+    } else if constexpr (EstDoubleStatique<Liste>()) {
+        liste->noeuds[suivant].precedent = precedent;
+    }
+    RendreNoeudStatique(liste, cible);
+    liste->taille--;
+}
+
+template <typename Liste>
+int IndexPositionStatique(const Liste* liste, int position) {
+    if (position < 0 || position >= liste->taille) {
+        return STATIQUE_AUCUN;
+    }
+    int index = liste->tete;
+    for (int i = 0; i < position; i++) {
+        index = liste->noeuds[index].suivant;
+    }
+    return index;
+}
+
+/**
+ * @brief Dernier nœud dont la valeur est strictement inférieure
+ * @return Index du nœud, ou STATIQUE_AUCUN si la valeur va en tête
+ */
+template <typename Liste>
+int DernierInferieurStatique(const Liste* liste, int valeur) {
+    int precedent = STATIQUE_AUCUN;
+    for (int index = liste->tete; index != STATIQUE_AUCUN && liste->noeuds[index].donnee < valeur;
+         index = liste->noeuds[index].suivant) {
+        precedent = index;
+    }
+    return precedent;
+}
+
+template <typename Liste>
+bool SupprimerValeurStatique(Liste* liste, int valeur) {
+    int precedent = STATIQUE_AUCUN;
+    for (int index = liste->tete; index != STATIQUE_AUCUN; index = liste->noeuds[index].suivant) {
+        if (liste->noeuds[index].donnee == valeur) {
+            DelierStatique(liste, precedent, index);
+            return true;
+        }
+        precedent = index;
+    }
+    return false;
+}
+
+template <typename Liste>
+int SupprimerToutesOccurrencesStatique(Liste* liste, int valeur) {
+    int supprimees = 0;
+    int precedent = STATIQUE_AUCUN;
+    int index = liste->tete;
+    while (index != STATIQUE_AUCUN) {
+        int suivant = liste->noeuds[index].suivant;
+        if (liste->noeuds[index].donnee == valeur) {
+            DelierStatique(liste, precedent, index);
+            supprimees++;
+        } else {
+            precedent = index;
+        }
+        index = suivant;
+    }
+    return supprimees;
+}
+
+template <typename Liste>
+int RechercherValeurStatique(const Liste* liste, int valeur) {
+    for (int index = liste->tete; index != STATIQUE_AUCUN; index = liste->noeuds[index].suivant) {
+        if (liste->noeuds[index].donnee == valeur) {
+            return index;
+        }
+    }
+    return STATIQUE_AUCUN;
+}
+
+template <typename Liste>
+void InverserStatique(Liste* liste) {
+    int precedent = STATIQUE_AUCUN;
+    int index = liste->tete;
+    liste->queue = index;
+    while (index != STATIQUE_AUCUN) {
+        int suivant = liste->noeuds[index].suivant;
+        liste->noeuds[index].suivant = precedent;
+        if constexpr (EstDoubleStatique<Liste>()) {
+            liste->noeuds[index].precedent = suivant;
+        }
+        precedent = index;
+        index = suivant;
+    }
+    liste->tete = precedent;
+}
+
+/**
+ * @brief Tri fusion ascendant et stable sur les liens suivant
+ *
+ * Fusionne des séries de largeur 1, 2, 4... : O(N log N) comparaisons,
+ * aucune récursion ni mémoire annexe.
+ */
+template <typename Liste>
+void TrierStatique(Liste* liste) {
+    if (liste->taille < 2) {
+        return;
+    }
+
+    auto& noeuds = liste->noeuds;
+    for (int largeur = 1; largeur < liste->taille; largeur *= 2) {
+        int restant = liste->tete;
+        int tete = STATIQUE_AUCUN;
+        int queue = STATIQUE_AUCUN;
+
+        while (restant != STATIQUE_AUCUN) {
+            // Découper deux séries de largeur nœuds
+            int gauche = restant;
+            int tailleGauche = 0;
+            while (restant != STATIQUE_AUCUN && tailleGauche < largeur) {
+                restant = noeuds[restant].suivant;
+                tailleGauche++;
+            }
+            int droite = restant;
+            int tailleDroite = 0;
+            while (restant != STATIQUE_AUCUN && tailleDroite < largeur) {
+                restant = noeuds[restant].suivant;
+                tailleDroite++;
+            }
+
+            // Fusionner (à égalité, la série de gauche passe d'abord)
+            while (tailleGauche > 0 || tailleDroite > 0) {
+                int pris;
+                if (tailleDroite == 0 || (tailleGauche > 0 && noeuds[gauche].donnee <= noeuds[droite].donnee)) {
+                    pris = gauche;
+                    gauche = noeuds[gauche].suivant;
+                    tailleGauche--;
+                } else {
+                    pris = droite;
+                    droite = noeuds[droite].suivant;
+                    tailleDroite--;
+                }
+                if (queue == STATIQUE_AUCUN) {
+                    tete = pris;
+                } else {
+                    noeuds[queue].suivant = pris;
+                }
+                queue = pris;
+            }
+        }
+
+        noeuds[queue].suivant = STATIQUE_AUCUN;
+        liste->tete = tete;
+    }
+    RelierPrecedentsStatique(liste);
+}
+
+/**
+ * @brief Les decalage premiers nœuds passent en fin de liste (par rechaînage)
+ */
+template <typename Liste>
+void RotationStatique(Liste* liste, long long k) {
+    if (liste->taille < 2) {
+        return;
+    }
+    long long reste = k % liste->taille;
+    int decalage = (int)(reste < 0 ? reste + liste->taille : reste);
+    if (decalage == 0) {
+        return;
+    }
+
+    int nouvelleQueue = IndexPositionStatique(liste, decalage - 1);
+    int nouvelleTete = liste->noeuds[nouvelleQueue].suivant;
+    liste->noeuds[liste->queue].suivant = liste->tete;
+    if constexpr (EstDoubleStatique<Liste>()) {
+        liste->noeuds[liste->tete].precedent = liste->queue;
+        liste->noeuds[nouvelleTete].precedent = STATIQUE_AUCUN;
+    }
+    liste->noeuds[nouvelleQueue].suivant = STATIQUE_AUCUN;
+    liste->tete = nouvelleTete;
+    liste->queue = nouvelleQueue;
+}
+
+template <typename Liste>
+void SupprimerDoublonsTriesStatique(Liste* liste) {
+    int index = liste->tete;
+    while (index != STATIQUE_AUCUN) {
+        int suivant = liste->noeuds[index].suivant;
+        if (suivant != STATIQUE_AUCUN && liste->noeuds[suivant].donnee == liste->noeuds[index].donnee) {
+            DelierStatique(liste, index, suivant);
+        } else {
+            index = suivant;
+        }
+    }
+}
+
+/**
+ * @brief Ajoute une copie des valeurs de source, ou rien si la place manque
+ */
+template <typename Liste>
+bool ConcatenerStatique(Liste* liste1, const Liste* liste2) {
+    int capacite = (int)(sizeof(liste1->noeuds) / sizeof(liste1->noeuds[0]));
+    if (liste1->taille + liste2->taille > capacite) {
+        return false;
+    }
+    // La borne est fixée avant d'ajouter : l'auto-concaténation double la liste
+    int nombre = liste2->taille;
+    int index = liste2->tete;
+    for (int i = 0; i < nombre; i++) {
+        LierApresStatique(liste1, liste1->queue, liste2->noeuds[index].donnee);
+        index = liste2->noeuds[index].suivant;
+    }
+    return true;
+}
+
+/**
+ * @brief liste garde [0, position), liste2 reçoit une copie du reste
+ */
+template <typename Liste>
+void DiviserStatique(Liste* liste, int position, Liste* liste2) {
+    if (liste == liste2 || position < 1 || position >= liste->taille) {
+        return;
+    }
+
+    InitialiserStatique(liste2);
+    int nouvelleQueue = IndexPositionStatique(liste, position - 1);
+    int index = liste->noeuds[nouvelleQueue].suivant;
+    while (index != STATIQUE_AUCUN) {
+        int suivant = liste->noeuds[index].suivant;
+        LierApresStatique(liste2, liste2->queue, liste->noeuds[index].donnee);
+        RendreNoeudStatique(liste, index);
+        index = suivant;
+    }
+    liste->noeuds[nouvelleQueue].suivant = STATIQUE_AUCUN;
+    liste->queue = nouvelleQueue;
+    liste->taille = position;
+}
+
+template <typename Liste>
+std::string ToStringStatique(const Liste* liste, const char* prefixe, const char* separateur) {
+    std::string resultat = prefixe;
+    for (int index = liste->tete; index != STATIQUE_AUCUN; index = liste->noeuds[index].suivant) {
+        if (index != liste->tete) {
+            resultat += separateur;
+        }
+        resultat += "Noeud(" + std::to_string(liste->noeuds[index].donnee) + ")";
+    }
+    return resultat + "]";
+}
+
+// ============================================================================
+// LISTE SIMPLE STATIQUE
+// ============================================================================
+
+/**
+ * @brief Vide la liste en temps constant
+ */
+template <int N>
+void Initialiser(ListeStatique<N>* liste) {
+    if (liste != nullptr) {
+        InitialiserStatique(liste);
+    }
+}
+
+template <int N>
+void Nettoyer(ListeStatique<N>* liste) {
+    Initialiser(liste);
+}
+
+template <int N>
+int CompterElements(const ListeStatique<N>* liste) {
+    return liste == nullptr ? 0 : liste->taille;
+}
+
+template <int N>
+bool EstVide(const ListeStatique<N>* liste) {
+    return liste == nullptr || liste->taille == 0;
+}
+
+template <int N>
+bool EstPleine(const ListeStatique<N>* liste) {
+    return liste != nullptr && liste->taille == N;
+}
+
+/**
+ * @return false si la liste est pleine
+ */
+template <int N>
+bool InsererDebut(ListeStatique<N>* liste, int valeur) {
+    return liste != nullptr && LierApresStatique(liste, STATIQUE_AUCUN, valeur) != STATIQUE_AUCUN;
+}
+
+/**
+ * @return false si la liste est pleine
+ */
+template <int N>
+bool InsererFin(ListeStatique<N>* liste, int valeur) {
+    return liste != nullptr && LierApresStatique(liste, liste->queue, valeur) != STATIQUE_AUCUN;
+}
+
+/**
+ * @param precedent Index d'un nœud de la liste
+ * @return false si l'index est invalide ou la liste pleine
+ */
+template <int N>
+bool InsererApres(ListeStatique<N>* liste, int precedent, int valeur) {
+    if (liste == nullptr || precedent < 0 || precedent >= N) {
+        return false;
+    }
+    return LierApresStatique(liste, precedent, valeur) != STATIQUE_AUCUN;
+}
+
+/**
+ * @param suivant Index d'un nœud de la liste (recherche du prédécesseur en O(N))
+ * @return false si le nœud n'est pas dans la liste ou si la liste est pleine
+ */
+template <int N>
+bool InsererAvant(ListeStatique<N>* liste, int suivant, int valeur) {
+    if (liste == nullptr || suivant < 0 || suivant >= N) {
+        return false;
+    }
+    int precedent = STATIQUE_AUCUN;
+    for (int index = liste->tete; index != suivant; index = liste->noeuds[index].suivant) {
+        if (index == STATIQUE_AUCUN) {
+            return false;
+        }
+        precedent = index;
+    }
+    return LierApresStatique(liste, precedent, valeur) != STATIQUE_AUCUN;
+}
+
+/**
+ * @param position Position dans [0, taille]
+ */
+template <int N>
+bool InsererPosition(ListeStatique<N>* liste, int position, int valeur) {
+    if (liste == nullptr || position < 0 || position > liste->taille) {
+        return false;
+    }
+    int precedent = (position == 0) ? STATIQUE_AUCUN : IndexPositionStatique(liste, position - 1);
+    return LierApresStatique(liste, precedent, valeur) != STATIQUE_AUCUN;
+}
+
+template <int N>
+bool InsererTrie(ListeStatique<N>* liste, int valeur) {
+    return liste != nullptr && LierApresStatique(liste, DernierInferieurStatique(liste, valeur), valeur) != STATIQUE_AUCUN;
+}
+
+template <int N>
+bool SupprimerDebut(ListeStatique<N>* liste) {
+    if (EstVide(liste)) {
+        return false;
+    }
+    DelierStatique(liste, STATIQUE_AUCUN, liste->tete);
+    return true;
+}
+
+/**
+ * @note O(N) : le prédécesseur de la queue est recherché depuis la tête
+ */
+template <int N>
+bool SupprimerFin(ListeStatique<N>* liste) {
+    if (EstVide(liste)) {
+        return false;
+    }
+    DelierStatique(liste, IndexPositionStatique(liste, liste->taille - 2), liste->queue);
+    return true;
+}
+
+/**
+ * @return false si le nœud n'est pas dans la liste
+ */
+template <int N>
+bool SupprimerNoeud(ListeStatique<N>* liste, int cible) {
+    if (liste == nullptr) {
+        return false;
+    }
+    int precedent = STATIQUE_AUCUN;
+    for (int index = liste->tete; index != STATIQUE_AUCUN; index = liste->noeuds[index].suivant) {
+        if (index == cible) {
+            DelierStatique(liste, precedent, index);
+            return true;
+        }
+        precedent = index;
+    }
+    return false;
+}
+
+template <int N>
+bool SupprimerValeur(ListeStatique<N>* liste, int valeur) {
+    return liste != nullptr && SupprimerValeurStatique(liste, valeur);
+}
+
+template <int N>
+int SupprimerToutesOccurrences(ListeStatique<N>* liste, int valeur) {
+    return liste == nullptr ? 0 : SupprimerToutesOccurrencesStatique(liste, valeur);
+}
+
+/**
+ * @param position Position dans [0, taille)
+ */
+template <int N>
+bool SupprimerPosition(ListeStatique<N>* liste, int position) {
+    if (liste == nullptr || position < 0 || position >= liste->taille) {
+        return false;
+    }
+    int precedent = (position == 0) ? STATIQUE_AUCUN : IndexPositionStatique(liste, position - 1);
+    int cible = (precedent == STATIQUE_AUCUN) ? liste->tete : liste->noeuds[precedent].suivant;
+    DelierStatique(liste, precedent, cible);
+    return true;
+}
+
+/**
+ * @return Index du premier nœud portant la valeur, ou STATIQUE_AUCUN
+ */
+template <int N>
+int RechercherValeur(const ListeStatique<N>* liste, int valeur) {
+    return liste == nullptr ? STATIQUE_AUCUN : RechercherValeurStatique(liste, valeur);
+}
+
+/**
+ * @return Index du nœud à cette position, ou STATIQUE_AUCUN
+ */
+template <int N>
+int ObtenirNoeudPosition(const ListeStatique<N>* liste, int position) {
+    return liste == nullptr ? STATIQUE_AUCUN : IndexPositionStatique(liste, position);
+}
+
+template <int N>
+std::string ToString(const ListeStatique<N>* liste) {
+    return liste == nullptr ? "Liste[NULL]" : ToStringStatique(liste, "Liste[", " -> ");
+}
+
+template <int N>
+void Inverser(ListeStatique<N>* liste) {
+    if (liste != nullptr) {
+        InverserStatique(liste);
+    }
+}
+
+template <int N>
+void Trier(ListeStatique<N>* liste) {
+    if (liste != nullptr) {
+        TrierStatique(liste);
+    }
+}
+
+/**
+ * @brief Ajoute une copie des valeurs de liste2 à la fin de liste1
+ * @return false (liste1 inchangée) si la capacité ne suffit pas
+ */
+template <int N>
+bool Concatener(ListeStatique<N>* liste1, const ListeStatique<N>* liste2) {
+    return liste1 != nullptr && liste2 != nullptr && ConcatenerStatique(liste1, liste2);
+}
+
+/**
+ * @param position Même domaine que Diviser(ListeSimple*) : [1, taille - 2]
+ */
+template <int N>
+void Diviser(ListeStatique<N>* liste, int position, ListeStatique<N>* liste2) {
+    if (liste != nullptr && liste2 != nullptr && position < liste->taille - 1) {
+        DiviserStatique(liste, position, liste2);
+    }
+}
+
+template <int N>
+void SupprimerDoublonsTries(ListeStatique<N>* liste) {
+    if (liste != nullptr) {
+        SupprimerDoublonsTriesStatique(liste);
+    }
+}
+
+template <int N>
+void RotationGauche(ListeStatique<N>* liste, int k) {
+    if (liste != nullptr) {
+        RotationStatique(liste, k);
+    }
+}
+
+template <int N>
+void RotationDroite(ListeStatique<N>* liste, int k) {
+    if (liste != nullptr) {
+        RotationStatique(liste, -(long long)k);
+    }
+}
+
+// ============================================================================
+// LISTE DOUBLE STATIQUE
+// ============================================================================
+
+template <int N>
+void Initialiser(ListeDoubleStatique<N>* liste) {
+    if (liste != nullptr) {
+        InitialiserStatique(liste);
+    }
+}
+
+template <int N>
+void Nettoyer(ListeDoubleStatique<N>* liste) {
+    Initialiser(liste);
+}
+
+template <int N>
+int CompterElements(const ListeDoubleStatique<N>* liste) {
+    return liste == nullptr ? 0 : liste->taille;
+}
+
+template <int N>
+bool EstVide(const ListeDoubleStatique<N>* liste) {
+    return liste == nullptr || liste->taille == 0;
+}
+
+template <int N>
+bool EstPleine(const ListeDoubleStatique<N>* liste) {
+    return liste != nullptr && liste->taille == N;
+}
+
+template <int N>
+bool InsererDebut(ListeDoubleStatique<N>* liste, int valeur) {
+    return liste != nullptr && LierApresStatique(liste, STATIQUE_AUCUN, valeur) != STATIQUE_AUCUN;
+}
+
+template <int N>
+bool InsererFin(ListeDoubleStatique<N>* liste, int valeur) {
+    return liste != nullptr && LierApresStatique(liste, liste->queue, valeur) != STATIQUE_AUCUN;
+}
+
+template <int N>
+bool InsererApres(ListeDoubleStatique<N>* liste, int precedent, int valeur) {
+    if (liste == nullptr || precedent < 0 || precedent >= N) {
+        return false;
+    }
+    return LierApresStatique(liste, precedent, valeur) != STATIQUE_AUCUN;
+}
+
+/**
+ * @note O(1) : le prédécesseur est lu dans le nœud
+ */
+template <int N>
+bool InsererAvant(ListeDoubleStatique<N>* liste, int suivant, int valeur) {
+    if (liste == nullptr || suivant < 0 || suivant >= N) {
+        return false;
+    }
+    return LierApresStatique(liste, liste->noeuds[suivant].precedent, valeur) != STATIQUE_AUCUN;
+}
+
+template <int N>
+bool InsererPosition(ListeDoubleStatique<N>* liste, int position, int valeur) {
+    if (liste == nullptr || position < 0 || position > liste->taille) {
+        return false;
+    }
+    int precedent = (position == 0) ? STATIQUE_AUCUN : IndexPositionStatique(liste, position - 1);
+    return LierApresStatique(liste, precedent, valeur) != STATIQUE_AUCUN;
+}
+
+template <int N>
+bool InsererTrie(ListeDoubleStatique<N>* liste, int valeur) {
+    return liste != nullptr && LierApresStatique(liste, DernierInferieurStatique(liste, valeur), valeur) != STATIQUE_AUCUN;
+}
+
+template <int N>
+bool SupprimerDebut(ListeDoubleStatique<N>* liste) {
+    if (EstVide(liste)) {
+        return false;
+    }
+    DelierStatique(liste, STATIQUE_AUCUN, liste->tete);
+    return true;
+}
+
+template <int N>
+bool SupprimerFin(ListeDoubleStatique<N>* liste) {
+    if (EstVide(liste)) {
+        return false;
+    }
+    DelierStatique(liste, liste->noeuds[liste->queue].precedent, liste->queue);
+    return true;
+}
+
+/**
+ * @param cible Index d'un nœud de la liste (O(1), appartenance non vérifiée)
+ */
+template <int N>
+bool SupprimerNoeud(ListeDoubleStatique<N>* liste, int cible) {
+    if (EstVide(liste) || cible < 0 || cible >= N) {
+        return false;
+    }
+    DelierStatique(liste, liste->noeuds[cible].precedent, cible);
+    return true;
+}
+
+template <int N>
+bool SupprimerValeur(ListeDoubleStatique<N>* liste, int valeur) {
+    return liste != nullptr && SupprimerValeurStatique(liste, valeur);
+}
+
+template <int N>
+int SupprimerToutesOccurrences(ListeDoubleStatique<N>* liste, int valeur) {
+    return liste == nullptr ? 0 : SupprimerToutesOccurrencesStatique(liste, valeur);
+}
+
+template <int N>
+bool SupprimerPosition(ListeDoubleStatique<N>* liste, int position) {
+    int cible = ObtenirNoeudPosition(liste, position);
+    if (cible == STATIQUE_AUCUN) {
+        return false;
+    }
+    DelierStatique(liste, liste->noeuds[cible].precedent, cible);
+    return true;
+}
+
+template <int N>
+int RechercherValeur(const ListeDoubleStatique<N>* liste, int valeur) {
+    return liste == nullptr ? STATIQUE_AUCUN : RechercherValeurStatique(liste, valeur);
+}
+
+template <int N>
+int ObtenirNoeudPosition(const ListeDoubleStatique<N>* liste, int position) {
+    return liste == nullptr ? STATIQUE_AUCUN : IndexPositionStatique(liste, position);
+}
+
+/**
+ * @brief Nœud à une position comptée depuis la queue (0 = queue)
+ */
+template <int N>
+int ObtenirNoeudPositionInverse(const ListeDoubleStatique<N>* liste, int position) {
+    if (liste == nullptr || position < 0 || position >= liste->taille) {
+        return STATIQUE_AUCUN;
+    }
+    int index = liste->queue;
+    for (int i = 0; i < position; i++) {
+        index = liste->noeuds[index].precedent;
+    }
+    return index;
+}
+
+template <int N>
+std::string ToString(const ListeDoubleStatique<N>* liste) {
+    return liste == nullptr ? "ListeDouble[NULL]" : ToStringStatique(liste, "ListeDouble[", " <-> ");
+}
+
+template <int N>
+void Inverser(ListeDoubleStatique<N>* liste) {
+    if (liste != nullptr) {
+        InverserStatique(liste);
+    }
+}
+
+template <int N>
+void Trier(ListeDoubleStatique<N>* liste) {
+    if (liste != nullptr) {
+        TrierStatique(liste);
+    }
+}
+
+template <int N>
+bool Concatener(ListeDoubleStatique<N>* liste1, const ListeDoubleStatique<N>* liste2) {
+    return liste1 != nullptr && liste2 != nullptr && ConcatenerStatique(liste1, liste2);
+}
+
+/**
+ * @param position Même domaine que Diviser(ListeDouble*) : [1, taille - 1]
+ */
+template <int N>
+void Diviser(ListeDoubleStatique<N>* liste, int position, ListeDoubleStatique<N>* liste2) {
+    if (liste != nullptr && liste2 != nullptr) {
+        DiviserStatique(liste, position, liste2);
+    }
+}
+
+template <int N>
+void SupprimerDoublonsTries(ListeDoubleStatique<N>* liste) {
+    if (liste != nullptr) {
+        SupprimerDoublonsTriesStatique(liste);
+    }
+}
+
+template <int N>
+void RotationGauche(ListeDoubleStatique<N>* liste, int k) {
+    if (liste != nullptr) {
+        RotationStatique(liste, k);
+    }
+}
+
+template <int N>
+void RotationDroite(ListeDoubleStatique<N>* liste, int k) {
+    if (liste != nullptr) {
+        RotationStatique(liste, -(long long)k);
+    }
+}
+
+#endif
@@ -0,0 +1,489 @@
+#include "ListVerrous.h"
+#include "ListAtomique.h"
+#include "ListRecuperation.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+// ============================================================================
+// VERROUS TOURNANTS ET LIENS (usage interne)
+// ============================================================================
+
+#define VERROUS_PRIS_MAX 8
+
+/**
+ * @brief Verrous tenus par une opération, pour les relâcher d'un coup
+ */
+typedef struct {
+    bool* verrous[VERROUS_PRIS_MAX];
+    int nombre;
+} VerrousPris;
+
+static void Verrouiller(bool* verrou) {
+    std::atomic_ref<bool> drapeau(*verrou);
+    ReculExponentiel recul = CreerRecul();
+    // Tester avant d'échanger : l'attente se fait en lecture, sans faire circuler la ligne
+    while (drapeau.load(std::memory_order_relaxed) || drapeau.exchange(true, std::memory_order_acquire)) {
+        Reculer(&recul);
+    }
+}
+
+static bool EssayerVerrouiller(bool* verrou) {
+    std::atomic_ref<bool> drapeau(*verrou);
+    return !drapeau.load(std::memory_order_relaxed) && !drapeau.exchange(true, std::memory_order_acquire);
+}
+
+static void Deverrouiller(bool* verrou) {
+    std::atomic_ref<bool>(*verrou).store(false, std::memory_order_release);
+}
+
+static inline bool* VerrouNoeud(NoeudD* noeud) {
+    return &((NoeudVerrouD*)noeud)->verrou;
+}
+
+/**
+ * @brief Verrou qui protège le lien vers noeud depuis la gauche : celui de precedent, ou verrouTete
+ */
+static inline bool* VerrouGauche(ListeDoubleVerrous* liste, NoeudD* precedent) {
+    return precedent != nullptr ? VerrouNoeud(precedent) : &liste->verrouTete;
+}
+
+/**
+ * @brief Verrou qui protège le lien arrière de suivant : le sien, ou verrouQueue
+ */
+static inline bool* VerrouDroite(ListeDoubleVerrous* liste, NoeudD* suivant) {
+    return suivant != nullptr ? VerrouNoeud(suivant) : &liste->verrouQueue;
+}
+
+static inline NoeudD* Charger(NoeudD*& lien) {
+    return std::atomic_ref<NoeudD*>(lien).load(std::memory_order_acquire);
+}
+
+static inline void Ecrire(NoeudD*& lien, NoeudD* valeur) {
+    std::atomic_ref<NoeudD*>(lien).store(valeur, std::memory_order_release);
+}
+
+static inline bool EstSupprime(NoeudD* noeud) {
+    return std::atomic_ref<bool>(((NoeudVerrouD*)noeud)->supprime).load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Indique si precedent (ou la tête si NULL) désigne encore noeud
+ * @note L'appelant tient VerrouGauche(liste, precedent)
+ */
+static bool EstLieA(ListeDoubleVerrous* liste, NoeudD* precedent, NoeudD* noeud) {
+    if (precedent == nullptr) {
+        return Charger(liste->liste.tete) == noeud;
+    }
+    return !EstSupprime(precedent) && Charger(precedent->suivant) == noeud;
+}
+
+/**
+ * @brief Prend un verrou s'il n'est pas déjà tenu ; par tentative seulement si essai
+ */
+static bool Prendre(VerrousPris* pris, bool* verrou, bool essai) {
+    for (int i = 0; i < pris->nombre; i++) {
+        if (pris->verrous[i] == verrou) {
+            return true;
+        }
+    }
+    if (essai) {
+        if (!EssayerVerrouiller(verrou)) {
+            return false;
+        }
+    } else {
+        Verrouiller(verrou);
+    }
+    pris->verrous[pris->nombre++] = verrou;
+    return true;
+}
+
+static void RelacherTout(VerrousPris* pris) {
+    for (int i = pris->nombre - 1; i >= 0; i--) {
+        Deverrouiller(pris->verrous[i]);
+    }
+    pris->nombre = 0;
+}
+
+/**
+ * @brief Verrouille, dans l'ordre de la liste, le précédent de noeud, noeud et (si demandé) son suivant
+ * @return false si noeud n'est plus lié à son précédent ou si une tentative échoue
+ */
+static bool PrendreVoisinage(ListeDoubleVerrous* liste, NoeudD* noeud, VerrousPris* pris, bool avecSuivant,
+                             bool essai) {
+    NoeudD* precedent = Charger(noeud->precedent);
+    if (!Prendre(pris, VerrouGauche(liste, precedent), essai) || !EstLieA(liste, precedent, noeud)) {
+        return false;
+    }
+    // precedent vivant et lié à noeud : noeud est dans la liste, et le reste tant que ce verrou est tenu
+    if (!Prendre(pris, VerrouNoeud(noeud), essai)) {
+        return false;
+    }
+    return !avecSuivant || Prendre(pris, VerrouDroite(liste, Charger(noeud->suivant)), essai);
+}
+
+/**
+ * @brief Accroche noeud entre precedent et suivant (verrous de gauche et de droite tenus)
+ */
+static void Lier(ListeDoubleVerrous* liste, NoeudD* precedent, NoeudD* noeud, NoeudD* suivant) {
+    Ecrire(noeud->precedent, precedent);
+    Ecrire(noeud->suivant, suivant);
+    Ecrire(precedent != nullptr ? precedent->suivant : liste->liste.tete, noeud);
+    Ecrire(suivant != nullptr ? suivant->precedent : liste->liste.queue, noeud);
+}
+
+/**
+ * @brief Décroche noeud ; ses propres liens restent intacts pour les parcours optimistes en cours
+ */
+static void Delier(ListeDoubleVerrous* liste, NoeudD* noeud) {
+    NoeudD* precedent = Charger(noeud->precedent);
+    NoeudD* suivant = Charger(noeud->suivant);
+    Ecrire(precedent != nullptr ? precedent->suivant : liste->liste.tete, suivant);
+    Ecrire(suivant != nullptr ? suivant->precedent : liste->liste.queue, precedent);
+}
+
+static NoeudD* NouveauNoeud(int valeur) {
+    NoeudVerrouD* noeud = (NoeudVerrouD*)malloc(sizeof(NoeudVerrouD));
+    if (noeud == nullptr) {
+        return nullptr;
+    }
+    noeud->noeud.donnee = valeur;
+    noeud->verrou = false;
+    noeud->supprime = false;
+    return &noeud->noeud;
+}
+
+static void AjusterTaille(ListeDoubleVerrous* liste, int delta) {
+    std::atomic_ref<int>(liste->liste.taille).fetch_add(delta, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Marque et décroche cible (voisinage verrouillé), puis relâche les verrous et la retire
+ */
+static void SupprimerVerrouille(ListeDoubleVerrous* liste, NoeudD* cible, VerrousPris* pris,
+                                ParticipantEpoque* participant) {
+    std::atomic_ref<bool>(((NoeudVerrouD*)cible)->supprime).store(true, std::memory_order_release);
+    Delier(liste, cible);
+    AjusterTaille(liste, -1);
+    RelacherTout(pris);
+    Retirer(DomaineEpoqueGlobal(), participant, cible);
+}
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+ListeDoubleVerrous* AllocateDoubleVerrous(ModeVerrous mode) {
+    ListeDoubleVerrous* liste = new (std::nothrow) ListeDoubleVerrous;
+    if (liste == nullptr) {
+        return nullptr;
+    }
+    liste->liste = CreerDouble();
+    liste->verrouTete = false;
+    liste->verrouQueue = false;
+    liste->mode = mode;
+    return liste;
+}
+
+void Detruire(ListeDoubleVerrous* liste) {
+    if (liste == nullptr) {
+        return;
+    }
+    NoeudD* noeud = liste->liste.tete;
+    while (noeud != nullptr) {
+        NoeudD* suivant = noeud->suivant;
+        free(noeud);
+        noeud = suivant;
+    }
+    delete liste;
+}
+
+// ============================================================================
+// OPÉRATIONS PAR POSITION
+// ============================================================================
+
+/**
+ * @brief Fenêtre (precedent, suivant) où une valeur insérée occupera position
+ *
+ * En couplage, la fenêtre est atteinte main dans la main et ses deux verrous
+ * sont tenus au retour. En mode optimiste, elle est trouvée sans verrou
+ * puis verrouillée et validée, en recommençant si elle a changé.
+ * @return false si la position dépasse la taille (aucun verrou tenu)
+ */
+static bool PrendreFenetre(ListeDoubleVerrous* liste, int position, NoeudD** precedent, NoeudD** suivant,
+                           VerrousPris* pris) {
+    if (liste->mode == VERROUS_COUPLAGE) {
+        NoeudD* gauche = nullptr;
+        Prendre(pris, &liste->verrouTete, false);
+        NoeudD* droite = Charger(liste->liste.tete);
+        Prendre(pris, VerrouDroite(liste, droite), false);
+        for (int i = 0; i < position; i++) {
+            if (droite == nullptr) {
+                RelacherTout(pris);
+                return false;
+            }
+            NoeudD* apres = Charger(droite->suivant);
+            Verrouiller(VerrouDroite(liste, apres));
+            Deverrouiller(VerrouGauche(liste, gauche));
+            pris->verrous[0] = pris->verrous[1];
+            pris->verrous[1] = VerrouDroite(liste, apres);
+            gauche = droite;
+            droite = apres;
+        }
+        *precedent = gauche;
+        *suivant = droite;
+        return true;
+    }
+
+    while (true) {
+        NoeudD* gauche = nullptr;
+        NoeudD* droite = Charger(liste->liste.tete);
+        for (int i = 0; i < position; i++) {
+            if (droite == nullptr) {
+                return false;
+            }
+            gauche = droite;
+            droite = Charger(droite->suivant);
+        }
+        Prendre(pris, VerrouGauche(liste, gauche), false);
+        if (EstLieA(liste, gauche, droite)) {
+            Prendre(pris, VerrouDroite(liste, droite), false);
+            *precedent = gauche;
+            *suivant = droite;
+            return true;
+        }
+        RelacherTout(pris);
+    }
+}
+
+bool InsererPosition(ListeDoubleVerrous* liste, int position, int valeur) {
+    if (liste == nullptr || position < 0) {
+        return false;
+    }
+    NoeudD* noeud = NouveauNoeud(valeur);
+    if (noeud == nullptr) {
+        return false;
+    }
+
+    DomaineEpoque* domaine = DomaineEpoqueGlobal();
+    ParticipantEpoque* participant = ParticipantEpoqueDuThread();
+    EntrerSection(domaine, participant);
+    VerrousPris pris = {{nullptr}, 0};
+    NoeudD* precedent;
+    NoeudD* suivant;
+    bool insere = PrendreFenetre(liste, position, &precedent, &suivant, &pris);
+    if (insere) {
+        Lier(liste, precedent, noeud, suivant);
+        AjusterTaille(liste, 1);
+        RelacherTout(&pris);
+    } else {
+        free(noeud);
+    }
+    SortirSection(domaine, participant);
+    return insere;
+}
+
+bool SupprimerPosition(ListeDoubleVerrous* liste, int position) {
+    if (liste == nullptr || position < 0) {
+        return false;
+    }
+
+    DomaineEpoque* domaine = DomaineEpoqueGlobal();
+    ParticipantEpoque* participant = ParticipantEpoqueDuThread();
+    EntrerSection(domaine, participant);
+    VerrousPris pris = {{nullptr}, 0};
+    NoeudD* precedent;
+    NoeudD* cible;
+    bool supprime = PrendreFenetre(liste, position, &precedent, &cible, &pris);
+    if (supprime && cible == nullptr) {
+        // position == taille : rien à supprimer
+        RelacherTout(&pris);
+        supprime = false;
+    }
+    if (supprime) {
+        // Fenêtre tenue : verrous de precedent et de cible ; reste le suivant
+        Prendre(&pris, VerrouDroite(liste, Charger(cible->suivant)), false);
+        SupprimerVerrouille(liste, cible, &pris, participant);
+    }
+    SortirSection(domaine, participant);
+    return supprime;
+}
+
+NoeudD* ObtenirNoeudPosition(ListeDoubleVerrous* liste, int position) {
+    if (liste == nullptr || position < 0) {
+        return nullptr;
+    }
+
+    DomaineEpoque* domaine = DomaineEpoqueGlobal();
+    ParticipantEpoque* participant = ParticipantEpoqueDuThread();
+    EntrerSection(domaine, participant);
+    NoeudD* noeud;
+    if (liste->mode == VERROUS_COUPLAGE) {
+        Verrouiller(&liste->verrouTete);
+        noeud = Charger(liste->liste.tete);
+        bool* tenu = &liste->verrouTete;
+        for (int i = 0; noeud != nullptr; i++) {
+            Verrouiller(VerrouNoeud(noeud));
+            Deverrouiller(tenu);
+            tenu = VerrouNoeud(noeud);
+            if (i == position) {
+                break;
+            }
+            noeud = Charger(noeud->suivant);
+        }
+        Deverrouiller(tenu);
+    } else {
+        noeud = Charger(liste->liste.tete);
+        for (int i = 0; i < position && noeud != nullptr; i++) {
+            noeud = Charger(noeud->suivant);
+        }
+    }
+    SortirSection(domaine, participant);
+    return noeud;
+}
+
+// ============================================================================
+// OPÉRATIONS SUR DES NŒUDS
+// ============================================================================
+
+bool InsererApres(ListeDoubleVerrous* liste, NoeudD* precedent, int valeur) {
+    if (liste == nullptr || precedent == nullptr) {
+        return false;
+    }
+    NoeudD* noeud = NouveauNoeud(valeur);
+    if (noeud == nullptr) {
+        return false;
+    }
+
+    VerrousPris pris = {{nullptr}, 0};
+    Prendre(&pris, VerrouNoeud(precedent), false);
+    bool insere = !EstSupprime(precedent);
+    if (insere) {
+        NoeudD* suivant = Charger(precedent->suivant);
+        Prendre(&pris, VerrouDroite(liste, suivant), false);
+        Lier(liste, precedent, noeud, suivant);
+        AjusterTaille(liste, 1);
+    } else {
+        free(noeud);
+    }
+    RelacherTout(&pris);
+    return insere;
+}
+
+bool InsererAvant(ListeDoubleVerrous* liste, NoeudD* suivant, int valeur) {
+    if (liste == nullptr || suivant == nullptr) {
+        return false;
+    }
+    NoeudD* noeud = NouveauNoeud(valeur);
+    if (noeud == nullptr) {
+        return false;
+    }
+
+    DomaineEpoque* domaine = DomaineEpoqueGlobal();
+    ParticipantEpoque* participant = ParticipantEpoqueDuThread();
+    EntrerSection(domaine, participant);
+    VerrousPris pris = {{nullptr}, 0};
+    bool insere = false;
+    while (!EstSupprime(suivant)) {
+        if (PrendreVoisinage(liste, suivant, &pris, false, false)) {
+            Lier(liste, Charger(suivant->precedent), noeud, suivant);
+            AjusterTaille(liste, 1);
+            insere = true;
+        }
+        RelacherTout(&pris);
+        if (insere) {
+            break;
+        }
+    }
+    SortirSection(domaine, participant);
+    if (!insere) {
+        free(noeud);
+    }
+    return insere;
+}
+
+bool SupprimerNoeud(ListeDoubleVerrous* liste, NoeudD* cible) {
+    if (liste == nullptr || cible == nullptr) {
+        return false;
+    }
+
+    DomaineEpoque* domaine = DomaineEpoqueGlobal();
+    ParticipantEpoque* participant = ParticipantEpoqueDuThread();
+    EntrerSection(domaine, participant);
+    VerrousPris pris = {{nullptr}, 0};
+    bool supprime = false;
+    while (!EstSupprime(cible)) {
+        if (PrendreVoisinage(liste, cible, &pris, true, false)) {
+            SupprimerVerrouille(liste, cible, &pris, participant);
+            supprime = true;
+            break;
+        }
+        RelacherTout(&pris);
+    }
+    SortirSection(domaine, participant);
+    return supprime;
+}
+
+bool EchangerNoeuds(ListeDoubleVerrous* liste, NoeudD* noeud1, NoeudD* noeud2) {
+    if (liste == nullptr || noeud1 == nullptr || noeud2 == nullptr) {
+        return false;
+    }
+    if (noeud1 == noeud2) {
+        return !EstSupprime(noeud1);
+    }
+
+    DomaineEpoque* domaine = DomaineEpoqueGlobal();
+    ParticipantEpoque* participant = ParticipantEpoqueDuThread();
+    EntrerSection(domaine, participant);
+    VerrousPris pris = {{nullptr}, 0};
+    ReculExponentiel recul = CreerRecul();
+    bool echange = false;
+    while (!EstSupprime(noeud1) && !EstSupprime(noeud2)) {
+        // Premier voisinage dans l'ordre de la liste, second par tentatives seulement
+        if (PrendreVoisinage(liste, noeud1, &pris, true, false) &&
+            PrendreVoisinage(liste, noeud2, &pris, true, true)) {
+            // Même découpage que EchangerNoeuds(ListeDouble*) : cas adjacents, puis cas général
+            if (Charger(noeud1->suivant) == noeud2) {
+                Delier(liste, noeud2);
+                Lier(liste, Charger(noeud1->precedent), noeud2, noeud1);
+            } else if (Charger(noeud2->suivant) == noeud1) {
+                Delier(liste, noeud1);
+                Lier(liste, Charger(noeud2->precedent), noeud1, noeud2);
+            } else {
+                NoeudD* avant1 = Charger(noeud1->precedent);
+                NoeudD* avant2 = Charger(noeud2->precedent);
+                Delier(liste, noeud1);
+                Delier(liste, noeud2);
+                Lier(liste, avant1, noeud2, avant1 != nullptr ? Charger(avant1->suivant) : Charger(liste->liste.tete));
+                Lier(liste, avant2, noeud1, avant2 != nullptr ? Charger(avant2->suivant) : Charger(liste->liste.tete));
+            }
+            echange = true;
+        }
+        RelacherTout(&pris);
+        if (echange) {
+            break;
+        }
+        Reculer(&recul);
+    }
+    SortirSection(domaine, participant);
+    return echange;
+}
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+int CompterElements(const ListeDoubleVerrous* liste) {
+    if (liste == nullptr) {
+        return 0;
+    }
+    return std::atomic_ref<int>(const_cast<int&>(liste->liste.taille)).load(std::memory_order_relaxed);
+}
+
+std::string ToString(const ListeDoubleVerrous* liste) {
+    if (liste == nullptr) {
+        return "ListeDouble[NULL]";
+    }
+    return ToString(&liste->liste);
+}
@@ -0,0 +1,128 @@
+#ifndef LISTE_VERROUS_H
+#define LISTE_VERROUS_H
+
+#include "ListD.h"
+#include <string>
+
+/**
+ * @brief Nœud d'une liste à verrous fins : un NoeudD suivi de son verrou tournant
+ *
+ * noeud est le premier membre : les liens restent des NoeudD* et un
+ * NoeudD* de la liste se convertit en NoeudVerrouD*. verrou et supprime
+ * ne sont lus et écrits qu'à travers std::atomic_ref.
+ */
+typedef struct {
+    NoeudD noeud;         /**< Donnée et liens, partagés avec ListeDouble */
+    bool verrou;          /**< Verrou tournant du nœud (protège ses deux liens) */
+    bool supprime;        /**< Posé sous verrou quand le nœud quitte la liste */
+} NoeudVerrouD;
+
+/**
+ * @brief Stratégie de parcours des opérations par position
+ */
+typedef enum {
+    VERROUS_COUPLAGE = 0,   /**< Main dans la main : verrou du suivant pris avant de rendre le courant */
+    VERROUS_OPTIMISTE = 1   /**< Parcours sans verrou, puis verrouillage et validation des voisins */
+} ModeVerrous;
+
+/**
+ * @brief ListeDouble modifiable par plusieurs écrivains à la fois
+ *
+ * Chaque nœud porte un petit verrou tournant qui protège ses liens
+ * precedent et suivant ; verrouTete protège tete, verrouQueue protège
+ * queue. Un écrivain ne verrouille que le voisinage qu'il modifie : deux
+ * threads qui travaillent sur des régions disjointes avancent en parallèle.
+ *
+ * Ordre des verrous (absence d'interblocage) : verrouTete, puis les nœuds
+ * dans l'ordre de la liste, puis verrouQueue. Un thread qui tient le verrou
+ * d'un nœud n'attend jamais que le verrou de son suivant, lien stable tant
+ * que ce verrou est tenu : les attentes suivent l'ordre de la liste et ne
+ * peuvent former de cycle. EchangerNoeuds, dont les deux voisinages n'ont
+ * pas d'ordre connu, prend le second par tentatives et relâche tout en cas
+ * d'échec.
+ *
+ * Les nœuds supprimés sont retirés dans DomaineEpoqueGlobal : toutes les
+ * opérations s'exécutent en section, un parcours optimiste ou la lecture du
+ * précédent d'un nœud ne touchent donc jamais de mémoire libérée.
+ */
+typedef struct {
+    ListeDouble liste;              /**< Nœuds alloués comme NoeudVerrouD */
+    alignas(64) bool verrouTete;    /**< Protège liste.tete */
+    alignas(64) bool verrouQueue;   /**< Protège liste.queue */
+    ModeVerrous mode;               /**< Stratégie des opérations par position */
+} ListeDoubleVerrous;
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+/**
+ * @brief Crée une liste vide à verrous fins
+ * @param mode Stratégie de parcours des opérations par position
+ * @return Pointeur vers la liste, ou NULL en cas d'échec
+ */
+ListeDoubleVerrous* AllocateDoubleVerrous(ModeVerrous mode = VERROUS_COUPLAGE);
+
+/**
+ * @brief Libère la liste et ses nœuds (plus aucun thread ne doit l'utiliser)
+ */
+void Detruire(ListeDoubleVerrous* liste);
+
+// ============================================================================
+// OPÉRATIONS PAR POSITION
+// ============================================================================
+
+/**
+ * @brief Insère une valeur pour qu'elle occupe la position donnée
+ * @return false si la position dépasse la taille ou si l'allocation échoue
+ */
+bool InsererPosition(ListeDoubleVerrous* liste, int position, int valeur);
+
+/**
+ * @brief Supprime l'élément à une position
+ * @return false si la position dépasse la taille
+ */
+bool SupprimerPosition(ListeDoubleVerrous* liste, int position);
+
+/**
+ * @brief Obtient le nœud à une position
+ * @note Le nœud reste lisible tant que l'appelant est en section de
+ *       DomaineEpoqueGlobal (ou tant qu'aucun thread ne peut le supprimer)
+ */
+NoeudD* ObtenirNoeudPosition(ListeDoubleVerrous* liste, int position);
+
+// ============================================================================
+// OPÉRATIONS SUR DES NŒUDS
+// ============================================================================
+
+/*
+ * Les nœuds passés en paramètre doivent rester lisibles pendant l'appel
+ * (voir ObtenirNoeudPosition). Une opération sur un nœud supprimé entre
+ * temps échoue sans rien modifier.
+ */
+
+bool InsererApres(ListeDoubleVerrous* liste, NoeudD* precedent, int valeur);
+
+bool InsererAvant(ListeDoubleVerrous* liste, NoeudD* suivant, int valeur);
+
+bool SupprimerNoeud(ListeDoubleVerrous* liste, NoeudD* cible);
+
+/**
+ * @brief Échange la place de deux nœuds (les liens sont modifiés, pas les données)
+ * @return false si l'un des nœuds a été supprimé
+ */
+bool EchangerNoeuds(ListeDoubleVerrous* liste, NoeudD* noeud1, NoeudD* noeud2);
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+int CompterElements(const ListeDoubleVerrous* liste);
+
+/**
+ * @brief Représentation au format de ToString(const ListeDouble*)
+ * @note À n'appeler qu'en l'absence d'écritures concurrentes
+ */
+std::string ToString(const ListeDoubleVerrous* liste);
+
+#endif
@@ -0,0 +1,244 @@
+#include "ListVol.h"
+#include "ListRecuperation.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+// ============================================================================
+// TRANCHES (usage interne)
+// ============================================================================
+
+static TrancheTaches* NouvelleTranche(long long debut, TrancheTaches* precedent) {
+    TrancheTaches* tranche = (TrancheTaches*)malloc(sizeof(TrancheTaches));
+    if (tranche == nullptr) {
+        return nullptr;
+    }
+    tranche->debut = debut;
+    tranche->precedent = precedent;
+    tranche->suivant = nullptr;
+    return tranche;
+}
+
+static inline TrancheTaches* Suivante(TrancheTaches* tranche) {
+    return std::atomic_ref<TrancheTaches*>(tranche->suivant).load(std::memory_order_acquire);
+}
+
+static inline std::atomic_ref<int> Case(TrancheTaches* tranche, long long indice) {
+    return std::atomic_ref<int>(tranche->taches[indice - tranche->debut]);
+}
+
+static inline long long Fin(const TrancheTaches* tranche) {
+    return tranche->debut + DEQUE_TACHES_PAR_TRANCHE;
+}
+
+/**
+ * @brief Fait suivre trancheHaut à haut, en retirant chaque tranche dépassée
+ *
+ * Seul le thread dont le compare-and-swap avance trancheHaut retire la
+ * tranche quittée : chacune n'est retirée qu'une fois, même si plusieurs
+ * voleurs terminent des tranches dans le désordre.
+ */
+static void AvancerTrancheHaut(DequeVol* deque, ParticipantEpoque* participant) {
+    TrancheTaches* tranche = deque->trancheHaut.load(std::memory_order_acquire);
+    while (Fin(tranche) <= deque->haut.load(std::memory_order_acquire)) {
+        // haut <= bas : le propriétaire a déjà accroché la tranche suivante
+        TrancheTaches* suivante = Suivante(tranche);
+        if (deque->trancheHaut.compare_exchange_strong(tranche, suivante, std::memory_order_acq_rel)) {
+            Retirer(DomaineEpoqueGlobal(), participant, tranche);
+            tranche = suivante;
+        }
+    }
+}
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+DequeVol* AllocateDequeVol() {
+    DequeVol* deque = new (std::nothrow) DequeVol;
+    if (deque == nullptr) {
+        return nullptr;
+    }
+    TrancheTaches* premiere = NouvelleTranche(0, nullptr);
+    if (premiere == nullptr) {
+        delete deque;
+        return nullptr;
+    }
+    deque->haut.store(0, std::memory_order_relaxed);
+    deque->trancheHaut.store(premiere, std::memory_order_relaxed);
+    deque->bas.store(0, std::memory_order_relaxed);
+    deque->trancheBas = premiere;
+    return deque;
+}
+
+void Detruire(DequeVol* deque) {
+    if (deque == nullptr) {
+        return;
+    }
+    // Les tranches antérieures à trancheHaut sont déjà dans le domaine d'époques
+    TrancheTaches* tranche = deque->trancheHaut.load(std::memory_order_relaxed);
+    while (tranche != nullptr) {
+        TrancheTaches* suivante = tranche->suivant;
+        free(tranche);
+        tranche = suivante;
+    }
+    delete deque;
+}
+
+// ============================================================================
+// OPÉRATIONS DU PROPRIÉTAIRE
+// ============================================================================
+
+bool InsererFin(DequeVol* deque, int tache) {
+    if (deque == nullptr) {
+        return false;
+    }
+    long long bas = deque->bas.load(std::memory_order_relaxed);
+    TrancheTaches* tranche = deque->trancheBas;
+
+    // trancheBas contient toujours la case bas : la suivante est prête avant
+    // que bas ne l'atteigne, et n'est jamais retirée tant que bas la précède
+    if (bas + 1 == Fin(tranche)) {
+        TrancheTaches* suivante = tranche->suivant;
+        if (suivante == nullptr) {
+            suivante = NouvelleTranche(Fin(tranche), tranche);
+            if (suivante == nullptr) {
+                return false;
+            }
+            std::atomic_ref<TrancheTaches*>(tranche->suivant).store(suivante, std::memory_order_release);
+        }
+        deque->trancheBas = suivante;
+    }
+    Case(tranche, bas).store(tache, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    deque->bas.store(bas + 1, std::memory_order_relaxed);
+    return true;
+}
+
+bool SupprimerFin(DequeVol* deque, int* tache) {
+    if (deque == nullptr) {
+        return false;
+    }
+    DomaineEpoque* domaine = DomaineEpoqueGlobal();
+    ParticipantEpoque* participant = ParticipantEpoqueDuThread();
+    EntrerSection(domaine, participant);
+
+    long long bas = deque->bas.load(std::memory_order_relaxed) - 1;
+    TrancheTaches* tranche = deque->trancheBas;
+    deque->bas.store(bas, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    long long haut = deque->haut.load(std::memory_order_relaxed);
+
+    bool retire = haut <= bas;
+    if (retire) {
+        // haut <= bas : la tranche de bas n'a pas été quittée par les voleurs
+        if (bas < tranche->debut) {
+            tranche = tranche->precedent;
+        }
+        int valeur = Case(tranche, bas).load(std::memory_order_relaxed);
+        if (haut == bas) {
+            // Dernière tâche : la disputer aux voleurs sur haut
+            retire = deque->haut.compare_exchange_strong(haut, haut + 1, std::memory_order_seq_cst,
+                                                         std::memory_order_relaxed);
+            deque->bas.store(bas + 1, std::memory_order_relaxed);
+            if (retire && haut + 1 == Fin(tranche)) {
+                AvancerTrancheHaut(deque, participant);
+            }
+        } else {
+            deque->trancheBas = tranche;
+        }
+        if (retire && tache != nullptr) {
+            *tache = valeur;
+        }
+    } else {
+        deque->bas.store(bas + 1, std::memory_order_relaxed);
+    }
+
+    SortirSection(domaine, participant);
+    return retire;
+}
+
+// ============================================================================
+// OPÉRATION DES VOLEURS
+// ============================================================================
+
+bool Voler(DequeVol* deque, int* tache) {
+    if (deque == nullptr) {
+        return false;
+    }
+    DomaineEpoque* domaine = DomaineEpoqueGlobal();
+    ParticipantEpoque* participant = ParticipantEpoqueDuThread();
+    EntrerSection(domaine, participant);
+
+    bool vole = false;
+    while (true) {
+        long long haut = deque->haut.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long long bas = deque->bas.load(std::memory_order_acquire);
+        if (haut >= bas) {
+            break;
+        }
+
+        // trancheHaut peut être en retard sur haut, jamais en avance de plus d'un pas
+        TrancheTaches* tranche = deque->trancheHaut.load(std::memory_order_acquire);
+        while (Fin(tranche) <= haut) {
+            tranche = Suivante(tranche);
+        }
+        if (tranche->debut > haut) {
+            // haut a déjà été dépassé : relire
+            continue;
+        }
+        int valeur = Case(tranche, haut).load(std::memory_order_relaxed);
+        if (deque->haut.compare_exchange_strong(haut, haut + 1, std::memory_order_seq_cst,
+                                                std::memory_order_relaxed)) {
+            if (haut + 1 == Fin(tranche)) {
+                AvancerTrancheHaut(deque, participant);
+            }
+            if (tache != nullptr) {
+                *tache = valeur;
+            }
+            vole = true;
+            break;
+        }
+    }
+
+    SortirSection(domaine, participant);
+    return vole;
+}
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+int CompterElements(const DequeVol* deque) {
+    if (deque == nullptr) {
+        return 0;
+    }
+    long long bas = deque->bas.load(std::memory_order_acquire);
+    long long haut = deque->haut.load(std::memory_order_acquire);
+    return bas > haut ? (int)(bas - haut) : 0;
+}
+
+bool EstVide(const DequeVol* deque) {
+    return CompterElements(deque) == 0;
+}
+
+std::string ToString(const DequeVol* deque) {
+    if (deque == nullptr) {
+        return "ListeDouble[NULL]";
+    }
+    std::string resultat = "ListeDouble[";
+    long long bas = deque->bas.load(std::memory_order_acquire);
+    TrancheTaches* tranche = deque->trancheHaut.load(std::memory_order_acquire);
+    for (long long i = deque->haut.load(std::memory_order_acquire); i < bas; i++) {
+        while (Fin(tranche) <= i) {
+            tranche = tranche->suivant;
+        }
+        if (resultat.size() > 12) {
+            resultat += " <-> ";
+        }
+        resultat += "Noeud(" + std::to_string(tranche->taches[i - tranche->debut]) + ")";
+    }
+    return resultat + "]";
+}
@@ -0,0 +1,113 @@
+#ifndef LISTE_VOL_H
+#define LISTE_VOL_H
+
+#include <atomic>
+#include <string>
+
+#define DEQUE_TACHES_PAR_TRANCHE 256
+
+/**
+ * @brief Tranche de cases de tâches, chaînée comme un NoeudD
+ *
+ * La case d'indice global i se trouve dans la tranche telle que
+ * debut <= i < debut + DEQUE_TACHES_PAR_TRANCHE. Une case garde son indice
+ * global : une tranche garde ses bornes toute sa vie. Seul haut croît de
+ * façon monotone ; bas recule quand le propriétaire retire. suivant et les
+ * cases ne sont lus et écrits qu'à travers std::atomic_ref, ce qui laisse
+ * la tranche allouable par malloc et libérable par le domaine d'époques.
+ */
+typedef struct TrancheTaches {
+    long long debut;                                /**< Indice global de la première case */
+    struct TrancheTaches* precedent;                /**< Tranche précédente (propriétaire seulement) */
+    struct TrancheTaches* suivant;                  /**< Tranche suivante, publiée avant usage */
+    int taches[DEQUE_TACHES_PAR_TRANCHE];           /**< Cases de tâches */
+} TrancheTaches;
+
+/**
+ * @brief File double de vol de tâches (Chase-Lev) sur une chaîne de tranches
+ *
+ * Le propriétaire insère et retire à la queue (indice bas), les voleurs
+ * prennent à la tête (indice haut) : comme une ListeDouble utilisée en
+ * file de travail, mais sans verrou. Au lieu du tableau circulaire de
+ * Chase-Lev, recopié quand il déborde, les cases sont réparties en
+ * tranches de taille fixe chaînées de tete vers queue : la file grandit
+ * en accrochant une tranche, sans jamais recopier.
+ *
+ * InsererFin et SupprimerFin ne bouclent jamais (sans attente) ; Voler
+ * réserve sa case par un compare-and-swap de haut, qui n'échoue que si un
+ * autre voleur (ou le propriétaire, pour la dernière tâche) l'a prise.
+ * Une tranche vidée par les voleurs est retirée dans DomaineEpoqueGlobal ;
+ * celles vidées par le propriétaire sont gardées pour ses prochaines
+ * insertions.
+ */
+typedef struct {
+    alignas(64) std::atomic<long long> haut;                /**< Prochaine tâche à voler */
+    std::atomic<TrancheTaches*> trancheHaut;                /**< Tranche de haut (ou une tranche antérieure) */
+    alignas(64) std::atomic<long long> bas;                 /**< Prochaine case libre du propriétaire */
+    TrancheTaches* trancheBas;                              /**< Tranche de la case bas (propriétaire seulement) */
+} DequeVol;
+
+// ============================================================================
+// FONCTIONS DE CRÉATION ET DESTRUCTION
+// ============================================================================
+
+/**
+ * @brief Crée une file de vol vide (avec sa première tranche)
+ * @return Pointeur vers la file, ou NULL en cas d'échec
+ */
+DequeVol* AllocateDequeVol();
+
+/**
+ * @brief Libère la file et ses tranches (plus aucun thread ne doit l'utiliser)
+ */
+void Detruire(DequeVol* deque);
+
+// ============================================================================
+// OPÉRATIONS DU PROPRIÉTAIRE (un seul thread)
+// ============================================================================
+
+/**
+ * @brief Ajoute une tâche à la queue
+ * @return false si une nouvelle tranche n'a pu être allouée
+ */
+bool InsererFin(DequeVol* deque, int tache);
+
+/**
+ * @brief Reprend la dernière tâche insérée
+ * @param tache Reçoit la tâche (peut être NULL)
+ * @return false si la file était vide (ou sa dernière tâche volée entre temps)
+ */
+bool SupprimerFin(DequeVol* deque, int* tache);
+
+// ============================================================================
+// OPÉRATION DES VOLEURS (tout thread)
+// ============================================================================
+
+/**
+ * @brief Vole la plus ancienne tâche, à la tête
+ *
+ * Recommence tant que la file n'est pas vide et qu'un autre thread lui
+ * prend la case visée.
+ * @param tache Reçoit la tâche (peut être NULL)
+ * @return false si la file était vide
+ */
+bool Voler(DequeVol* deque, int* tache);
+
+// ============================================================================
+// FONCTIONS D'INFORMATION
+// ============================================================================
+
+/**
+ * @brief Nombre de tâches (exact seulement en l'absence d'opérations en cours)
+ */
+int CompterElements(const DequeVol* deque);
+
+bool EstVide(const DequeVol* deque);
+
+/**
+ * @brief Représentation de tete à queue, au format de ToString(const ListeDouble*)
+ * @note À n'appeler qu'en l'absence d'opérations concurrentes
+ */
+std::string ToString(const DequeVol* deque);
+
+#endif